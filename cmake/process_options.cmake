@@ -2,6 +2,10 @@
 add_library(pennylane_lightning_compile_options INTERFACE)
 add_library(pennylane_lightning_external_libs INTERFACE)
 
+# The asynchronous application of operation streams runs on std::thread
+find_package(Threads REQUIRED)
+target_link_libraries(pennylane_lightning_external_libs INTERFACE Threads::Threads)
+
 if(MSVC) # For M_PI
     target_compile_options(pennylane_lightning_compile_options INTERFACE /D_USE_MATH_DEFINES)
 endif()
@@ -62,3 +66,19 @@ if(ENABLE_BLAS)
 endif()
 
 
+if(ENABLE_MPI)
+    message(STATUS "ENABLE_MPI is ON. Find MPI.")
+    find_package(MPI COMPONENTS CXX)
+
+    if(NOT MPI_CXX_FOUND)
+        message(FATAL_ERROR "MPI is enabled but not found.")
+    endif()
+
+    target_link_libraries(pennylane_lightning_external_libs INTERFACE MPI::MPI_CXX)
+endif()
+
+
+if(ENABLE_INSTRUMENTATION)
+    message(STATUS "ENABLE_INSTRUMENTATION is ON. Recording per-operation timing counters.")
+    target_compile_options(pennylane_lightning_compile_options INTERFACE "-D_ENABLE_INSTRUMENTATION=1")
+endif()
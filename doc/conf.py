@@ -87,9 +87,17 @@ exhale_args = {
     "exhaleDoxygenStdin": (
         "INPUT = "
         "../pennylane_lightning/src/algorithms/AdjointDiff.hpp "
+        "../pennylane_lightning/src/algorithms/AdjointDiffMPI.hpp "
+        "../pennylane_lightning/src/algorithms/BatchedExecution.hpp "
+        "../pennylane_lightning/src/algorithms/Observables.hpp "
+        "../pennylane_lightning/src/algorithms/ObservablesMPI.hpp "
+        "../pennylane_lightning/src/algorithms/Sampler.hpp "
         "../pennylane_lightning/src/bindings/Bindings.cpp "
         "../pennylane_lightning/src/simulator/Gates.hpp "
         "../pennylane_lightning/src/simulator/StateVector.hpp "
+        "../pennylane_lightning/src/simulator/StateVectorMPI.hpp "
+        "../pennylane_lightning/src/util/Dispatcher.hpp "
+        "../pennylane_lightning/src/util/Memory.hpp "
         "../pennylane_lightning/src/util/Util.hpp "
         "../pennylane_lightning/src/util/Error.hpp "
         "EXCLUDE_SYMBOLS = std::* "
@@ -9,46 +9,22 @@
 #include "StateVectorManaged.hpp"
 
 /**
- * @brief Outputs wall-time for gate-benchmark.
- * @param argc Number of arguments + 1 passed by user.
- * @param argv Binary name followed by number of times gate is repeated and
- * number of qubits.
- * @return Returns 0 if completed successfully.
+ * @brief Applies the benchmark gate sequence and returns the wall-time per
+ * gate repetition in milliseconds.
+ *
+ * @tparam T Floating point precision type.
+ * @param svdat Statevector to apply the gates to.
+ * @param random_parameter_vector Random angles, one per repetition and qubit.
+ * @return double Average wall-time of one repetition.
  */
-int main(int argc, char *argv[]) {
-    using TestType = double;
-
-    // Handle input
-    try {
-        if (argc != 3) {
-            throw argc;
-        }
-    } catch (int e) {
-        std::cerr << "Wrong number of inputs. User provided " << e - 1
-                  << " inputs. "
-                  << "Usage: " + std::string(argv[0]) +
-                         " $num_gate_reps $num_qubits"
-                  << std::endl;
-        return -1;
-    }
-    const size_t num_gate_reps = std::stoi(argv[1]);
-    const size_t num_qubits = std::stoi(argv[2]);
-
-    // Generate random values for parametric gates
-    std::random_device rd;
-    std::default_random_engine eng(rd());
-    std::uniform_real_distribution<TestType> distr(0.0, 1.0);
-    std::vector<std::vector<TestType>> random_parameter_vector(num_gate_reps);
-    std::for_each(
-        random_parameter_vector.begin(), random_parameter_vector.end(),
-        [num_qubits, &eng, &distr](std::vector<TestType> &vec) {
-            vec.resize(num_qubits);
-            std::for_each(vec.begin(), vec.end(),
-                          [&eng, &distr](TestType &val) { val = distr(eng); });
-        });
+template <class T>
+double runGateSequence(
+    Pennylane::StateVectorManaged<T> &svdat,
+    const std::vector<std::vector<T>> &random_parameter_vector) {
+    const size_t num_gate_reps = random_parameter_vector.size();
+    const size_t num_qubits = svdat.getNumQubits();
 
     // Run each gate specified number of times and measure walltime
-    Pennylane::StateVectorManaged<TestType> svdat{num_qubits};
     std::chrono::time_point<std::chrono::high_resolution_clock> t_start, t_end;
     t_start = std::chrono::high_resolution_clock::now();
     for (size_t gate_rep = 0; gate_rep < num_gate_reps; gate_rep++) {
@@ -70,7 +46,7 @@ int main(int argc, char *argv[]) {
             svdat.applyCZ(two_qubit_int_idx, two_qubit_ext_idx, false);
 
             // Apply single qubit parametric operations
-            const TestType angle =
+            const T angle =
                 2.0 * M_PI * random_parameter_vector[gate_rep][index];
             svdat.applyRX(int_idx, ext_idx, false, angle);
             svdat.applyRY(int_idx, ext_idx, false, angle);
@@ -84,13 +60,80 @@ int main(int argc, char *argv[]) {
     }
     t_end = std::chrono::high_resolution_clock::now();
 
-    // Output walltime in csv format (Num Qubits, Time (milliseconds))
     const auto walltime =
         0.001 * ((std::chrono::duration_cast<std::chrono::microseconds>(
                       t_end - t_start))
                      .count());
-    std::cout << num_qubits << ", "
-              << walltime / static_cast<double>(num_gate_reps) << std::endl;
+    return walltime / static_cast<double>(num_gate_reps);
+}
+
+/**
+ * @brief Outputs wall-time for gate-benchmark.
+ * @param argc Number of arguments + 1 passed by user.
+ * @param argv Binary name followed by number of times gate is repeated and
+ * number of qubits. An optional maximum number of threads enables the thread
+ * scaling mode.
+ * @return Returns 0 if completed successfully.
+ */
+int main(int argc, char *argv[]) {
+    using TestType = double;
+
+    // Handle input
+    try {
+        if (argc != 3 && argc != 4) {
+            throw argc;
+        }
+    } catch (int e) {
+        std::cerr << "Wrong number of inputs. User provided " << e - 1
+                  << " inputs. "
+                  << "Usage: " + std::string(argv[0]) +
+                         " $num_gate_reps $num_qubits [$max_num_threads]"
+                  << std::endl;
+        return -1;
+    }
+    const size_t num_gate_reps = std::stoi(argv[1]);
+    const size_t num_qubits = std::stoi(argv[2]);
+    const size_t max_num_threads = (argc == 4) ? std::stoi(argv[3]) : 0;
+
+    // Generate random values for parametric gates
+    std::random_device rd;
+    std::default_random_engine eng(rd());
+    std::uniform_real_distribution<TestType> distr(0.0, 1.0);
+    std::vector<std::vector<TestType>> random_parameter_vector(num_gate_reps);
+    std::for_each(
+        random_parameter_vector.begin(), random_parameter_vector.end(),
+        [num_qubits, &eng, &distr](std::vector<TestType> &vec) {
+            vec.resize(num_qubits);
+            std::for_each(vec.begin(), vec.end(),
+                          [&eng, &distr](TestType &val) { val = distr(eng); });
+        });
+
+    Pennylane::StateVectorManaged<TestType> svdat{num_qubits};
+
+    if (max_num_threads == 0) {
+        // Output walltime in csv format (Num Qubits, Time (milliseconds))
+        std::cout << num_qubits << ", "
+                  << runGateSequence(svdat, random_parameter_vector)
+                  << std::endl;
+        return 0;
+    }
+
+    // Output walltime for doubling thread counts in csv format
+    // (Num Qubits, Num Threads, Time (milliseconds), Speedup)
+    double serial_walltime = 0.0;
+    for (size_t num_threads = 1;;
+         num_threads = std::min(2 * num_threads, max_num_threads)) {
+        svdat.setNumThreads(num_threads);
+        const double walltime = runGateSequence(svdat, random_parameter_vector);
+        if (num_threads == 1) {
+            serial_walltime = walltime;
+        }
+        std::cout << num_qubits << ", " << num_threads << ", " << walltime
+                  << ", " << serial_walltime / walltime << std::endl;
+        if (num_threads == max_num_threads) {
+            break;
+        }
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -14,16 +14,24 @@
 r"""
 Helper functions for serializing quantum tapes.
 """
-from typing import List, Tuple
+from typing import List, Optional, Tuple
 
 import numpy as np
-from pennylane import BasisState, Hadamard, Projector, QubitStateVector, Rot
+from pennylane import (
+    BasisState,
+    Hadamard,
+    Hamiltonian,
+    Projector,
+    QubitStateVector,
+    SparseHamiltonian,
+)
 from pennylane.grouping import is_pauli_word
 from pennylane.operation import Observable, Tensor
 from pennylane.tape import QuantumTape
+from scipy.sparse import csr_matrix
 
 try:
-    from .lightning_qubit_ops import StateVectorC128, ObsStructC128
+    from .lightning_qubit_ops import StateVectorC128, ObsStructC64, ObsStructC128
 except ImportError:
     pass
 
@@ -46,30 +54,80 @@ def _obs_has_kernel(obs: Observable) -> bool:
     return False
 
 
-def _serialize_obs(tape: QuantumTape, wires_map: dict) -> List:
+def _obs_as_matrix(obs: Observable) -> bool:
+    """Returns True if the input observable, which is not a tensor product, is given to the C++
+    backend as a dense matrix.
+
+    The backend has no projector kernel, so projectors are passed as their matrix, like the
+    Hermitian observables.
+
+    Args:
+        obs (Observable): the input observable
+
+    Returns:
+        bool: indicating whether ``obs`` is serialized as its matrix
+    """
+    return isinstance(obs, Projector) or not _obs_has_kernel(obs)
+
+
+def _serialize_sparse(
+    observable: Observable, wires_map: dict, use_csingle: bool = False
+) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """Serializes a sparse Hamiltonian as its matrix in compressed sparse row (CSR) format.
+
+    Args:
+        observable (SparseHamiltonian): the input observable
+        wires_map (dict): a dictionary mapping input wires to the device's backend wires
+        use_csingle (bool): whether to serialize for the single-precision backend
+
+    Returns:
+        Tuple[array, array, array] or None: the non-zero entries, their column indices and the row
+        offsets, or ``None`` if the observable does not act on all wires in the device order
+    """
+    wires = [wires_map[w] for w in observable.wires.tolist()]
+    if wires != list(range(len(wires_map))):
+        return None
+
+    mat = csr_matrix(observable.parameters[0])
+    c_dtype = np.complex64 if use_csingle else np.complex128
+    return mat.data.astype(c_dtype), mat.indices, mat.indptr
+
+
+def _serialize_obs(tape: QuantumTape, wires_map: dict, use_csingle: bool = False) -> List:
     """Serializes the observables of an input tape.
 
+    Observables without a kernel and projectors are serialized as dense matrices, and sparse
+    Hamiltonians in CSR format.
+
     Args:
         tape (QuantumTape): the input quantum tape
         wires_map (dict): a dictionary mapping input wires to the device's backend wires
+        use_csingle (bool): whether to serialize for the single-precision backend
 
     Returns:
-        list(ObsStructC128): A list of observable objects compatible with the C++ backend
+        list(ObsStructC128 or ObsStructC64): A list of observable objects compatible with the
+        C++ backend
     """
     obs = []
+    obs_struct = ObsStructC64 if use_csingle else ObsStructC128
+    c_dtype = np.complex64 if use_csingle else np.complex128
 
     for o in tape.observables:
+        if isinstance(o, SparseHamiltonian):
+            csr = _serialize_sparse(o, wires_map, use_csingle)
+            if csr is None:
+                raise ValueError(
+                    "A sparse Hamiltonian must act on all wires of the device, in their order"
+                )
+            obs.append(obs_struct.sparse_hamiltonian(*csr, list(range(len(wires_map)))))
+            continue
+
         is_tensor = isinstance(o, Tensor)
+        factors = o.obs if is_tensor else [o]
 
         wires = []
-
-        if is_tensor:
-            for o_ in o.obs:
-                wires_list = o_.wires.tolist()
-                w = [wires_map[w] for w in wires_list]
-                wires.append(w)
-        else:
-            wires_list = o.wires.tolist()
+        for o_ in factors:
+            wires_list = o_.wires.tolist()
             w = [wires_map[w] for w in wires_list]
             wires.append(w)
 
@@ -77,32 +135,74 @@ def _serialize_obs(tape: QuantumTape, wires_map: dict) -> List:
 
         params = []
 
-        if not _obs_has_kernel(o):
-            if is_tensor:
-                for o_ in o.obs:
-                    if not _obs_has_kernel(o_):
-                        params.append(o_.matrix.ravel().astype(np.complex128))
-                    else:
-                        params.append([])
-            else:
-                params.append(o.matrix.ravel().astype(np.complex128))
+        if any(_obs_as_matrix(o_) for o_ in factors):
+            for o_ in factors:
+                if _obs_as_matrix(o_):
+                    params.append(o_.matrix.ravel().astype(c_dtype))
+                else:
+                    params.append([])
 
-        ob = ObsStructC128(name, params, wires)
+        ob = obs_struct(name, params, wires)
         obs.append(ob)
 
     return obs
 
 
+def _serialize_pauli_sum(
+    observable: Observable, wires_map: dict
+) -> Optional[Tuple[np.ndarray, List[List[str]], List[List[int]]]]:
+    """Serializes a Pauli word, or a Hamiltonian made of Pauli words, as a list of weighted terms.
+
+    Args:
+        observable (Observable): the input observable
+        wires_map (dict): a dictionary mapping input wires to the device's backend wires
+
+    Returns:
+        Tuple[array, list, list] or None: the coefficient, the Pauli factor names and the wires of
+        each term, or ``None`` if the observable is not a linear combination of Pauli words
+    """
+    if isinstance(observable, Hamiltonian):
+        coeffs, terms = observable.coeffs, observable.ops
+    else:
+        coeffs, terms = [1.0], [observable]
+
+    names = []
+    wires = []
+    for term in terms:
+        if not is_pauli_word(term):
+            return None
+        factors = term.obs if isinstance(term, Tensor) else [term]
+        names.append([f.name for f in factors])
+        wires.append([wires_map[f.wires[0]] for f in factors])
+
+    return np.array(coeffs, dtype=np.float64), names, wires
+
+
 def _serialize_ops(
-    tape: QuantumTape, wires_map: dict
+    tape: QuantumTape,
+    wires_map: dict,
+    include_stateprep: bool = False,
+    use_csingle: bool = False,
+    with_matrix_params: bool = False,
 ) -> Tuple[List[List[str]], List[np.ndarray], List[List[int]], List[bool], List[np.ndarray]]:
     """Serializes the operations of an input tape.
 
-    The state preparation operations are not included.
+    The state preparation operations are only included if requested, to be applied natively in
+    C++. ``BasisState`` then takes its bits as parameters and ``QubitStateVector`` its amplitudes
+    as matrix.
+
+    The operations without a dedicated kernel are serialized as matrices, by default without
+    parameters. With ``with_matrix_params``, they keep their scalar parameters, which the adjoint
+    method then counts and can differentiate, and the matrix of the non-inverted operation with
+    its inverse flag.
 
     Args:
         tape (QuantumTape): the input quantum tape
         wires_map (dict): a dictionary mapping input wires to the device's backend wires
+        include_stateprep (bool): whether to serialize the state preparation operations
+        use_csingle (bool): whether to serialize the matrices for the single-precision backend
+        with_matrix_params (bool): whether to serialize the scalar parameters of the operations
+            given as matrices
 
     Returns:
         Tuple[list, list, list, list, list]: A serialization of the operations, containing a list
@@ -116,33 +216,124 @@ def _serialize_ops(
     mats = []
 
     uses_stateprep = False
+    c_dtype = np.complex64 if use_csingle else np.complex128
 
     for o in tape.operations:
         if isinstance(o, (BasisState, QubitStateVector)):
             uses_stateprep = True
+            if include_stateprep:
+                names.append(o.name)
+                state = np.ravel(o.parameters[0])
+                if isinstance(o, BasisState):
+                    params.append(state.astype(np.float64).tolist())
+                    mats.append([])
+                else:
+                    params.append([])
+                    mats.append(state.astype(c_dtype))
+                wires.append([wires_map[w] for w in o.wires.tolist()])
+                inverses.append(False)
             continue
-        elif isinstance(o, Rot):
-            op_list = o.expand().operations
-        else:
-            op_list = [o]
 
-        for single_op in op_list:
-            is_inverse = single_op.inverse
+        is_inverse = o.inverse
 
-            name = single_op.name if not is_inverse else single_op.name[:-4]
-            names.append(name)
+        name = o.name if not is_inverse else o.name[:-4]
+        names.append(name)
 
-            if getattr(StateVectorC128, name, None) is None:
+        if getattr(StateVectorC128, name, None) is None:
+            mat = np.asarray(o.matrix, dtype=c_dtype)
+            if with_matrix_params and o.num_params > 0 and np.ndim(o.parameters) == 1:
+                params.append(o.parameters)
+                mats.append(np.conj(mat).T if is_inverse else mat)
+            else:
                 params.append([])
-                mats.append(single_op.matrix)
+                mats.append(mat)
+                is_inverse = False
+        else:
+            params.append(o.parameters)
+            mats.append([])
 
-                if is_inverse:
-                    is_inverse = False
-            else:
-                params.append(single_op.parameters)
+        wires_list = o.wires.tolist()
+        wires.append([wires_map[w] for w in wires_list])
+        inverses.append(is_inverse)
+    return (names, params, wires, inverses, mats), uses_stateprep
+
+
+def _tape_structure_key(tape: QuantumTape) -> tuple:
+    """Returns a hashable key of the structure of a tape.
+
+    Two tapes with the same key only differ in the parameters of their operations, other than
+    state preparations, and serialize to the same operations and observables up to those
+    parameters.
+
+    Args:
+        tape (QuantumTape): the input quantum tape
+
+    Returns:
+        tuple: the key
+    """
+    ops_key = []
+    for o in tape.operations:
+        if isinstance(o, (BasisState, QubitStateVector)):
+            values = np.asarray(o.parameters[0]).tobytes()
+        else:
+            values = np.ndim(o.parameters) if o.num_params > 0 else None
+        ops_key.append((o.name, tuple(o.wires.tolist()), values))
+
+    obs_key = []
+    for ob in tape.observables:
+        name = tuple(ob.name) if isinstance(ob.name, list) else ob.name
+        if isinstance(ob, SparseHamiltonian):
+            mat = csr_matrix(ob.parameters[0])
+            values = (mat.data.tobytes(), mat.indices.tobytes(), mat.indptr.tobytes())
+        else:
+            values = tuple(np.asarray(p).tobytes() for p in ob.parameters)
+        obs_key.append((name, tuple(ob.wires.tolist()), values))
+
+    return tuple(ops_key), tuple(obs_key)
+
+
+def _serialize_params(
+    tape: QuantumTape,
+    include_stateprep: bool = False,
+    use_csingle: bool = False,
+    with_matrix_params: bool = False,
+) -> Tuple[np.ndarray, List[np.ndarray]]:
+    """Serializes the parameters of the operations of an input tape, for the operations that
+    :func:`_serialize_ops` serialized for a tape of the same structure.
+
+    Args:
+        tape (QuantumTape): the input quantum tape
+        include_stateprep (bool): whether the state preparation operations were serialized
+        use_csingle (bool): whether to serialize the matrices for the single-precision backend
+        with_matrix_params (bool): whether the scalar parameters of the operations given as
+            matrices were serialized
+
+    Returns:
+        Tuple[array, list]: The parameters of the parametric operations, in order, and the matrix
+        of each serialized operation that is given as a matrix, or an empty list for the others.
+    """
+    params = []
+    mats = []
+    c_dtype = np.complex64 if use_csingle else np.complex128
+
+    for o in tape.operations:
+        if isinstance(o, (BasisState, QubitStateVector)):
+            if include_stateprep:
                 mats.append([])
+            continue
 
-            wires_list = single_op.wires.tolist()
-            wires.append([wires_map[w] for w in wires_list])
-            inverses.append(is_inverse)
-    return (names, params, wires, inverses, mats), uses_stateprep
+        is_inverse = o.inverse
+        name = o.name if not is_inverse else o.name[:-4]
+
+        if getattr(StateVectorC128, name, None) is None:
+            mat = np.asarray(o.matrix, dtype=c_dtype)
+            if with_matrix_params and o.num_params > 0 and np.ndim(o.parameters) == 1:
+                params.extend(o.parameters)
+                mats.append(np.conj(mat).T if is_inverse else mat)
+            else:
+                mats.append(mat)
+        else:
+            params.extend(o.parameters)
+            mats.append([])
+
+    return np.array(params, dtype=np.float32 if use_csingle else np.float64), mats
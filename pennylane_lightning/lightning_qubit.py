@@ -29,6 +29,7 @@ from pennylane import (
 import pennylane as qml
 from pennylane.devices import DefaultQubit
 from pennylane.operation import Expectation
+from pennylane.wires import Wires
 
 from ._version import __version__
 
@@ -39,23 +40,73 @@ try:
         os.add_dll_directory(os.path.dirname(os.path.abspath(__file__)))
         from lightning_qubit_ops import (
             apply,
+            GATE_CODES,
+            MATRIX_OP,
+            OpStreamC64,
+            OpStreamC128,
             StateVectorC64,
             StateVectorC128,
+            StateVectorManagedC64,
+            StateVectorManagedC128,
+            AdjointJacobianC64,
             AdjointJacobianC128,
+            BatchedExecutorC64,
+            BatchedExecutorC128,
+            SamplerC64,
+            SamplerC128,
+            expval_pauli_word,
+            var_pauli_word,
+            expval_hamiltonian,
+            var_hamiltonian,
+            expval_sparse_hamiltonian,
+            var_sparse_hamiltonian,
+            expval_matrix,
         )
     else:
         from .lightning_qubit_ops import (
             apply,
+            GATE_CODES,
+            MATRIX_OP,
+            OpStreamC64,
+            OpStreamC128,
             StateVectorC64,
             StateVectorC128,
+            StateVectorManagedC64,
+            StateVectorManagedC128,
+            AdjointJacobianC64,
             AdjointJacobianC128,
+            BatchedExecutorC64,
+            BatchedExecutorC128,
+            SamplerC64,
+            SamplerC128,
+            expval_pauli_word,
+            var_pauli_word,
+            expval_hamiltonian,
+            var_hamiltonian,
+            expval_sparse_hamiltonian,
+            var_sparse_hamiltonian,
+            expval_matrix,
         )
-    from ._serialize import _serialize_obs, _serialize_ops
+    from ._serialize import (
+        _serialize_obs,
+        _serialize_ops,
+        _serialize_params,
+        _serialize_pauli_sum,
+        _serialize_sparse,
+        _tape_structure_key,
+    )
 
     CPP_BINARY_AVAILABLE = True
 except ModuleNotFoundError:
     CPP_BINARY_AVAILABLE = False
 
+# Tolerance on the norm of the state vectors given to QubitStateVector
+STATE_NORM_TOLERANCE = 1e-10
+
+# Number of operations packed into each stream submitted to C++. The next chunk is packed while
+# the previous one is applied on a worker thread.
+OP_STREAM_CHUNK_SIZE = 512
+
 UNSUPPORTED_PARAM_GATES_ADJOINT = (
     "MultiRZ",
     "IsingXX",
@@ -85,6 +136,31 @@ class LightningQubit(DefaultQubit):
             the expectation values. Defaults to ``None`` if not specified. Setting
             to ``None`` results in computing statistics like expectation values and
             variances analytically.
+        fusion_width (int): maximum number of wires of a fused gate. When non-zero, runs of
+            consecutive supported gates acting on at most this many wires are merged into a single
+            matrix in C++, reducing the number of passes over the state. Defaults to ``0``
+            (no fusion). Consecutive diagonal gates are merged regardless.
+        cache_block_qubits (int): number of low-order qubits of the cache blocks. When non-zero,
+            gates are grouped and applied one block of ``2**cache_block_qubits`` amplitudes at a
+            time, with higher-order qubits exchanged into the blocks as needed. This replaces
+            ``fusion_width`` and pays off for states much larger than the last-level cache.
+            Defaults to ``0`` (no cache blocking).
+        reorder_qubits (int): number of wires used most by the gates of a circuit that are moved to
+            the lowest-order qubits of the state while the gates are applied, so that their
+            kernels access nearby amplitudes, and moved back afterwards. Ignored with
+            ``cache_block_qubits``. Defaults to ``0`` (no reordering).
+        adjoint_memory_budget (int): memory budget in bytes for the observable-applied states of
+            the adjoint method. Observables are then differentiated in chunks, each with its own
+            backward pass. Defaults to ``None``, which differentiates all observables together.
+            With ``adjoint_checkpointing``, the budget bounds the number of segments instead.
+        adjoint_checkpointing (bool): whether to split the backward pass of the adjoint method into
+            segments run in parallel, each starting from checkpoints of the states taken in a
+            first sweep. This uses all cores also for a single observable, at the cost of up to
+            ``observables + 2`` statevectors per segment. Defaults to ``False``.
+        c_dtype (type): complex datatype of the statevector, ``np.complex128`` (default) or
+            ``np.complex64``. In single precision, execution, measurements and the adjoint method
+            all run on ``complex64`` amplitudes, halving the memory of the states, while the sums
+            over amplitudes are still accumulated in double precision.
     """
 
     name = "Lightning Qubit PennyLane plugin"
@@ -94,8 +170,59 @@ class LightningQubit(DefaultQubit):
     author = "Xanadu Inc."
     _CPP_BINARY_AVAILABLE = True
 
-    def __init__(self, wires, *, shots=None):
-        super().__init__(wires, shots=shots)
+    def __init__(
+        self,
+        wires,
+        *,
+        shots=None,
+        fusion_width=0,
+        cache_block_qubits=0,
+        reorder_qubits=0,
+        adjoint_memory_budget=None,
+        adjoint_checkpointing=False,
+        c_dtype=np.complex128,
+    ):
+        if c_dtype is np.complex64:
+            r_dtype = np.float32
+            self.use_csingle = True
+        elif c_dtype is np.complex128:
+            r_dtype = np.float64
+            self.use_csingle = False
+        else:
+            raise TypeError(f"Unsupported complex type: {c_dtype}")
+        super().__init__(wires, shots=shots, r_dtype=r_dtype, c_dtype=c_dtype)
+        self._fusion_width = fusion_width
+        self._cache_block_qubits = cache_block_qubits
+        self._reorder_qubits = reorder_qubits
+        self._adjoint_memory_budget = adjoint_memory_budget
+        self._adjoint_checkpointing = adjoint_checkpointing
+        self._adjoint_generators = {}
+        self._circuit_plans = {}
+
+        # C++ classes of the device precision
+        if self.use_csingle:
+            self._state_vector_cls = StateVectorC64
+            self._adjoint_cls = AdjointJacobianC64
+            self._batched_cls = BatchedExecutorC64
+            self._sampler_cls = SamplerC64
+            self._op_stream_cls = OpStreamC64
+            self._managed_cls = StateVectorManagedC64
+        else:
+            self._state_vector_cls = StateVectorC128
+            self._adjoint_cls = AdjointJacobianC128
+            self._batched_cls = BatchedExecutorC128
+            self._sampler_cls = SamplerC128
+            self._op_stream_cls = OpStreamC128
+            self._managed_cls = StateVectorManagedC128
+
+        # The statevector is owned by C++ and kept across executions. The device state is a
+        # zero-copy view of it, and the pre-rotated state is saved in its snapshot buffer.
+        self._sim = self._managed_cls(self.num_wires)
+        self._sim.setCacheBlockQubits(self._cache_block_qubits)
+        self._sim.setReorderQubits(self._reorder_qubits)
+        self._sim_state = np.reshape(np.asarray(self._sim), [2] * self.num_wires)
+        self._state = self._sim_state
+        self._pre_rotated_state = self._state
 
     @classmethod
     def capabilities(cls):
@@ -110,9 +237,64 @@ class LightningQubit(DefaultQubit):
         capabilities.pop("passthru_devices", None)
         return capabilities
 
+    def reset(self):
+        """Reset the device statevector to the all-zero basis state in place."""
+        # Skips the allocation of a new state by ``DefaultQubit.reset``
+        super(DefaultQubit, self).reset()
+        self._sim.resetState()
+        self._state = self._sim_state
+        self._pre_rotated_state = self._state
+
+    @property
+    def state(self):
+        """Copy of the pre-rotated device state, which later executions overwrite in place."""
+        return np.copy(np.ravel(self._pre_rotated_state))
+
+    def _ravel_ket(self, state):
+        """Flatten a state into an array of the device precision, without copying it when it
+        already has that precision. The C++ statevectors hold a pointer to this array."""
+        return np.ravel(state).astype(self.C_DTYPE, copy=False)
+
+    def _apply_state_vector(self, state, device_wires):
+        """Initialize the device state with a state vector of the given wires, the other wires
+        being in the zero state. The amplitudes are scattered in C++.
+
+        Args:
+            state (array[complex]): normalized input state of length ``2**len(device_wires)``
+            device_wires (Wires): wires that get initialized in the state
+        """
+        device_wires = self.map_wires(device_wires)
+        state = np.ravel(np.asarray(state, dtype=np.complex128))
+
+        if len(state) != 2 ** len(device_wires):
+            raise ValueError("State vector must be of length 2**wires.")
+        if not np.allclose(np.linalg.norm(state, ord=2), 1.0, atol=STATE_NORM_TOLERANCE):
+            raise ValueError("Sum of amplitudes-squared does not equal one.")
+
+        self._sim.setStateVector(state.astype(self.C_DTYPE), device_wires.tolist())
+        self._state = self._sim_state
+
+    def _apply_basis_state(self, state, wires):
+        """Initialize the device state in a computational basis state, set in C++.
+
+        Args:
+            state (array[int]): bits of the basis state on the given wires
+            wires (Wires): wires that the provided computational state should be initialized on
+        """
+        device_wires = self.map_wires(wires)
+        state = np.ravel(np.asarray(state))
+
+        if not set(state.tolist()).issubset({0, 1}):
+            raise ValueError("BasisState parameter must consist of 0 or 1 integers.")
+        if len(state) != len(device_wires):
+            raise ValueError("BasisState parameter and wires must be of equal length.")
+
+        self._sim.setBasisState(state.astype(int).tolist(), device_wires.tolist())
+        self._state = self._sim_state
+
     def apply(self, operations, rotations=None, **kwargs):
 
-        # State preparation is currently done in Python
+        # State preparations are applied in place to the C++ statevector
         if operations:  # make sure operations[0] exists
             if isinstance(operations[0], QubitStateVector):
                 self._apply_state_vector(operations[0].parameters[0].copy(), operations[0].wires)
@@ -128,18 +310,23 @@ class LightningQubit(DefaultQubit):
                     "applied on a {} device.".format(operation.name, self.short_name)
                 )
 
+        # States set in Python are copied into the C++ statevector once
+        if self._state is not self._sim_state:
+            self._sim.updateData(np.ravel(self._state).astype(self.C_DTYPE, copy=False))
+            self._state = self._sim_state
+
         if operations:
-            self._pre_rotated_state = self.apply_lightning(self._state, operations)
-        else:
-            self._pre_rotated_state = self._state
+            self._apply_lightning_ops(self._sim, operations)
+        self._pre_rotated_state = self._state
 
         if rotations:
             if any(isinstance(r, QubitUnitary) for r in rotations):
                 super().apply(operations=[], rotations=rotations)
             else:
-                self._state = self.apply_lightning(np.copy(self._pre_rotated_state), rotations)
-        else:
-            self._state = self._pre_rotated_state
+                self._sim.saveSnapshot()
+                snapshot = self._sim.getSnapshot()
+                self._pre_rotated_state = np.reshape(snapshot, [2] * self.num_wires)
+                self._apply_lightning_ops(self._sim, rotations)
 
     def apply_lightning(self, state, operations):
         """Apply a list of operations to the state tensor.
@@ -151,86 +338,262 @@ class LightningQubit(DefaultQubit):
         Returns:
             array[complex]: the output state tensor
         """
-        assert state.dtype == np.complex128
+        assert state.dtype == self.C_DTYPE
         state_vector = np.ravel(state)
-        sim = StateVectorC128(state_vector)
+        sim = self._state_vector_cls(state_vector)
+        sim.setCacheBlockQubits(self._cache_block_qubits)
+        sim.setReorderQubits(self._reorder_qubits)
+        self._apply_lightning_ops(sim, operations)
+
+        return np.reshape(state_vector, state.shape)
+
+    def _pack_op_stream(self, operations):
+        """Pack operations into a C++ operation stream of the device precision.
+
+        Supported gates are given by their code, the others by their matrix, which is already in
+        inverted form.
+
+        Args:
+            operations (list[~pennylane.operation.Operation]): operations to pack
+
+        Returns:
+            OpStreamC128 or OpStreamC64: the packed operations
+        """
+        codes, inverses, wires, params, mats = [], [], [], [], []
 
         for o in operations:
             name = o.name.split(".")[0]  # The split is because inverse gates have .inv appended
-            method = getattr(sim, name, None)
+            code = GATE_CODES.get(name)
 
-            wires = self.wires.indices(o.wires)
-
-            if method is None:
-                # Inverse can be set to False since o.matrix is already in inverted form
-                sim.applyMatrix(o.matrix, wires, False)
+            if code is None:
+                codes.append(MATRIX_OP)
+                inverses.append(False)
+                mats.append(np.ravel(o.matrix).astype(self.C_DTYPE, copy=False))
             else:
-                inv = o.inverse
-                param = o.parameters
-                method(wires, inv, param)
+                codes.append(code)
+                inverses.append(o.inverse)
+                params.extend(o.parameters)
+            wires.extend(self.wires.indices(o.wires))
+
+        return self._op_stream_cls(
+            np.array(codes, dtype=np.uint8),
+            inverses,
+            np.array(wires, dtype=np.uintp),
+            np.array(params, dtype=self.R_DTYPE),
+            mats,
+        )
 
-        return np.reshape(state_vector, state.shape)
+    def _apply_lightning_ops(self, sim, operations):
+        """Apply a list of operations in place to a C++ statevector.
 
-    def adjoint_jacobian(self, tape, starting_state=None, use_device_state=False):
-        if self.shots is not None:
-            warn(
-                "Requested adjoint differentiation to be computed with finite shots."
-                " The derivative is always exact when using the adjoint differentiation method.",
-                UserWarning,
+        The operations are submitted in packed chunks, each applied by the long-lived C++ worker
+        thread of the statevector with the GIL released while the next chunk is packed. Within a
+        chunk, runs of supported gates are fused, and consecutive diagonal gates always merged.
+
+        Args:
+            sim (StateVectorC128 or StateVectorC64): statevector to update, of the device
+                precision
+            operations (list[~pennylane.operation.Operation]): operations to apply
+        """
+        pending = None
+        try:
+            for start in range(0, len(operations), OP_STREAM_CHUNK_SIZE):
+                stream = self._pack_op_stream(operations[start : start + OP_STREAM_CHUNK_SIZE])
+                if pending is not None:
+                    pending.wait()
+                pending = sim.apply_async(stream, self._fusion_width)
+        finally:
+            if pending is not None:
+                pending.wait()
+
+    def analytic_probability(self, wires=None):
+        """Return the marginal probabilities of the computational basis states of the given
+        wires, computed in C++ directly from the statevector.
+
+        Args:
+            wires (Iterable[Number, str], Number, str, Wires): wires to compute the probabilities
+                of. All device wires are used if not provided.
+
+        Returns:
+            array[float]: probabilities of the basis states, ordered lexicographically with the
+            first wire as the most significant bit
+        """
+        if self._state is None:
+            return None
+
+        device_wires = self.map_wires(Wires(wires if wires is not None else self.wires))
+        ket = self._ravel_ket(self._state)
+        return self._state_vector_cls(ket).probs(device_wires.tolist())
+
+    def generate_samples(self):
+        """Generate computational basis samples in C++.
+
+        The samples are drawn from an alias table of the rotated state distribution, seeded from
+        NumPy's global random number generator.
+
+        Returns:
+            array[int]: samples with shape ``(shots, num_wires)``, one bit per wire
+        """
+        sampler = self._sampler_cls(self._state_vector_cls(self._ravel_ket(self._state)))
+        seed = np.random.randint(2 ** 31)
+        samples = sampler.sample(self.shots, seed).astype(np.int64)
+        return self.states_to_binary(samples, self.num_wires)
+
+    def expval(self, observable, shot_range=None, bin_size=None):
+        """Expectation value of an observable.
+
+        Pauli words, Hamiltonians of Pauli words, Hermitian matrices and sparse Hamiltonians over
+        all wires are evaluated in C++ from the unrotated state when the device is analytic. All
+        other cases use the ``default.qubit`` implementation.
+        """
+        if self.shots is None:
+            ket = self._ravel_ket(self._pre_rotated_state)
+            if isinstance(observable, qml.SparseHamiltonian):
+                csr = _serialize_sparse(observable, self.wire_map, self.use_csingle)
+                if csr is not None:
+                    return expval_sparse_hamiltonian(self._state_vector_cls(ket), *csr)
+            elif isinstance(observable, qml.Hermitian):
+                c_dtype = np.complex64 if self.use_csingle else np.complex128
+                wires = [self.wire_map[w] for w in observable.wires.tolist()]
+                matrix = np.ravel(observable.matrix).astype(c_dtype)
+                return expval_matrix(self._state_vector_cls(ket), matrix, wires)
+
+            pauli_sum = _serialize_pauli_sum(observable, self.wire_map)
+            if pauli_sum is not None:
+                if isinstance(observable, qml.Hamiltonian):
+                    return expval_hamiltonian(self._state_vector_cls(ket), *pauli_sum)
+                _, names, wires = pauli_sum
+                return expval_pauli_word(self._state_vector_cls(ket), names[0], wires[0])
+
+        return super().expval(observable, shot_range=shot_range, bin_size=bin_size)
+
+    def var(self, observable, shot_range=None, bin_size=None):
+        """Variance of an observable.
+
+        Pauli words, Hamiltonians of Pauli words and sparse Hamiltonians over all wires are
+        evaluated in C++ from the unrotated state when the device is analytic. All other cases use
+        the ``default.qubit`` implementation.
+        """
+        if self.shots is None:
+            ket = self._ravel_ket(self._pre_rotated_state)
+            if isinstance(observable, qml.SparseHamiltonian):
+                csr = _serialize_sparse(observable, self.wire_map, self.use_csingle)
+                if csr is not None:
+                    return var_sparse_hamiltonian(self._state_vector_cls(ket), *csr)
+
+            pauli_sum = _serialize_pauli_sum(observable, self.wire_map)
+            if pauli_sum is not None:
+                if isinstance(observable, qml.Hamiltonian):
+                    return var_hamiltonian(self._state_vector_cls(ket), *pauli_sum)
+                _, names, wires = pauli_sum
+                return var_pauli_word(self._state_vector_cls(ket), names[0], wires[0])
+
+        return super().var(observable, shot_range=shot_range, bin_size=bin_size)
+
+    def register_adjoint_generator(self, name, generator, scaling_factor):
+        """Registers the generator of a single-parameter operation, so that the adjoint method
+        differentiates it natively.
+
+        The operation :math:`U(\\theta) = e^{i s \\theta G}` is given by its name and is applied
+        with its matrix when the device has no kernel for it.
+
+        Args:
+            name (str): name of the operation
+            generator (array[complex]): Hermitian matrix :math:`G` over the operation wires
+            scaling_factor (float): coefficient :math:`s` of the generator
+        """
+        generator = np.asarray(generator, dtype=self.C_DTYPE)
+        self._adjoint_generators[name] = (np.ravel(generator), scaling_factor)
+
+    def _get_circuit_plan(self, tape, with_matrix_params=False):
+        """Returns the serialized observables and C++ operations of a tape, including its state
+        preparations.
+
+        The last plan of each kind is cached. For a tape with the same structure, only the
+        parameters of its operations are serialized again and updated in place in the C++
+        operations, whose gates and wires stay resolved.
+
+        Args:
+            tape (QuantumTape): the input quantum tape
+            with_matrix_params (bool): whether to serialize the scalar parameters of the
+                operations given as matrices
+
+        Returns:
+            tuple: the serialized observables, the C++ operations and whether the tape uses state
+            preparations
+        """
+        key = _tape_structure_key(tape)
+        cached = self._circuit_plans.get(with_matrix_params)
+        if cached is not None and cached[0] == key:
+            plan = cached[1]
+            params, mats = _serialize_params(
+                tape,
+                include_stateprep=True,
+                use_csingle=self.use_csingle,
+                with_matrix_params=with_matrix_params,
             )
+            plan[1].update_params(params, mats)
+            return plan
+
+        obs_serialized = _serialize_obs(tape, self.wire_map, use_csingle=self.use_csingle)
+        ops_serialized, use_sp = _serialize_ops(
+            tape,
+            self.wire_map,
+            include_stateprep=True,
+            use_csingle=self.use_csingle,
+            with_matrix_params=with_matrix_params,
+        )
+        plan = (obs_serialized, self._adjoint_cls().create_ops_list(*ops_serialized), use_sp)
+        self._circuit_plans[with_matrix_params] = (key, plan)
+        return plan
 
-        if len(tape.trainable_params) == 0:
-            return np.array(0)
+    def _init_adjoint(self, tape, starting_state, use_device_state):
+        """Checks that the adjoint method supports a tape, and serializes it.
+
+        Args:
+            tape (QuantumTape): the tape to differentiate
+            starting_state (array[complex]): state to start from, or ``None``
+            use_device_state (bool): whether to start from the device state
 
+        Returns:
+            tuple: the C++ adjoint class instance, the starting statevector, the serialized
+            observables and operations, the trainable parameter indices of the operations and
+            whether the operations are applied in C++
+        """
         for m in tape.measurements:
             if m.return_type is not Expectation:
                 raise QuantumFunctionError(
                     "Adjoint differentiation method does not support"
                     f" measurement {m.return_type.value}"
                 )
-            if not isinstance(m.obs, qml.operation.Tensor):
-                if isinstance(m.obs, qml.Projector):
-                    raise QuantumFunctionError(
-                        "Adjoint differentiation method does not support the Projector observable"
-                    )
-                if isinstance(m.obs, qml.Hermitian):
-                    raise QuantumFunctionError(
-                        "Lightning adjoint differentiation method does not currently support the Hermitian observable"
-                    )
-            else:
-                if any([isinstance(o, qml.Projector) for o in m.obs.non_identity_obs]):
-                    raise QuantumFunctionError(
-                        "Adjoint differentiation method does not support the Projector observable"
-                    )
-                if any([isinstance(o, qml.Hermitian) for o in m.obs.non_identity_obs]):
-                    raise QuantumFunctionError(
-                        "Lightning adjoint differentiation method does not currently support the Hermitian observable"
-                    )
+
+        adj = self._adjoint_cls()
+        for name, (generator, scaling_factor) in self._adjoint_generators.items():
+            adj.register_generator(name, generator, scaling_factor)
 
         for op in tape.operations:
+            name = op.name[:-4] if op.inverse else op.name
             if (
-                op.num_params > 1 and not isinstance(op, qml.Rot)
-            ) or op.name in UNSUPPORTED_PARAM_GATES_ADJOINT:
+                op.num_params > 1 or name in UNSUPPORTED_PARAM_GATES_ADJOINT
+            ) and not adj.has_generator(name):
                 raise QuantumFunctionError(
                     f"The {op.name} operation is not supported using "
                     'the "adjoint" differentiation method'
                 )
 
-        # Initialization of state
+        # Initialization of state. Without a given state, the operations, including the state
+        # preparations, are applied in C++ to a fresh zero state, leaving the device state as is.
+        apply_operations = starting_state is None and not use_device_state
         if starting_state is not None:
-            ket = np.ravel(starting_state)
+            ket = self._state_vector_cls(self._ravel_ket(starting_state))
+        elif use_device_state:
+            ket = self._state_vector_cls(self._ravel_ket(self._pre_rotated_state))
         else:
-            if not use_device_state:
-                self.reset()
-                self.execute(tape)
-            ket = np.ravel(self._pre_rotated_state)
+            ket = self._managed_cls(self.num_wires)
 
-        adj = AdjointJacobianC128()
-
-        obs_serialized = _serialize_obs(tape, self.wire_map)
-        ops_serialized, use_sp = _serialize_ops(tape, self.wire_map)
-
-        ops_serialized = adj.create_ops_list(*ops_serialized)
+        obs_serialized, ops_serialized, use_sp = self._get_circuit_plan(
+            tape, with_matrix_params=True
+        )
 
         trainable_params = sorted(tape.trainable_params)
         first_elem = 1 if trainable_params[0] == 0 else 0
@@ -239,15 +602,136 @@ class LightningQubit(DefaultQubit):
             trainable_params if not use_sp else [i - 1 for i in trainable_params[first_elem:]]
         )  # exclude first index if explicitly setting sv
 
+        return adj, ket, obs_serialized, ops_serialized, tp_shift, apply_operations
+
+    def adjoint_jacobian(self, tape, starting_state=None, use_device_state=False):
+        if self.shots is not None:
+            warn(
+                "Requested adjoint differentiation to be computed with finite shots."
+                " The derivative is always exact when using the adjoint differentiation method.",
+                UserWarning,
+            )
+
+        if len(tape.trainable_params) == 0:
+            return np.array(0)
+
+        adj, ket, obs_serialized, ops_serialized, tp_shift, apply_operations = self._init_adjoint(
+            tape, starting_state, use_device_state
+        )
+
+        if self._adjoint_checkpointing:
+            # Without a budget, there is one segment per thread
+            num_segments = 0
+            if self._adjoint_memory_budget is not None:
+                num_segments = self._adjoint_cls.get_max_checkpoint_segments(
+                    self.num_wires, len(obs_serialized), int(self._adjoint_memory_budget)
+                )
+            return adj.adjoint_jacobian_checkpointed(
+                ket,
+                obs_serialized,
+                ops_serialized,
+                tp_shift,
+                tape.num_params,
+                num_segments,
+                apply_operations,
+            )
+
+        max_obs_states = 0
+        if self._adjoint_memory_budget is not None:
+            max_obs_states = self._adjoint_cls.get_max_obs_states(
+                self.num_wires, int(self._adjoint_memory_budget)
+            )
+
         jac = adj.adjoint_jacobian(
-            StateVectorC128(ket),
+            ket,
             obs_serialized,
             ops_serialized,
             tp_shift,
             tape.num_params,
+            max_obs_states,
+            apply_operations,
         )
         return jac
 
+    def adjoint_vjp(self, tape, dy, starting_state=None, use_device_state=False):
+        """Computes the vector-Jacobian product of a cotangent with the Jacobian of
+        :meth:`adjoint_jacobian`.
+
+        The observables weighted by the cotangent are applied to a single state, so that the
+        product takes one backward pass whatever the number of observables.
+
+        Args:
+            tape (QuantumTape): circuit whose measurements are all expectation values
+            dy (array[float]): cotangent, with one entry per measurement of the tape
+            starting_state (array[complex]): state to start from, or ``None``
+            use_device_state (bool): whether to start from the device state
+
+        Returns:
+            array[float]: the product, with one entry per trainable parameter
+        """
+        if self.shots is not None:
+            warn(
+                "Requested adjoint differentiation to be computed with finite shots."
+                " The derivative is always exact when using the adjoint differentiation method.",
+                UserWarning,
+            )
+
+        if len(tape.trainable_params) == 0:
+            return np.array(0)
+
+        adj, ket, obs_serialized, ops_serialized, tp_shift, apply_operations = self._init_adjoint(
+            tape, starting_state, use_device_state
+        )
+        dy = np.ravel(np.asarray(dy, dtype=self.R_DTYPE))
+        if len(dy) != len(obs_serialized):
+            raise ValueError(
+                f"The cotangent has {len(dy)} entries for {len(obs_serialized)} measurements"
+            )
+
+        return adj.adjoint_vjp(
+            ket,
+            dy,
+            obs_serialized,
+            ops_serialized,
+            tp_shift,
+            tape.num_params,
+            apply_operations,
+        )
+
+    def batch_expval(self, tape, parameters):
+        """Evaluate the expectation values of a tape for a batch of gate parameters.
+
+        The operations of the tape are serialized once, and every parameter set is executed in
+        C++, in parallel over the batch.
+
+        Args:
+            tape (QuantumTape): circuit whose measurements are all expectation values
+            parameters (array[float]): 2D array with one row per circuit evaluation. Each row
+                holds the parameters of the natively supported operations of the tape, in order
+                and excluding state preparations. Operations applied as matrices keep the
+                parameters of the tape.
+
+        Returns:
+            array[float]: expectation values of shape ``(len(parameters), len(tape.observables))``
+        """
+        for m in tape.measurements:
+            if m.return_type is not Expectation:
+                raise QuantumFunctionError(
+                    f"Batched execution does not support measurement {m.return_type.value}"
+                )
+
+        obs_serialized, ops_serialized, _ = self._get_circuit_plan(tape)
+
+        # Every batch member starts from a fresh zero state, state preparations being applied in
+        # C++, leaving the device state as is
+        executor = self._batched_cls()
+        return executor.execute_expval(
+            self._managed_cls(self.num_wires),
+            obs_serialized,
+            ops_serialized,
+            np.asarray(parameters, dtype=self.R_DTYPE),
+        )
+
 
 if not CPP_BINARY_AVAILABLE:
 
@@ -261,6 +745,12 @@ if not CPP_BINARY_AVAILABLE:
         _CPP_BINARY_AVAILABLE = False
 
         def __init__(self, *args, **kwargs):
+            kwargs.pop("fusion_width", None)
+            kwargs.pop("cache_block_qubits", None)
+            kwargs.pop("reorder_qubits", None)
+            kwargs.pop("adjoint_memory_budget", None)
+            kwargs.pop("adjoint_checkpointing", None)
+            kwargs.pop("c_dtype", None)
             warn(
                 "Pre-compiled binaries for lightning.qubit are not available. Falling back to "
                 "using the Python-based default.qubit implementation. To manually compile from "
@@ -13,8 +13,14 @@
 // limitations under the License.
 #pragma once
 
+#include <algorithm>
 #include <complex>
 #include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
 #include <numeric>
 #include <stdexcept>
 #include <type_traits>
@@ -23,7 +29,10 @@
 #include <variant>
 #include <vector>
 
+#include "Dispatcher.hpp"
 #include "Error.hpp"
+#include "Instrumentation.hpp"
+#include "Observables.hpp"
 #include "StateVector.hpp"
 #include "StateVectorManaged.hpp"
 #include "Util.hpp"
@@ -66,71 +75,48 @@ void applyGeneratorRZ(SVType &sv, const std::vector<size_t> &wires,
 
 template <class T = double, class SVType = Pennylane::StateVector<T>>
 void applyGeneratorPhaseShift(SVType &sv, const std::vector<size_t> &wires,
-                              const bool adj = false) {
-    sv.applyOperation(getP11<T>(), wires, adj);
+                              [[maybe_unused]] const bool adj = false) {
+    sv.projectOntoControls(wires);
 }
 
 template <class T = double, class SVType = Pennylane::StateVector<T>>
 void applyGeneratorCRX(SVType &sv, const std::vector<size_t> &wires,
                        [[maybe_unused]] const bool adj = false) {
-    const vector<size_t> internalIndices = sv.generateBitPatterns(wires);
-    const vector<size_t> externalWires = sv.getIndicesAfterExclusion(wires);
-    const vector<size_t> externalIndices =
-        sv.generateBitPatterns(externalWires);
-    for (const size_t &externalIndex : externalIndices) {
-        std::complex<T> *shiftedState = sv.getData() + externalIndex;
-        shiftedState[internalIndices[0]] = shiftedState[internalIndices[1]] = 0;
-        std::swap(shiftedState[internalIndices[2]],
-                  shiftedState[internalIndices[3]]);
-    }
+    std::complex<T> *arr = sv.getData();
+    sv.projectOntoControls({wires[0]});
+    sv.applyControlledKernel1Q(
+        {wires[0]}, wires[1],
+        [&](size_t i0, size_t i1) { std::swap(arr[i0], arr[i1]); });
 }
 
 template <class T = double, class SVType = Pennylane::StateVector<T>>
 void applyGeneratorCRY(SVType &sv, const std::vector<size_t> &wires,
                        [[maybe_unused]] const bool adj = false) {
-    const vector<size_t> internalIndices = sv.generateBitPatterns(wires);
-    const vector<size_t> externalWires = sv.getIndicesAfterExclusion(wires);
-    const vector<size_t> externalIndices =
-        sv.generateBitPatterns(externalWires);
-    for (const size_t &externalIndex : externalIndices) {
-        std::complex<T> *shiftedState = sv.getData() + externalIndex;
-        std::complex<T> v0 = shiftedState[internalIndices[2]];
-        shiftedState[internalIndices[0]] = ZERO<T>();
-        shiftedState[internalIndices[1]] = ZERO<T>();
-        shiftedState[internalIndices[2]] =
-            -IMAG<T>() * shiftedState[internalIndices[3]];
-        shiftedState[internalIndices[3]] = IMAG<T>() * v0;
-    }
+    std::complex<T> *arr = sv.getData();
+    sv.projectOntoControls({wires[0]});
+    sv.applyControlledKernel1Q({wires[0]}, wires[1],
+                               [&](size_t i0, size_t i1) {
+                                   const std::complex<T> v0 = arr[i0];
+                                   arr[i0] = -IMAG<T>() * arr[i1];
+                                   arr[i1] = IMAG<T>() * v0;
+                               });
 }
 
 template <class T = double, class SVType = Pennylane::StateVector<T>>
 void applyGeneratorCRZ(SVType &sv, const std::vector<size_t> &wires,
                        [[maybe_unused]] const bool adj = false) {
-    const vector<size_t> internalIndices = sv.generateBitPatterns(wires);
-    const vector<size_t> externalWires = sv.getIndicesAfterExclusion(wires);
-    const vector<size_t> externalIndices =
-        sv.generateBitPatterns(externalWires);
-    for (const size_t &externalIndex : externalIndices) {
-        std::complex<T> *shiftedState = sv.getData() + externalIndex;
-        shiftedState[internalIndices[0]] = shiftedState[internalIndices[1]] = 0;
-        shiftedState[internalIndices[3]] *= -1;
-    }
+    std::complex<T> *arr = sv.getData();
+    sv.projectOntoControls({wires[0]});
+    sv.applyControlledKernel1Q(
+        {wires[0]}, wires[1],
+        [&]([[maybe_unused]] size_t i0, size_t i1) { arr[i1] *= -1; });
 }
 
 template <class T = double, class SVType = Pennylane::StateVector<T>>
 void applyGeneratorControlledPhaseShift(
     SVType &sv, const std::vector<size_t> &wires,
     [[maybe_unused]] const bool adj = false) {
-    const vector<size_t> internalIndices = sv.generateBitPatterns(wires);
-    const vector<size_t> externalWires = sv.getIndicesAfterExclusion(wires);
-    const vector<size_t> externalIndices =
-        sv.generateBitPatterns(externalWires);
-    for (const size_t &externalIndex : externalIndices) {
-        std::complex<T> *shiftedState = sv.getData() + externalIndex;
-        shiftedState[internalIndices[0]] = 0;
-        shiftedState[internalIndices[1]] = 0;
-        shiftedState[internalIndices[2]] = 0;
-    }
+    sv.projectOntoControls(wires);
 }
 
 } // namespace
@@ -146,10 +132,13 @@ namespace Pennylane::Algorithms {
 template <class T = double> class ObsDatum {
   public:
     /**
-     * @brief Variant type of stored parameter data.
+     * @brief Variant type of stored parameter data. A sparse Hamiltonian is
+     * shared rather than copied between the observables chunks.
      */
-    using param_var_t = std::variant<std::monostate, std::vector<T>,
-                                     std::vector<std::complex<T>>>;
+    using param_var_t =
+        std::variant<std::monostate, std::vector<T>,
+                     std::vector<std::complex<T>>,
+                     std::shared_ptr<const SparseHamiltonian<T>>>;
 
     /**
      * @brief Copy constructor for an ObsDatum object, representing a given
@@ -212,16 +201,46 @@ template <class T = double> class ObsDatum {
  * @brief Utility class for encapsulating operations used by AdjointJacobian
  * class.
  *
+ * The state preparations `BasisState` and `QubitStateVector` may be included.
+ * The former takes the bits of its wires as parameters and the latter its
+ * amplitudes as matrix. Neither counts as a parametric operation.
  */
 template <class T> class OpsData {
   private:
+    /**
+     * @brief Extend the matrices with empty entries up to one per operation.
+     */
+    static auto padMatrices_(std::vector<std::vector<std::complex<T>>> matrices,
+                             size_t num_ops)
+        -> std::vector<std::vector<std::complex<T>>> {
+        if (matrices.size() < num_ops) {
+            matrices.resize(num_ops);
+        }
+        return matrices;
+    }
+
+    /**
+     * @brief Resolve the gate operation of every operation name, or
+     * `GateOperation::NumGates` for the names without a kernel.
+     */
+    static auto resolveGates_(const std::vector<std::string> &ops_name)
+        -> std::vector<GateOperation> {
+        std::vector<GateOperation> ops_gates(ops_name.size());
+        for (size_t op = 0; op < ops_name.size(); op++) {
+            ops_gates[op] = Util::findGateOperation(ops_name[op]);
+        }
+        return ops_gates;
+    }
+
     size_t num_par_ops_;
+    size_t num_params_;
     size_t num_nonpar_ops_;
     const std::vector<std::string> ops_name_;
-    const std::vector<std::vector<T>> ops_params_;
+    const std::vector<GateOperation> ops_gates_;
+    std::vector<std::vector<T>> ops_params_;
     const std::vector<std::vector<size_t>> ops_wires_;
     const std::vector<bool> ops_inverses_;
-    const std::vector<std::vector<std::complex<T>>> ops_matrices_;
+    std::vector<std::vector<std::complex<T>>> ops_matrices_;
 
   public:
     /**
@@ -241,14 +260,17 @@ template <class T> class OpsData {
             std::vector<std::vector<size_t>> ops_wires,
             std::vector<bool> ops_inverses,
             std::vector<std::vector<std::complex<T>>> ops_matrices)
-        : ops_name_{std::move(ops_name)}, ops_params_{ops_params},
-          ops_wires_{std::move(ops_wires)},
-          ops_inverses_{std::move(ops_inverses)}, ops_matrices_{
-                                                      std::move(ops_matrices)} {
+        : ops_name_{std::move(ops_name)}, ops_gates_{resolveGates_(ops_name_)},
+          ops_params_{ops_params}, ops_wires_{std::move(ops_wires)},
+          ops_inverses_{std::move(ops_inverses)},
+          ops_matrices_{
+              padMatrices_(std::move(ops_matrices), ops_name_.size())} {
         num_par_ops_ = 0;
-        for (const auto &p : ops_params) {
-            if (!p.empty()) {
+        num_params_ = 0;
+        for (size_t op = 0; op < ops_params_.size(); op++) {
+            if (hasParams(op)) {
                 num_par_ops_++;
+                num_params_ += ops_params_[op].size();
             }
         }
         num_nonpar_ops_ = ops_params.size() - num_par_ops_;
@@ -268,14 +290,16 @@ template <class T> class OpsData {
             const std::vector<std::vector<T>> &ops_params,
             std::vector<std::vector<size_t>> ops_wires,
             std::vector<bool> ops_inverses)
-        : ops_name_{ops_name}, ops_params_{ops_params},
-          ops_wires_{std::move(ops_wires)}, ops_inverses_{std::move(
-                                                ops_inverses)},
+        : ops_name_{ops_name}, ops_gates_{resolveGates_(ops_name_)},
+          ops_params_{ops_params}, ops_wires_{std::move(ops_wires)},
+          ops_inverses_{std::move(ops_inverses)},
           ops_matrices_(ops_name.size()) {
         num_par_ops_ = 0;
-        for (const auto &p : ops_params) {
-            if (p.size() > 0) {
+        num_params_ = 0;
+        for (size_t op = 0; op < ops_params_.size(); op++) {
+            if (hasParams(op)) {
                 num_par_ops_++;
+                num_params_ += ops_params_[op].size();
             }
         }
         num_nonpar_ops_ = ops_params.size() - num_par_ops_;
@@ -296,6 +320,17 @@ template <class T> class OpsData {
     [[nodiscard]] auto getOpsName() const -> const std::vector<std::string> & {
         return ops_name_;
     }
+    /**
+     * @brief Get the gate operation of each operation, resolved once from its
+     * name. Operations without a kernel, such as state preparations, have
+     * `GateOperation::NumGates`.
+     *
+     * @return const std::vector<GateOperation>&
+     */
+    [[nodiscard]] auto getOpsGates() const
+        -> const std::vector<GateOperation> & {
+        return ops_gates_;
+    }
     /**
      * @brief Get the (optional) parameters for each operation. Given entries
      * are empty ({}) if not required.
@@ -334,6 +369,55 @@ template <class T> class OpsData {
         return ops_matrices_;
     }
 
+    /**
+     * @brief Replace the parameters of the parametric operations, and the
+     * matrices of the given operations, keeping the rest of the circuit.
+     *
+     * This lets the same operations be evaluated at new parameters without
+     * serializing and resolving them again.
+     *
+     * @param params Parameters of the parametric operations, in order of
+     * appearance, `getNumParams()` values in total.
+     * @param matrices Either empty, or one entry per operation holding its new
+     * matrix, or empty to keep the current one.
+     */
+    void updateParams(const std::vector<T> &params,
+                      const std::vector<std::vector<std::complex<T>>> &matrices =
+                          {}) {
+        PL_ABORT_IF_NOT(params.size() == num_params_,
+                        "The parameters must provide one value per parameter "
+                        "of the parametric operations.");
+        PL_ABORT_IF_NOT(matrices.empty() || matrices.size() == getSize(),
+                        "The matrices must provide one entry per operation.");
+        size_t param_idx = 0;
+        for (size_t op = 0; op < getSize(); op++) {
+            if (hasParams(op)) {
+                auto &op_params = ops_params_[op];
+                std::copy(params.begin() + param_idx,
+                          params.begin() + param_idx + op_params.size(),
+                          op_params.begin());
+                param_idx += op_params.size();
+            }
+            if (!matrices.empty() && !matrices[op].empty()) {
+                PL_ABORT_IF_NOT(matrices[op].size() == ops_matrices_[op].size(),
+                                "The matrix of an operation must keep its "
+                                "size.");
+                ops_matrices_[op] = matrices[op];
+            }
+        }
+    }
+
+    /**
+     * @brief Notify if the operation at a given index is a state preparation.
+     *
+     * @param index Operation index.
+     * @return bool
+     */
+    [[nodiscard]] inline auto isStatePreparation(size_t index) const -> bool {
+        return (ops_name_[index] == "BasisState") ||
+               (ops_name_[index] == "QubitStateVector");
+    }
+
     /**
      * @brief Notify if the operation at a given index is parametric.
      *
@@ -342,7 +426,7 @@ template <class T> class OpsData {
      * @return false Gate in non-parametric.
      */
     [[nodiscard]] inline auto hasParams(size_t index) const -> bool {
-        return !ops_params_[index].empty();
+        return !ops_params_[index].empty() && !isStatePreparation(index);
     }
 
     /**
@@ -352,6 +436,13 @@ template <class T> class OpsData {
      */
     [[nodiscard]] auto getNumParOps() const -> size_t { return num_par_ops_; }
 
+    /**
+     * @brief Get the total number of parameters of the parametric operations.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getNumParams() const -> size_t { return num_params_; }
+
     /**
      * @brief Get the number of non-parametric ops.
      *
@@ -362,6 +453,100 @@ template <class T> class OpsData {
     }
 };
 
+/**
+ * @brief Apply the operations of an `%ObsDatum<T>` observable to a
+ * statevector.
+ *
+ * @tparam SVType Statevector type, `%StateVectorManaged<T>` or any class with
+ * the same `applyOperation` overloads.
+ * @param state Statevector to be updated.
+ * @param observable Observable to apply.
+ */
+template <class T, class SVType = StateVectorManaged<T>>
+void applyObservable(SVType &state, const ObsDatum<T> &observable) {
+    using namespace Pennylane::Util;
+    for (size_t j = 0; j < observable.getSize(); j++) {
+        if (!observable.getObsParams().empty()) {
+            std::visit(
+                [&](const auto &param) {
+                    using p_t = std::decay_t<decltype(param)>;
+                    // Apply supported gate with given params
+                    if constexpr (std::is_same_v<p_t, std::vector<T>>) {
+                        state.applyOperation(observable.getObsName()[j],
+                                             observable.getObsWires()[j],
+                                             false, param);
+                    }
+                    // Apply provided matrix
+                    else if constexpr (std::is_same_v<
+                                           p_t,
+                                           std::vector<std::complex<T>>>) {
+                        state.applyOperation(
+                            param, observable.getObsWires()[j], false);
+                    }
+                    // Apply sparse Hamiltonian of the whole statevector
+                    else if constexpr (std::is_same_v<
+                                           p_t, std::shared_ptr<const
+                                                    SparseHamiltonian<T>>>) {
+                        if constexpr (std::is_base_of_v<StateVector<T>,
+                                                        SVType>) {
+                            std::vector<std::complex<T>> h_psi(
+                                state.getLength());
+                            applySparseHamiltonian<T>(state, *param,
+                                                      h_psi.data());
+                            std::copy(h_psi.begin(), h_psi.end(),
+                                      state.getData());
+                        } else {
+                            PL_ABORT("Sparse Hamiltonians are not supported "
+                                     "by this statevector.");
+                        }
+                    } else {
+                        state.applyOperation(observable.getObsName()[j],
+                                             observable.getObsWires()[j],
+                                             false);
+                    }
+                },
+                observable.getObsParams()[j]);
+        } else { // Offloat to SV dispatcher if no parameters provided
+            state.applyOperation(observable.getObsName()[j],
+                                 observable.getObsWires()[j], false);
+        }
+    }
+}
+
+/**
+ * @brief Apply the operation at the given index of an `%OpsData<T>` object to
+ * a statevector if it is a state preparation.
+ *
+ * @tparam SVType Statevector type, `%StateVectorManaged<T>` or any class with
+ * the same `setBasisState` and `setStateVector` overloads.
+ * @param state Statevector to be updated.
+ * @param operations Operations to apply.
+ * @param op_idx Index of the operation.
+ * @return bool Whether the operation is a state preparation.
+ */
+template <class T, class SVType = StateVectorManaged<T>>
+auto applyStatePreparation(SVType &state, const OpsData<T> &operations,
+                           size_t op_idx) -> bool {
+    const auto &name = operations.getOpsName()[op_idx];
+    const auto &wires = operations.getOpsWires()[op_idx];
+    if (name == "BasisState") {
+        const auto &bits = operations.getOpsParams()[op_idx];
+        std::vector<size_t> basis_state(bits.size());
+        for (size_t i = 0; i < bits.size(); i++) {
+            PL_ABORT_IF_NOT(bits[i] == 0 || bits[i] == 1,
+                            "The basis state must consist of 0 or 1 values.");
+            basis_state[i] = static_cast<size_t>(bits[i]);
+        }
+        state.setBasisState(basis_state, wires);
+        return true;
+    }
+    if (name == "QubitStateVector") {
+        state.setStateVector(operations.getOpsMatrices()[op_idx], wires);
+        return true;
+    }
+    return false;
+}
+
 /**
  * @brief Represent the logic for the adjoint Jacobian method of
  * arXiV:2009.02823
@@ -369,13 +554,13 @@ template <class T> class OpsData {
  * @tparam T Floating-point precision.
  */
 template <class T = double> class AdjointJacobian {
-  private:
-    using GeneratorFunc = void (*)(StateVectorManaged<T> &,
-                                   const std::vector<size_t> &,
-                                   const bool); // function pointer type
+  protected:
+    using GeneratorFunc =
+        std::function<void(StateVectorManaged<T> &,
+                           const std::vector<size_t> &, const bool)>;
 
     // Holds the mapping from gate labels to associated generator functions.
-    const std::unordered_map<std::string, GeneratorFunc> generator_map{
+    std::unordered_map<std::string, GeneratorFunc> generator_map{
         {"RX", &::applyGeneratorRX<T, StateVectorManaged<T>>},
         {"RY", &::applyGeneratorRY<T, StateVectorManaged<T>>},
         {"RZ", &::applyGeneratorRZ<T, StateVectorManaged<T>>},
@@ -387,7 +572,7 @@ template <class T = double> class AdjointJacobian {
          &::applyGeneratorControlledPhaseShift<T, StateVectorManaged<T>>}};
 
     // Holds the mappings from gate labels to associated generator coefficients.
-    const std::unordered_map<std::string, T> scaling_factors{
+    std::unordered_map<std::string, T> scaling_factors{
         {"RX", -static_cast<T>(0.5)},
         {"RY", -static_cast<T>(0.5)},
         {"RZ", -static_cast<T>(0.5)},
@@ -397,6 +582,31 @@ template <class T = double> class AdjointJacobian {
         {"CRZ", -static_cast<T>(0.5)},
         {"ControlledPhaseShift", static_cast<T>(1)}};
 
+    /**
+     * @brief Single-parameter gate of a decomposition of a multi-parameter
+     * gate.
+     */
+    struct GateFactor {
+        /// Name of the single-parameter gate
+        std::string name;
+        /// Positions of its wires among the wires of the decomposed gate
+        std::vector<size_t> wires;
+    };
+
+    // Holds the decompositions of the multi-parameter gates, in order of
+    // application, where factor k takes parameter k of the gate.
+    const std::unordered_map<std::string, std::vector<GateFactor>>
+        gate_factors{
+            {"Rot", {{"RZ", {0}}, {"RY", {0}}, {"RZ", {0}}}},
+            {"CRot", {{"CRZ", {0, 1}}, {"CRY", {0, 1}}, {"CRZ", {0, 1}}}}};
+
+    /// Jacobian column of the parameters that are not trainable
+    static constexpr size_t NOT_TRAINABLE = std::numeric_limits<size_t>::max();
+
+    /// Largest number of wires of the operations undone together with the
+    /// calculation of their Jacobian entries
+    static constexpr size_t FUSED_ADJOINT_MAX_WIRES = 3;
+
     /**
      * @brief Utility method to update the Jacobian at a given index by
      * calculating the overlap between two given states.
@@ -413,6 +623,8 @@ template <class T = double> class AdjointJacobian {
                                std::vector<std::vector<T>> &jac,
                                T scaling_coeff, size_t obs_index,
                                size_t param_index) {
+        PL_INSTRUMENT_SCOPE("AdjointJacobian::updateJacobian",
+                            2 * sv1.getLength() * sizeof(std::complex<T>));
         jac[obs_index][param_index] =
             -2 * scaling_coeff *
             std::imag(innerProdC(sv1.getDataVector(), sv2.getDataVector()));
@@ -420,22 +632,50 @@ template <class T = double> class AdjointJacobian {
 
     /**
      * @brief Utility method to apply all operations from given `%OpsData<T>`
-     * object to `%StateVectorManaged<T>`
+     * object to `%StateVectorManaged<T>`. State preparations and operations
+     * given as matrices are applied natively.
      *
      * @param state Statevector to be updated.
      * @param operations Operations to apply.
-     * @param adj Take the adjoint of the given operations.
+     * @param adj Take the adjoint of the given operations, which then must not
+     * include state preparations.
      */
     inline void applyOperations(StateVectorManaged<T> &state,
                                 const OpsData<T> &operations,
                                 bool adj = false) {
         for (size_t op_idx = 0; op_idx < operations.getOpsName().size();
              op_idx++) {
-            state.applyOperation(operations.getOpsName()[op_idx],
-                                 operations.getOpsWires()[op_idx],
-                                 operations.getOpsInverses()[op_idx] ^ adj,
-                                 operations.getOpsParams()[op_idx]);
+            applyOperation(state, operations, op_idx, adj);
+        }
+    }
+
+    /**
+     * @brief Utility method to apply the indexed operation from `%OpsData<T>`
+     * object to `%StateVectorManaged<T>`.
+     *
+     * @see applyOperations
+     *
+     * @param state Statevector to be updated.
+     * @param operations Operations to apply.
+     * @param op_idx Index of the operation to apply.
+     * @param adj Take the adjoint of the operation.
+     */
+    inline void applyOperation(StateVectorManaged<T> &state,
+                               const OpsData<T> &operations, size_t op_idx,
+                               bool adj = false) {
+        if (!adj && applyStatePreparation(state, operations, op_idx)) {
+            return;
+        }
+        const auto &matrix = operations.getOpsMatrices()[op_idx];
+        if (!matrix.empty()) {
+            state.applyMatrix(matrix, operations.getOpsWires()[op_idx],
+                              operations.getOpsInverses()[op_idx] ^ adj);
+            return;
         }
+        state.applyOperation(operations.getOpsGates()[op_idx],
+                             operations.getOpsWires()[op_idx],
+                             operations.getOpsInverses()[op_idx] ^ adj,
+                             operations.getOpsParams()[op_idx]);
     }
     /**
      * @brief Utility method to apply the adjoint indexed operation from
@@ -447,10 +687,7 @@ template <class T = double> class AdjointJacobian {
      */
     inline void applyOperationAdj(StateVectorManaged<T> &state,
                                   const OpsData<T> &operations, size_t op_idx) {
-        state.applyOperation(operations.getOpsName()[op_idx],
-                             operations.getOpsWires()[op_idx],
-                             !operations.getOpsInverses()[op_idx],
-                             operations.getOpsParams()[op_idx]);
+        applyOperation(state, operations, op_idx, true);
     }
 
     /**
@@ -462,36 +699,7 @@ template <class T = double> class AdjointJacobian {
      */
     inline void applyObservable(StateVectorManaged<T> &state,
                                 const ObsDatum<T> &observable) {
-        using namespace Pennylane::Util;
-        for (size_t j = 0; j < observable.getSize(); j++) {
-            if (!observable.getObsParams().empty()) {
-                std::visit(
-                    [&](const auto &param) {
-                        using p_t = std::decay_t<decltype(param)>;
-                        // Apply supported gate with given params
-                        if constexpr (std::is_same_v<p_t, std::vector<T>>) {
-                            state.applyOperation(observable.getObsName()[j],
-                                                 observable.getObsWires()[j],
-                                                 false, param);
-                        }
-                        // Apply provided matrix
-                        else if constexpr (std::is_same_v<
-                                               p_t,
-                                               std::vector<std::complex<T>>>) {
-                            state.applyOperation(
-                                param, observable.getObsWires()[j], false);
-                        } else {
-                            state.applyOperation(observable.getObsName()[j],
-                                                 observable.getObsWires()[j],
-                                                 false);
-                        }
-                    },
-                    observable.getObsParams()[j]);
-            } else { // Offloat to SV dispatcher if no parameters provided
-                state.applyOperation(observable.getObsName()[j],
-                                     observable.getObsWires()[j], false);
-            }
-        }
+        Algorithms::applyObservable(state, observable);
     }
 
     /**
@@ -505,6 +713,10 @@ template <class T = double> class AdjointJacobian {
     inline void applyObservables(std::vector<StateVectorManaged<T>> &states,
                                  const StateVectorManaged<T> &reference_state,
                                  const std::vector<ObsDatum<T>> &observables) {
+        PL_INSTRUMENT_SCOPE("AdjointJacobian::applyObservables",
+                            2 * observables.size() *
+                                reference_state.getLength() *
+                                sizeof(std::complex<T>));
         // clang-format off
         // Globally scoped exception value to be captured within OpenMP block.
         // See the following for OpenMP design decisions:
@@ -555,6 +767,10 @@ template <class T = double> class AdjointJacobian {
     inline void applyOperationsAdj(std::vector<StateVectorManaged<T>> &states,
                                    const OpsData<T> &operations,
                                    size_t op_idx) {
+        PL_INSTRUMENT_SCOPE("AdjointJacobian::applyOperationsAdj",
+                            2 * states.size() *
+                                (states.empty() ? 0 : states[0].getLength()) *
+                                sizeof(std::complex<T>));
         // clang-format off
         // Globally scoped exception value to be captured within OpenMP block.
         // See the following for OpenMP design decisions:
@@ -631,13 +847,628 @@ template <class T = double> class AdjointJacobian {
                                const std::string &op_name,
                                const std::vector<size_t> &wires, const bool adj)
         -> T {
-        generator_map.at(op_name)(sv, wires, adj);
+        const auto generator_it = generator_map.find(op_name);
+        PL_ABORT_IF(generator_it == generator_map.end(),
+                    "The operation is not supported using the adjoint "
+                    "differentiation method");
+        generator_it->second(sv, wires, adj);
         return scaling_factors.at(op_name);
     }
 
+    /**
+     * @brief Get the generator of every parameter of a multi-parameter gate,
+     * as a Hermitian matrix over the gate wires with its scaling coefficient.
+     *
+     * For a gate \f$U = F_m \cdots F_1\f$ with single-parameter factors
+     * \f$F_k = e^{i s_k \theta_k G_k}\f$, the derivative by \f$\theta_k\f$
+     * is \f$i s_k (V_k G_k V_k^\dagger) U\f$ with
+     * \f$V_k = F_m \cdots F_{k+1}\f$, so that the matrix
+     * \f$V_k G_k V_k^\dagger\f$ acts on the state after the gate like a
+     * single-parameter generator. The adjoint gate applies the inverted
+     * factors in reverse order, with negated scaling coefficients.
+     *
+     * @param operations Operations list.
+     * @param op_idx Index of the gate within the operations list.
+     * @return Matrix and scaling coefficient of each parameter.
+     */
+    auto getParamGenerators(const OpsData<T> &operations, size_t op_idx)
+        -> std::vector<std::pair<std::vector<std::complex<T>>, T>> {
+        const auto factors_it =
+            gate_factors.find(operations.getOpsName()[op_idx]);
+        PL_ABORT_IF(factors_it == gate_factors.end(),
+                    "The operation is not supported using the adjoint "
+                    "differentiation method");
+        const auto &factors = factors_it->second;
+        const auto &params = operations.getOpsParams()[op_idx];
+        PL_ABORT_IF_NOT(params.size() == factors.size(),
+                        "Invalid number of gate parameters.");
+        const bool inverse = operations.getOpsInverses()[op_idx];
+        const size_t num_wires = operations.getOpsWires()[op_idx].size();
+        const size_t dim = Util::exp2(num_wires);
+
+        std::vector<size_t> order(factors.size());
+        std::iota(order.begin(), order.end(), 0);
+        if (inverse) {
+            std::reverse(order.begin(), order.end());
+        }
+        const auto apply_factor = [&](StateVectorManaged<T> &sv, size_t k,
+                                      bool adj) {
+            sv.applyOperation(factors[k].name, factors[k].wires,
+                              inverse ^ adj, {params[k]});
+        };
+
+        // Column j of the matrix is its product with basis state j
+        std::vector<std::pair<std::vector<std::complex<T>>, T>> generators(
+            factors.size());
+        StateVectorManaged<T> column(num_wires);
+        column.setNumThreads(1);
+        for (size_t pos = 0; pos < order.size(); pos++) {
+            const size_t k = order[pos];
+            std::vector<std::complex<T>> matrix(dim * dim);
+            for (size_t j = 0; j < dim; j++) {
+                column.setBasisState(j);
+                for (size_t next = order.size(); next-- > pos + 1;) {
+                    apply_factor(column, order[next], true);
+                }
+                generator_map.at(factors[k].name)(column, factors[k].wires,
+                                                  false);
+                for (size_t next = pos + 1; next < order.size(); next++) {
+                    apply_factor(column, order[next], false);
+                }
+                for (size_t i = 0; i < dim; i++) {
+                    matrix[i * dim + j] = column.getData()[i];
+                }
+            }
+            const T scaling = scaling_factors.at(factors[k].name);
+            generators[k] = {std::move(matrix), inverse ? -scaling : scaling};
+        }
+        return generators;
+    }
+
+    /**
+     * @brief Get the matrix taking the state with one generator applied to
+     * the state with another one applied.
+     *
+     * @param next Generator to apply.
+     * @param previous Generator already applied.
+     * @return std::vector<std::complex<T>> The product `next * previous`, if
+     * `previous` squares to the identity on the image of `next`, or else an
+     * empty vector.
+     */
+    static auto getGeneratorStep(const std::vector<std::complex<T>> &next,
+                                 const std::vector<std::complex<T>> &previous)
+        -> std::vector<std::complex<T>> {
+        const size_t dim = Util::exp2(Util::log2(next.size()) / 2);
+        const auto product = [dim](const std::vector<std::complex<T>> &a,
+                                   const std::vector<std::complex<T>> &b) {
+            std::vector<std::complex<T>> c(dim * dim);
+            for (size_t i = 0; i < dim; i++) {
+                for (size_t k = 0; k < dim; k++) {
+                    for (size_t j = 0; j < dim; j++) {
+                        c[i * dim + j] += a[i * dim + k] * b[k * dim + j];
+                    }
+                }
+            }
+            return c;
+        };
+        auto step = product(next, previous);
+        const auto check = product(step, previous);
+        const T tolerance = std::sqrt(std::numeric_limits<T>::epsilon());
+        for (size_t i = 0; i < check.size(); i++) {
+            if (std::abs(check[i] - next[i]) > tolerance) {
+                return {};
+            }
+        }
+        return step;
+    }
+
+    /**
+     * @brief Update one Jacobian column with the overlaps of the
+     * observable-applied states and a generator-applied state.
+     *
+     * @param H_lambda Observable-applied states.
+     * @param mu Generator-applied state.
+     * @param jac Jacobian receiving the values.
+     * @param scaling_coeff Generator coefficient.
+     * @param obs_offset Jacobian row of the first observable-applied state.
+     * @param param_index Jacobian column to update.
+     */
+    void
+    updateJacobianColumn(const std::vector<StateVectorManaged<T>> &H_lambda,
+                         const StateVectorManaged<T> &mu,
+                         std::vector<std::vector<T>> &jac, T scaling_coeff,
+                         size_t obs_offset, size_t param_index) {
+        const size_t num_states = H_lambda.size();
+        // clang-format off
+
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none)                         \
+            shared(H_lambda, mu, jac, scaling_coeff, obs_offset,          \
+                   param_index, num_states)
+        #endif
+
+        // clang-format on
+        for (size_t obs_idx = 0; obs_idx < num_states; obs_idx++) {
+            updateJacobian(H_lambda[obs_idx], mu, jac, scaling_coeff,
+                           obs_offset + obs_idx, param_index);
+        }
+    }
+
+    /**
+     * @brief Calculate the Jacobian entries of the parameters of one
+     * operation, from the states right after it.
+     *
+     * Single-parameter gates apply their generator to a copy of the forward
+     * state. Multi-parameter gates apply the generator of each trainable
+     * parameter in turn on the same copy when the previous one can be undone
+     * within the step, and otherwise start again from the forward state.
+     *
+     * @param lambda Forward state.
+     * @param mu Workspace statevector, resized to the forward state if empty.
+     * @param H_lambda Observable-applied states.
+     * @param jac Jacobian receiving the values.
+     * @param obs_offset Jacobian row of the first observable-applied state.
+     * @param operations Operations list.
+     * @param op_idx Index of the operation within the operations list.
+     * @param columns Jacobian column of each parameter of the operation, or
+     * `NOT_TRAINABLE`.
+     */
+    void updateJacobianOp(const StateVectorManaged<T> &lambda,
+                          StateVectorManaged<T> &mu,
+                          const std::vector<StateVectorManaged<T>> &H_lambda,
+                          std::vector<std::vector<T>> &jac, size_t obs_offset,
+                          const OpsData<T> &operations, size_t op_idx,
+                          const std::vector<size_t> &columns) {
+        if (std::all_of(columns.begin(), columns.end(),
+                        [](size_t c) { return c == NOT_TRAINABLE; })) {
+            return;
+        }
+        const auto &wires = operations.getOpsWires()[op_idx];
+        const bool inverse = operations.getOpsInverses()[op_idx];
+        if (columns.size() == 1) {
+            mu = lambda;
+            const T scalingFactor =
+                applyGenerator(mu, operations.getOpsName()[op_idx], wires,
+                               !inverse) *
+                (2 * (0b1 ^ inverse) - 1);
+            updateJacobianColumn(H_lambda, mu, jac, scalingFactor, obs_offset,
+                                 columns[0]);
+            return;
+        }
+
+        const auto generators = getParamGenerators(operations, op_idx);
+        const std::vector<std::complex<T>> *previous = nullptr;
+        for (size_t p = 0; p < columns.size(); p++) {
+            if (columns[p] == NOT_TRAINABLE) {
+                continue;
+            }
+            const auto &matrix = generators[p].first;
+            const auto step = (previous == nullptr)
+                                  ? std::vector<std::complex<T>>{}
+                                  : getGeneratorStep(matrix, *previous);
+            if (step.empty()) {
+                mu = lambda;
+                mu.applyMatrix(matrix, wires, false);
+            } else {
+                mu.applyMatrix(step, wires, false);
+            }
+            updateJacobianColumn(H_lambda, mu, jac, generators[p].second,
+                                 obs_offset, columns[p]);
+            previous = &matrix;
+        }
+    }
+
+    /**
+     * @brief Get the matrix of the adjoint of an operation, over its own
+     * wires.
+     *
+     * @param operations Operations list.
+     * @param op_idx Index of the operation within the operations list.
+     * @return std::vector<std::complex<T>> Matrix in row-major order.
+     */
+    static auto getAdjointMatrix(const OpsData<T> &operations, size_t op_idx)
+        -> std::vector<std::complex<T>> {
+        const auto &matrix = operations.getOpsMatrices()[op_idx];
+        const bool inverse = operations.getOpsInverses()[op_idx];
+        const size_t num_wires = operations.getOpsWires()[op_idx].size();
+        const size_t dim = Util::exp2(num_wires);
+
+        std::vector<std::complex<T>> adj_matrix(dim * dim);
+        if (!matrix.empty()) {
+            for (size_t i = 0; i < dim; i++) {
+                for (size_t j = 0; j < dim; j++) {
+                    adj_matrix[i * dim + j] =
+                        inverse ? matrix[i * dim + j]
+                                : std::conj(matrix[j * dim + i]);
+                }
+            }
+            return adj_matrix;
+        }
+
+        // Column j of the matrix is its product with basis state j
+        std::vector<size_t> local_wires(num_wires);
+        std::iota(local_wires.begin(), local_wires.end(), 0);
+        StateVectorManaged<T> column(num_wires);
+        column.setNumThreads(1);
+        for (size_t j = 0; j < dim; j++) {
+            column.setBasisState(j);
+            column.applyOperation(operations.getOpsGates()[op_idx],
+                                  local_wires, !inverse,
+                                  operations.getOpsParams()[op_idx]);
+            for (size_t i = 0; i < dim; i++) {
+                adj_matrix[i * dim + j] = column.getData()[i];
+            }
+        }
+        return adj_matrix;
+    }
+
+    /**
+     * @brief Calculate the Jacobian entries of the parameters of one
+     * operation while undoing it from the observable-applied states, in a
+     * single pass over each of them.
+     *
+     * The generators of the parameters and the adjoint of the operation are
+     * built as matrices over the operation wires, and each observable-applied
+     * state is updated with `%StateVector::applyMatrixWithOverlaps`, which
+     * reads the forward state in place of a generator-applied copy.
+     *
+     * @param lambda Forward state.
+     * @param H_lambda Observable-applied states.
+     * @param jac Jacobian receiving the values.
+     * @param obs_offset Jacobian row of the first observable-applied state.
+     * @param operations Operations list.
+     * @param op_idx Index of the operation within the operations list.
+     * @param columns Jacobian column of each parameter of the operation, or
+     * `NOT_TRAINABLE`.
+     * @return Whether the operation was processed. Operations without
+     * trainable parameters, wider than `FUSED_ADJOINT_MAX_WIRES` or without
+     * a known generator are left to `updateJacobianOp`.
+     */
+    auto updateJacobianOpFused(const StateVectorManaged<T> &lambda,
+                               std::vector<StateVectorManaged<T>> &H_lambda,
+                               std::vector<std::vector<T>> &jac,
+                               size_t obs_offset, const OpsData<T> &operations,
+                               size_t op_idx,
+                               const std::vector<size_t> &columns) -> bool {
+        const auto &name = operations.getOpsName()[op_idx];
+        const size_t num_wires = operations.getOpsWires()[op_idx].size();
+        if (num_wires > FUSED_ADJOINT_MAX_WIRES ||
+            std::all_of(columns.begin(), columns.end(),
+                        [](size_t c) { return c == NOT_TRAINABLE; })) {
+            return false;
+        }
+
+        std::vector<std::vector<std::complex<T>>> generators;
+        std::vector<T> scalings;
+        std::vector<size_t> gen_columns;
+        if (columns.size() == 1) {
+            if (generator_map.find(name) == generator_map.end()) {
+                return false;
+            }
+            const bool inverse = operations.getOpsInverses()[op_idx];
+            const size_t dim = Util::exp2(num_wires);
+            std::vector<size_t> local_wires(num_wires);
+            std::iota(local_wires.begin(), local_wires.end(), 0);
+            std::vector<std::complex<T>> matrix(dim * dim);
+            StateVectorManaged<T> column(num_wires);
+            column.setNumThreads(1);
+            T scaling = 0;
+            for (size_t j = 0; j < dim; j++) {
+                column.setBasisState(j);
+                scaling = applyGenerator(column, name, local_wires, !inverse);
+                for (size_t i = 0; i < dim; i++) {
+                    matrix[i * dim + j] = column.getData()[i];
+                }
+            }
+            generators.push_back(std::move(matrix));
+            scalings.push_back(scaling * (2 * (0b1 ^ inverse) - 1));
+            gen_columns.push_back(columns[0]);
+        } else {
+            if (gate_factors.find(name) == gate_factors.end()) {
+                return false;
+            }
+            auto param_generators = getParamGenerators(operations, op_idx);
+            for (size_t p = 0; p < columns.size(); p++) {
+                if (columns[p] != NOT_TRAINABLE) {
+                    generators.push_back(std::move(param_generators[p].first));
+                    scalings.push_back(param_generators[p].second);
+                    gen_columns.push_back(columns[p]);
+                }
+            }
+        }
+
+        const auto adj_matrix = getAdjointMatrix(operations, op_idx);
+        const auto &wires = operations.getOpsWires()[op_idx];
+        const size_t num_states = H_lambda.size();
+        // clang-format off
+
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none)                         \
+            shared(lambda, H_lambda, jac, obs_offset, generators, scalings, \
+                   gen_columns, adj_matrix, wires, num_states)
+        #endif
+
+        // clang-format on
+        for (size_t obs_idx = 0; obs_idx < num_states; obs_idx++) {
+            const auto overlaps = H_lambda[obs_idx].applyMatrixWithOverlaps(
+                adj_matrix, wires, lambda, generators);
+            for (size_t g = 0; g < overlaps.size(); g++) {
+                jac[obs_offset + obs_idx][gen_columns[g]] =
+                    -2 * scalings[g] * std::imag(overlaps[g]);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Get the Jacobian column of each parameter of every operation.
+     *
+     * @param operations Operations list.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @return Columns of the parameters of each operation, `NOT_TRAINABLE`
+     * for those not in `trainableParams`.
+     */
+    static auto getParamColumns(const OpsData<T> &operations,
+                                const std::vector<size_t> &trainableParams)
+        -> std::vector<std::vector<size_t>> {
+        std::vector<std::vector<size_t>> columns(operations.getSize());
+        size_t param_idx = 0;
+        for (size_t op_idx = 0; op_idx < operations.getSize(); op_idx++) {
+            if (!operations.hasParams(op_idx)) {
+                continue;
+            }
+            for (size_t p = 0; p < operations.getOpsParams()[op_idx].size();
+                 p++) {
+                const auto tp_it =
+                    std::find(trainableParams.begin(), trainableParams.end(),
+                              param_idx++);
+                columns[op_idx].push_back(
+                    tp_it == trainableParams.end()
+                        ? NOT_TRAINABLE
+                        : static_cast<size_t>(
+                              std::distance(trainableParams.begin(), tp_it)));
+            }
+        }
+        return columns;
+    }
+
+    /**
+     * @brief Run the adjoint backward pass for the observables in
+     * `[obs_begin, obs_end)`, writing their rows of `jac`.
+     *
+     * @param psi Pointer to the statevector data.
+     * @param num_elements Length of the statevector data.
+     * @param jac Preallocated vector for Jacobian data results.
+     * @param observables Observables for which to calculate Jacobian.
+     * @param obs_begin Index of the first observable of the chunk.
+     * @param obs_end Index past the last observable of the chunk.
+     * @param operations Operations used to create given state.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @param apply_operations Indicate whether to apply operations to psi prior
+     * to calculation.
+     */
+    void adjointJacobianChunk(const std::complex<T> *psi, size_t num_elements,
+                              std::vector<std::vector<T>> &jac,
+                              const std::vector<ObsDatum<T>> &observables,
+                              size_t obs_begin, size_t obs_end,
+                              const OpsData<T> &operations,
+                              const std::vector<size_t> &trainableParams,
+                              bool apply_operations) {
+        size_t num_observables = obs_end - obs_begin;
+        const auto columns = getParamColumns(operations, trainableParams);
+
+        // Create $U_{1:p}\vert \lambda \rangle$
+        StateVectorManaged<T> lambda(psi, num_elements);
+
+        // Apply given operations to statevector if requested
+        if (apply_operations) {
+            applyOperations(lambda, operations);
+        }
+
+        // Create observable-applied state-vectors
+        const std::vector<ObsDatum<T>> chunk_observables(
+            observables.begin() + obs_begin, observables.begin() + obs_end);
+        std::vector<StateVectorManaged<T>> H_lambda(num_observables,
+                                                    {lambda.getNumQubits()});
+        applyObservables(H_lambda, lambda, chunk_observables);
+
+        // Only allocated for operations whose Jacobian entries are not fused
+        StateVectorManaged<T> mu;
+        adjointBackwardPass(lambda, mu, H_lambda, jac, obs_begin, operations,
+                            columns);
+    }
+
+    /**
+     * @brief Undo every operation from the forward state and the
+     * observable-applied states, writing the Jacobian entries of the trainable
+     * parameters.
+     *
+     * @param lambda Forward state after all operations. Used as workspace.
+     * @param mu Workspace statevector, possibly empty.
+     * @param H_lambda Observable-applied states. Used as workspace.
+     * @param jac Jacobian receiving the values.
+     * @param obs_offset Jacobian row of the first observable-applied state.
+     * @param operations Operations used to create given state.
+     * @param columns Jacobian columns of the parameters of each operation, or
+     * `NOT_TRAINABLE`.
+     */
+    void adjointBackwardPass(StateVectorManaged<T> &lambda,
+                             StateVectorManaged<T> &mu,
+                             std::vector<StateVectorManaged<T>> &H_lambda,
+                             std::vector<std::vector<T>> &jac,
+                             size_t obs_offset, const OpsData<T> &operations,
+                             const std::vector<std::vector<size_t>> &columns) {
+        for (size_t op_idx = operations.getSize(); op_idx-- > 0;) {
+            if (operations.isStatePreparation(op_idx)) {
+                continue;
+            }
+            if (!updateJacobianOpFused(lambda, H_lambda, jac, obs_offset,
+                                       operations, op_idx, columns[op_idx])) {
+                updateJacobianOp(lambda, mu, H_lambda, jac, obs_offset,
+                                 operations, op_idx, columns[op_idx]);
+                applyOperationsAdj(H_lambda, operations, op_idx);
+            }
+            applyOperationAdj(lambda, operations, op_idx);
+        }
+    }
+
+    /**
+     * @brief Apply the weighted sum of observables \f$\sum_k w_k O_k\f$ to
+     * a statevector.
+     *
+     * @param state Statevector receiving the result.
+     * @param reference_state Statevector the observables are applied to.
+     * @param workspace Statevector used to apply each observable.
+     * @param weights Weight of each observable. Zero-weight observables are
+     * skipped.
+     * @param observables Observables to apply.
+     */
+    void applyWeightedObservables(StateVectorManaged<T> &state,
+                                  const StateVectorManaged<T> &reference_state,
+                                  StateVectorManaged<T> &workspace,
+                                  const std::vector<T> &weights,
+                                  const std::vector<ObsDatum<T>> &observables) {
+        PL_INSTRUMENT_SCOPE("AdjointJacobian::applyWeightedObservables",
+                            4 * observables.size() *
+                                reference_state.getLength() *
+                                sizeof(std::complex<T>));
+        std::complex<T> *sum = state.getData();
+        const std::complex<T> *term = workspace.getData();
+        const size_t length = state.getLength();
+        std::fill(sum, sum + length, std::complex<T>{0, 0});
+        for (size_t obs_idx = 0; obs_idx < observables.size(); obs_idx++) {
+            const T weight = weights[obs_idx];
+            if (weight == 0) {
+                continue;
+            }
+            workspace.updateData(reference_state.getDataVector());
+            applyObservable(workspace, observables[obs_idx]);
+            // clang-format off
+
+            #if defined(_OPENMP)
+                #pragma omp parallel for default(none)                     \
+                shared(sum, term, weight, length)
+            #endif
+
+            // clang-format on
+            for (size_t i = 0; i < length; i++) {
+                sum[i] += weight * term[i];
+            }
+        }
+    }
+
+    /**
+     * @brief Run the backward pass of one checkpointed segment, undoing the
+     * operations `[op_begin, op_end)` and writing the Jacobian columns of the
+     * trainable ones.
+     *
+     * @param lambda Forward state after the operations `[0, op_end)`. Used as
+     * workspace.
+     * @param H_lambda Observable-applied states at the same position, one per
+     * observable. Used as workspace.
+     * @param jac Jacobian receiving the values.
+     * @param operations Operations used to create given state.
+     * @param op_columns Jacobian columns of the parameters of each operation,
+     * or `NOT_TRAINABLE`.
+     * @param op_begin Index of the first operation of the segment.
+     * @param op_end Index past the last operation of the segment.
+     */
+    void
+    adjointJacobianSegment(StateVectorManaged<T> &lambda,
+                           std::vector<StateVectorManaged<T>> &H_lambda,
+                           std::vector<std::vector<T>> &jac,
+                           const OpsData<T> &operations,
+                           const std::vector<std::vector<size_t>> &op_columns,
+                           size_t op_begin, size_t op_end) {
+        // Only allocated for operations whose Jacobian entries are not fused
+        StateVectorManaged<T> mu;
+        mu.setNumThreads(lambda.getNumThreads());
+
+        for (size_t op_idx = op_end; op_idx-- > op_begin;) {
+            if (operations.isStatePreparation(op_idx)) {
+                continue;
+            }
+            const bool fused =
+                updateJacobianOpFused(lambda, H_lambda, jac, 0, operations,
+                                      op_idx, op_columns[op_idx]);
+            if (!fused) {
+                updateJacobianOp(lambda, mu, H_lambda, jac, 0, operations,
+                                 op_idx, op_columns[op_idx]);
+            }
+            // The states are not needed before the first operation
+            if (op_idx > op_begin) {
+                applyOperationAdj(lambda, operations, op_idx);
+                if (!fused) {
+                    for (auto &h_lambda : H_lambda) {
+                        applyOperationAdj(h_lambda, operations, op_idx);
+                    }
+                }
+            }
+        }
+    }
+
   public:
     AdjointJacobian() = default;
 
+    /**
+     * @brief Register the generator of a single-parameter gate
+     * \f$U(\theta) = e^{i s \theta G}\f$, so that it can be differentiated
+     * without decomposition. The gate itself is applied by name, or with its
+     * matrix in the operations.
+     *
+     * @param name Name of the gate.
+     * @param generator Function applying \f$G\f$ to a statevector, given the
+     * wires of the gate and whether to take the adjoint.
+     * @param scaling_factor Generator coefficient \f$s\f$.
+     */
+    void registerGenerator(const std::string &name, GeneratorFunc generator,
+                           T scaling_factor) {
+        PL_ABORT_IF(gate_factors.find(name) != gate_factors.end(),
+                    "Cannot replace the generators of a multi-parameter gate.");
+        generator_map[name] = std::move(generator);
+        scaling_factors[name] = scaling_factor;
+    }
+
+    /**
+     * @brief Register the generator of a single-parameter gate as a Hermitian
+     * matrix over its wires.
+     *
+     * @see registerGenerator(const std::string &, GeneratorFunc, T)
+     *
+     * @param name Name of the gate.
+     * @param matrix Row-major generator matrix.
+     * @param scaling_factor Generator coefficient.
+     */
+    void registerGenerator(const std::string &name,
+                           std::vector<std::complex<T>> matrix,
+                           T scaling_factor) {
+        const size_t dim = Util::exp2(Util::log2(matrix.size()) / 2);
+        PL_ABORT_IF(matrix.size() < 4 || dim * dim != matrix.size(),
+                    "The generator must be a square matrix over the wires "
+                    "of the gate.");
+        registerGenerator(
+            name,
+            [matrix = std::move(matrix)](StateVectorManaged<T> &sv,
+                                         const std::vector<size_t> &wires,
+                                         const bool adj) {
+                sv.applyMatrix(matrix, wires, adj);
+            },
+            scaling_factor);
+    }
+
+    /**
+     * @brief Indicate whether the parameters of a gate can be differentiated.
+     *
+     * @param name Name of the gate.
+     * @return bool
+     */
+    [[nodiscard]] auto hasGenerator(const std::string &name) const -> bool {
+        return generator_map.find(name) != generator_map.end() ||
+               gate_factors.find(name) != gate_factors.end();
+    }
+
     /**
      * @brief Utility to create a given operations object.
      *
@@ -659,6 +1490,25 @@ template <class T = double> class AdjointJacobian {
         return {ops_name, ops_params, ops_wires, ops_inverses, ops_matrices};
     }
 
+    /**
+     * @brief Get the largest number of observable-applied statevectors that
+     * keeps `adjointJacobian` within a memory budget. Besides these, the
+     * calculation holds two more statevectors. At least one observable is
+     * always processed at a time.
+     *
+     * @param num_qubits Number of qubits of the statevector.
+     * @param memory_budget Memory budget in bytes.
+     * @return size_t Value for the `max_obs_states` argument of
+     * `adjointJacobian`.
+     */
+    [[nodiscard]] static auto getMaxObsStates(size_t num_qubits,
+                                              size_t memory_budget) -> size_t {
+        const size_t state_bytes =
+            Util::exp2(num_qubits) * sizeof(std::complex<T>);
+        const size_t num_states = memory_budget / state_bytes;
+        return (num_states > 3) ? num_states - 2 : 1;
+    }
+
     /**
      * @brief Calculates the Jacobian for the statevector for the selected set
      * of parametric gates.
@@ -673,6 +1523,11 @@ template <class T = double> class AdjointJacobian {
      * size `trainableParams.size() * observables.size()`. OpenMP is used to
      * enable independent operations to be offloaded to threads.
      *
+     * If `max_obs_states` is non-zero, the observables are processed in chunks
+     * of at most that many, each with its own backward pass starting again
+     * from `psi`. This bounds the memory to `max_obs_states + 2` statevectors
+     * at the cost of one adjoint sweep per chunk.
+     *
      * @param psi Pointer to the statevector data.
      * @param num_elements Length of the statevector data.
      * @param jac Preallocated vector for Jacobian data results.
@@ -682,84 +1537,250 @@ template <class T = double> class AdjointJacobian {
      * calculation.
      * @param apply_operations Indicate whether to apply operations to psi prior
      * to calculation.
+     * @param max_obs_states Maximum number of observable-applied statevectors
+     * held at once. Use 0 to process all observables together.
      */
     void adjointJacobian(const std::complex<T> *psi, size_t num_elements,
                          std::vector<std::vector<T>> &jac,
                          const std::vector<ObsDatum<T>> &observables,
                          const OpsData<T> &operations,
                          const std::vector<size_t> &trainableParams,
-                         bool apply_operations = false) {
+                         bool apply_operations = false,
+                         size_t max_obs_states = 0) {
         PL_ABORT_IF(trainableParams.empty(),
                     "No trainable parameters provided.");
 
-        // Track positions within par and non-par operations
-        size_t num_observables = observables.size();
-        size_t trainableParamNumber = trainableParams.size() - 1;
-        size_t current_param_idx =
-            operations.getNumParOps() - 1; // total number of parametric ops
+        const size_t num_observables = observables.size();
+        const size_t chunk_size =
+            (max_obs_states == 0) ? num_observables : max_obs_states;
+        for (size_t obs_begin = 0; obs_begin < num_observables;
+             obs_begin += chunk_size) {
+            const size_t obs_end =
+                std::min(obs_begin + chunk_size, num_observables);
+            adjointJacobianChunk(psi, num_elements, jac, observables,
+                                 obs_begin, obs_end, operations,
+                                 trainableParams, apply_operations);
+        }
+    }
 
-        auto tp_it = trainableParams.end();
+    /**
+     * @brief Calculates the vector-Jacobian product of the given cotangent
+     * with the Jacobian of `adjointJacobian`, that is the gradient of
+     * \f$\sum_k dy_k \langle O_k \rangle\f$.
+     *
+     * The weighted observables are folded into a single observable-applied
+     * state before the backward pass, so that the product takes one sweep
+     * with three statevectors whatever the number of observables.
+     *
+     * @param psi Pointer to the statevector data.
+     * @param num_elements Length of the statevector data.
+     * @param vjp Preallocated vector receiving the product, one entry per
+     * trainable parameter.
+     * @param dy Cotangent, one weight per observable.
+     * @param observables Observables of the Jacobian rows.
+     * @param operations Operations used to create given state.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @param apply_operations Indicate whether to apply operations to psi prior
+     * to calculation.
+     */
+    void adjointVJP(const std::complex<T> *psi, size_t num_elements,
+                    std::vector<T> &vjp, const std::vector<T> &dy,
+                    const std::vector<ObsDatum<T>> &observables,
+                    const OpsData<T> &operations,
+                    const std::vector<size_t> &trainableParams,
+                    bool apply_operations = false) {
+        PL_ABORT_IF(trainableParams.empty(),
+                    "No trainable parameters provided.");
+        PL_ABORT_IF_NOT(dy.size() == observables.size(),
+                        "The cotangent must have one entry per observable.");
 
-        // Create $U_{1:p}\vert \lambda \rangle$
         StateVectorManaged<T> lambda(psi, num_elements);
-
-        // Apply given operations to statevector if requested
         if (apply_operations) {
             applyOperations(lambda, operations);
         }
 
-        // Create observable-applied state-vectors
-        std::vector<StateVectorManaged<T>> H_lambda(num_observables,
-                                                    {lambda.getNumQubits()});
-        applyObservables(H_lambda, lambda, observables);
-
         StateVectorManaged<T> mu(lambda.getNumQubits());
+        std::vector<StateVectorManaged<T>> H_lambda(1, {lambda.getNumQubits()});
+        applyWeightedObservables(H_lambda[0], lambda, mu, dy, observables);
 
-        for (int op_idx = static_cast<int>(operations.getOpsName().size() - 1);
-             op_idx >= 0; op_idx--) {
-            PL_ABORT_IF(operations.getOpsParams()[op_idx].size() > 1,
-                        "The operation is not supported using the adjoint "
-                        "differentiation method");
-            if ((operations.getOpsName()[op_idx] != "QubitStateVector") &&
-                (operations.getOpsName()[op_idx] != "BasisState")) {
-                mu.updateData(lambda.getDataVector());
-                applyOperationAdj(lambda, operations, op_idx);
+        std::vector<std::vector<T>> jac{std::move(vjp)};
+        adjointBackwardPass(lambda, mu, H_lambda, jac, 0, operations,
+                            getParamColumns(operations, trainableParams));
+        vjp = std::move(jac[0]);
+    }
 
-                if (operations.hasParams(op_idx)) {
-                    if (std::find(trainableParams.begin(), tp_it,
-                                  current_param_idx) != tp_it) {
-                        const T scalingFactor =
-                            applyGenerator(
-                                mu, operations.getOpsName()[op_idx],
-                                operations.getOpsWires()[op_idx],
-                                !operations.getOpsInverses()[op_idx]) *
-                            (2 * (0b1 ^ operations.getOpsInverses()[op_idx]) -
-                             1);
-                        // clang-format off
-
-                        #if defined(_OPENMP)
-                            #pragma omp parallel for default(none)   \
-                            shared(H_lambda, jac, mu, scalingFactor, \
-                                trainableParamNumber, tp_it,         \
-                                num_observables)
-                        #endif
-
-                        // clang-format on
-                        for (size_t obs_idx = 0; obs_idx < num_observables;
-                             obs_idx++) {
-                            updateJacobian(H_lambda[obs_idx], mu, jac,
-                                           scalingFactor, obs_idx,
-                                           trainableParamNumber);
-                        }
-                        trainableParamNumber--;
-                        std::advance(tp_it, -1);
+    /**
+     * @brief Get the largest number of segments of
+     * `adjointJacobianCheckpointed` that keeps it within a memory budget, and
+     * that does not exceed the number of threads.
+     *
+     * @param num_qubits Number of qubits of the statevector.
+     * @param num_observables Number of observables.
+     * @param memory_budget Memory budget in bytes.
+     * @return size_t Value for the `num_segments` argument of
+     * `adjointJacobianCheckpointed`, at least 1.
+     */
+    [[nodiscard]] static auto
+    getMaxCheckpointSegments(size_t num_qubits, size_t num_observables,
+                             size_t memory_budget) -> size_t {
+        const size_t state_bytes =
+            Util::exp2(num_qubits) * sizeof(std::complex<T>);
+        const size_t num_sets =
+            memory_budget / state_bytes / (num_observables + 2);
+        const size_t num_segments = (num_sets > 2) ? num_sets - 1 : 1;
+        return std::min(num_segments, Util::getMaxNumThreads());
+    }
+
+    /**
+     * @brief Calculates the Jacobian like `adjointJacobian`, with the
+     * backward pass split into segments that run in parallel.
+     *
+     * The trainable operations are split into `num_segments` contiguous
+     * groups. A first serial sweep, with the threads of the gate kernels,
+     * stores the forward state and the observable-applied states after the
+     * last operation of every group. The backward passes of the groups then
+     * start from these checkpoints and run concurrently, one per thread, so
+     * that the gradient of a single observable also uses all cores. This
+     * holds at most `(num_segments + 1) * (observables.size() + 2)`
+     * statevectors, and costs about two more passes over the operations
+     * than `adjointJacobian`.
+     *
+     * @param psi Pointer to the statevector data.
+     * @param num_elements Length of the statevector data.
+     * @param jac Preallocated vector for Jacobian data results.
+     * @param observables Observables for which to calculate Jacobian.
+     * @param operations Operations used to create given state.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @param apply_operations Indicate whether to apply operations to psi prior
+     * to calculation.
+     * @param num_segments Number of segments, at most the number of trainable
+     * parameters. Use 0 for one segment per thread.
+     */
+    void adjointJacobianCheckpointed(
+        const std::complex<T> *psi, size_t num_elements,
+        std::vector<std::vector<T>> &jac,
+        const std::vector<ObsDatum<T>> &observables,
+        const OpsData<T> &operations,
+        const std::vector<size_t> &trainableParams,
+        bool apply_operations = false, size_t num_segments = 0) {
+        PL_ABORT_IF(trainableParams.empty(),
+                    "No trainable parameters provided.");
+        const size_t num_ops = operations.getSize();
+
+        // Operations with a trainable parameter
+        const auto op_columns = getParamColumns(operations, trainableParams);
+        std::vector<size_t> trainable_ops;
+        for (size_t op_idx = 0; op_idx < num_ops; op_idx++) {
+            const auto &columns = op_columns[op_idx];
+            if (std::any_of(columns.begin(), columns.end(),
+                            [](size_t c) { return c != NOT_TRAINABLE; })) {
+                trainable_ops.push_back(op_idx);
+            }
+        }
+        if (trainable_ops.empty()) {
+            return;
+        }
+
+        // Segment s differentiates the trainable operations from index
+        // s * n / S to (s + 1) * n / S of `trainable_ops`
+        if (num_segments == 0) {
+            num_segments = Util::getMaxNumThreads();
+        }
+        num_segments = std::min(num_segments, trainable_ops.size());
+        std::vector<size_t> op_begin(num_segments);
+        std::vector<size_t> op_end(num_segments);
+        for (size_t s = 0; s < num_segments; s++) {
+            const size_t first = s * trainable_ops.size() / num_segments;
+            const size_t last = (s + 1) * trainable_ops.size() / num_segments;
+            op_begin[s] = trainable_ops[first];
+            op_end[s] = trainable_ops[last - 1] + 1;
+        }
+
+        // Take the checkpoints of the forward states while applying the
+        // operations, or else while undoing them from psi
+        std::deque<StateVectorManaged<T>> lambdas;
+        std::deque<std::vector<StateVectorManaged<T>>> H_lambdas;
+        StateVectorManaged<T> lambda(psi, num_elements);
+        if (apply_operations) {
+            size_t s = 0;
+            for (size_t op_idx = 0; op_idx < num_ops; op_idx++) {
+                applyOperation(lambda, operations, op_idx);
+                if (s < num_segments && op_end[s] == op_idx + 1) {
+                    lambdas.emplace_back(lambda);
+                    s++;
+                }
+            }
+        }
+        std::vector<StateVectorManaged<T>> H_lambda(observables.size(),
+                                                    {lambda.getNumQubits()});
+        applyObservables(H_lambda, lambda, observables);
+        for (size_t s = num_segments, pos = num_ops;; pos--) {
+            if (pos == op_end[s - 1]) {
+                H_lambdas.emplace_front(H_lambda);
+                if (!apply_operations) {
+                    lambdas.emplace_front(lambda);
+                }
+                if (--s == 0) {
+                    break;
+                }
+            }
+            if (!operations.isStatePreparation(pos - 1)) {
+                if (!apply_operations) {
+                    applyOperationAdj(lambda, operations, pos - 1);
+                }
+                // One state at a time, with the threads of the gate kernels
+                for (auto &h_lambda : H_lambda) {
+                    applyOperationAdj(h_lambda, operations, pos - 1);
+                }
+            }
+        }
+
+        // clang-format off
+        // Globally scoped exception value to be captured within OpenMP block.
+        // See the following for OpenMP design decisions:
+        // https://www.openmp.org/wp-content/uploads/openmp-examples-4.5.0.pdf
+        std::exception_ptr ex = nullptr;
+        // Gate kernels only use their own threads for a single segment
+        const size_t kernel_threads =
+            (num_segments > 1) ? 1 : Util::getMaxNumThreads();
+        #if defined(_OPENMP)
+            #pragma omp parallel default(none)                                 \
+                shared(lambdas, H_lambdas, jac, operations, op_columns,        \
+                       op_begin, op_end, ex, num_segments, kernel_threads)
+        {
+            #pragma omp for schedule(dynamic)
+        #endif
+            for (size_t s = 0; s < num_segments; s++) {
+                try {
+                    lambdas[s].setNumThreads(kernel_threads);
+                    for (auto &h_lambda : H_lambdas[s]) {
+                        h_lambda.setNumThreads(kernel_threads);
                     }
-                    current_param_idx--;
+                    adjointJacobianSegment(lambdas[s], H_lambdas[s], jac,
+                                           operations, op_columns,
+                                           op_begin[s], op_end[s]);
+                } catch (...) {
+                    #if defined(_OPENMP)
+                        #pragma omp critical
+                    #endif
+                    ex = std::current_exception();
+                    #if defined(_OPENMP)
+                        #pragma omp cancel for
+                    #endif
                 }
-                applyOperationsAdj(H_lambda, operations,
-                                   static_cast<size_t>(op_idx));
+            }
+        #if defined(_OPENMP)
+            if (ex) {
+                #pragma omp cancel parallel
             }
         }
+        #endif
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
+        // clang-format on
     }
 };
 
@@ -0,0 +1,196 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines the adjoint Jacobian method for a statevector distributed with MPI.
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <string>
+#include <vector>
+
+#include "AdjointDiff.hpp"
+#include "Error.hpp"
+#include "StateVectorMPI.hpp"
+
+namespace Pennylane::Algorithms {
+
+/**
+ * @brief Adjoint Jacobian method of arXiV:2009.02823 for a `%StateVectorMPI`.
+ *
+ * The calculation follows `%AdjointJacobian`, with every intermediate
+ * statevector distributed like the input state. Generators are applied to the
+ * local statevector after making their wires local, and each Jacobian entry
+ * is one distributed inner product. The observables are processed one after
+ * the other, since all processes must communicate in the same order, and
+ * each process runs the local kernels with the threads of its local
+ * statevector. Every process receives the full Jacobian.
+ *
+ * @tparam T Floating-point precision.
+ */
+template <class T = double>
+class AdjointJacobianMPI : public AdjointJacobian<T> {
+  private:
+    using AdjointJacobian<T>::applyGenerator;
+
+    /**
+     * @brief Apply the generator of a parametric gate to a distributed
+     * statevector.
+     *
+     * @param sv Distributed statevector.
+     * @param op_name Name of parametric gate.
+     * @param wires Wires to operate upon.
+     * @param adj Indicate whether to take the adjoint of the operation.
+     * @return T Generator scaling coefficient.
+     */
+    inline auto applyGenerator(StateVectorMPI<T> &sv,
+                               const std::string &op_name,
+                               const std::vector<size_t> &wires, const bool adj)
+        -> T {
+        T scaling_factor = 0;
+        sv.applyLocal(wires, [&](StateVectorManaged<T> &local,
+                                 const std::vector<size_t> &local_wires) {
+            scaling_factor = applyGenerator(local, op_name, local_wires, adj);
+        });
+        return scaling_factor;
+    }
+
+    /**
+     * @brief Apply the adjoint of the indexed operation.
+     */
+    inline void applyOperationAdj(StateVectorMPI<T> &state,
+                                  const OpsData<T> &operations, size_t op_idx) {
+        state.applyOperation(operations.getOpsName()[op_idx],
+                             operations.getOpsWires()[op_idx],
+                             !operations.getOpsInverses()[op_idx],
+                             operations.getOpsParams()[op_idx]);
+    }
+
+    /**
+     * @brief Run the adjoint backward pass for the observables in
+     * `[obs_begin, obs_end)`, writing their rows of `jac`.
+     */
+    void adjointJacobianChunk(const StateVectorMPI<T> &psi,
+                              std::vector<std::vector<T>> &jac,
+                              const std::vector<ObsDatum<T>> &observables,
+                              size_t obs_begin, size_t obs_end,
+                              const OpsData<T> &operations,
+                              const std::vector<size_t> &trainableParams,
+                              bool apply_operations) {
+        size_t trainableParamNumber = trainableParams.size() - 1;
+        size_t current_param_idx = operations.getNumParOps() - 1;
+        auto tp_it = trainableParams.end();
+
+        StateVectorMPI<T> lambda(psi);
+        if (apply_operations) {
+            lambda.applyOperations(
+                operations.getOpsName(), operations.getOpsWires(),
+                operations.getOpsInverses(), operations.getOpsParams());
+        }
+
+        std::vector<StateVectorMPI<T>> H_lambda(obs_end - obs_begin, lambda);
+        for (size_t obs_idx = obs_begin; obs_idx < obs_end; obs_idx++) {
+            Algorithms::applyObservable(H_lambda[obs_idx - obs_begin],
+                                        observables[obs_idx]);
+        }
+
+        StateVectorMPI<T> mu(lambda);
+
+        for (int op_idx = static_cast<int>(operations.getOpsName().size() - 1);
+             op_idx >= 0; op_idx--) {
+            PL_ABORT_IF(operations.hasParams(op_idx) &&
+                            operations.getOpsParams()[op_idx].size() > 1,
+                        "The operation is not supported using the adjoint "
+                        "differentiation method");
+            if (operations.isStatePreparation(op_idx)) {
+                continue;
+            }
+            mu.updateData(lambda);
+            applyOperationAdj(lambda, operations, op_idx);
+
+            if (operations.hasParams(op_idx)) {
+                if (std::find(trainableParams.begin(), tp_it,
+                              current_param_idx) != tp_it) {
+                    const T scalingFactor =
+                        applyGenerator(mu, operations.getOpsName()[op_idx],
+                                       operations.getOpsWires()[op_idx],
+                                       !operations.getOpsInverses()[op_idx]) *
+                        (2 * (0b1 ^ operations.getOpsInverses()[op_idx]) - 1);
+                    for (size_t obs_idx = obs_begin; obs_idx < obs_end;
+                         obs_idx++) {
+                        const auto &h_lambda = H_lambda[obs_idx - obs_begin];
+                        jac[obs_idx][trainableParamNumber] =
+                            -2 * scalingFactor *
+                            std::imag(h_lambda.innerProduct(mu));
+                    }
+                    trainableParamNumber--;
+                    std::advance(tp_it, -1);
+                }
+                current_param_idx--;
+            }
+            for (auto &h_lambda : H_lambda) {
+                applyOperationAdj(h_lambda, operations,
+                                  static_cast<size_t>(op_idx));
+            }
+        }
+    }
+
+  public:
+    using AdjointJacobian<T>::adjointJacobian;
+
+    /**
+     * @brief Calculates the Jacobian of a distributed statevector for the
+     * selected set of parametric gates.
+     *
+     * @see AdjointJacobian::adjointJacobian for the layout of `jac` and the
+     * meaning of the arguments.
+     *
+     * @param psi Distributed statevector.
+     * @param jac Preallocated vector for Jacobian data results.
+     * @param observables Observables for which to calculate Jacobian.
+     * @param operations Operations used to create given state.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @param apply_operations Indicate whether to apply operations to psi prior
+     * to calculation.
+     * @param max_obs_states Maximum number of observable-applied statevectors
+     * held at once. Use 0 to process all observables together.
+     */
+    void adjointJacobian(const StateVectorMPI<T> &psi,
+                         std::vector<std::vector<T>> &jac,
+                         const std::vector<ObsDatum<T>> &observables,
+                         const OpsData<T> &operations,
+                         const std::vector<size_t> &trainableParams,
+                         bool apply_operations = false,
+                         size_t max_obs_states = 0) {
+        PL_ABORT_IF(trainableParams.empty(),
+                    "No trainable parameters provided.");
+
+        const size_t num_observables = observables.size();
+        const size_t chunk_size =
+            (max_obs_states == 0) ? num_observables : max_obs_states;
+        for (size_t obs_begin = 0; obs_begin < num_observables;
+             obs_begin += chunk_size) {
+            const size_t obs_end =
+                std::min(obs_begin + chunk_size, num_observables);
+            adjointJacobianChunk(psi, jac, observables, obs_begin, obs_end,
+                                 operations, trainableParams,
+                                 apply_operations);
+        }
+    }
+};
+
+} // namespace Pennylane::Algorithms
@@ -0,0 +1,221 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <complex>
+#include <exception>
+#include <vector>
+
+#include "AdjointDiff.hpp"
+#include "Error.hpp"
+#include "StateVectorManaged.hpp"
+#include "Util.hpp"
+
+namespace Pennylane::Algorithms {
+
+/**
+ * @brief Run one circuit for a batch of gate parameter sets.
+ *
+ * The gate sequence is given once as an `%OpsData<T>` object, and each row of
+ * the parameter batch replaces the parameters of its parametric operations, in
+ * order of appearance. Operations without parameters, including those given as
+ * matrices and state preparations, are the same for every batch member, the
+ * latter being applied natively to each member. Batch members are evolved on
+ * their own `%StateVectorManaged<T>` copies of the initial state and are
+ * distributed over OpenMP threads.
+ *
+ * @tparam T Floating-point precision.
+ */
+template <class T = double> class BatchedExecutor {
+  private:
+    /**
+     * @brief Utility method to apply all operations from given `%OpsData<T>`
+     * object to `%StateVectorManaged<T>`, taking the gate parameters from a
+     * batch row.
+     *
+     * @param state Statevector to be updated.
+     * @param operations Operations to apply.
+     * @param params Row of the parameter batch.
+     */
+    inline void applyOperations(StateVectorManaged<T> &state,
+                                const OpsData<T> &operations,
+                                const std::vector<T> &params) {
+        std::vector<T> op_params;
+        size_t param_idx = 0;
+        for (size_t op_idx = 0; op_idx < operations.getSize(); op_idx++) {
+            if (applyStatePreparation(state, operations, op_idx)) {
+                continue;
+            }
+            const auto &matrix = operations.getOpsMatrices()[op_idx];
+            if (!matrix.empty()) {
+                state.applyMatrix(matrix, operations.getOpsWires()[op_idx],
+                                  operations.getOpsInverses()[op_idx]);
+                continue;
+            }
+            const size_t num_params = operations.getOpsParams()[op_idx].size();
+            op_params.assign(params.begin() + param_idx,
+                             params.begin() + param_idx + num_params);
+            param_idx += num_params;
+            state.applyOperation(operations.getOpsGates()[op_idx],
+                                 operations.getOpsWires()[op_idx],
+                                 operations.getOpsInverses()[op_idx],
+                                 op_params);
+        }
+    }
+
+    /**
+     * @brief OpenMP accelerated execution of every batch member. The final
+     * state of each member is passed to `process` together with its batch
+     * index.
+     *
+     * @param psi Pointer to the initial statevector data.
+     * @param num_elements Length of the statevector data.
+     * @param operations Operations to apply.
+     * @param param_batch Gate parameters, one row per batch member.
+     * @param process Callable receiving the batch index and final state.
+     */
+    template <class Process>
+    void execute(const std::complex<T> *psi, size_t num_elements,
+                 const OpsData<T> &operations,
+                 const std::vector<std::vector<T>> &param_batch,
+                 Process &&process) {
+        const size_t num_params = getNumBatchParams(operations);
+        for (const auto &params : param_batch) {
+            PL_ABORT_IF_NOT(params.size() == num_params,
+                            "Each parameter set must provide one value per "
+                            "gate parameter of the operations.");
+        }
+
+        // clang-format off
+        // Globally scoped exception value to be captured within OpenMP block.
+        // See the following for OpenMP design decisions:
+        // https://www.openmp.org/wp-content/uploads/openmp-examples-4.5.0.pdf
+        std::exception_ptr ex = nullptr;
+        const size_t batch_size = param_batch.size();
+        // Gate kernels only use their own threads for a single batch member
+        const size_t kernel_threads =
+            (batch_size > 1) ? 1 : Util::getMaxNumThreads();
+        #if defined(_OPENMP)
+            #pragma omp parallel default(none)                                 \
+                shared(psi, num_elements, operations, param_batch, process,    \
+                       ex, batch_size, kernel_threads)
+        {
+            #pragma omp for schedule(dynamic)
+        #endif
+            for (size_t b = 0; b < batch_size; b++) {
+                try {
+                    StateVectorManaged<T> state(psi, num_elements);
+                    state.setNumThreads(kernel_threads);
+                    applyOperations(state, operations, param_batch[b]);
+                    process(b, state);
+                } catch (...) {
+                    #if defined(_OPENMP)
+                        #pragma omp critical
+                    #endif
+                    ex = std::current_exception();
+                    #if defined(_OPENMP)
+                        #pragma omp cancel for
+                    #endif
+                }
+            }
+        #if defined(_OPENMP)
+            if (ex) {
+                #pragma omp cancel parallel
+            }
+        }
+        #endif
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
+        // clang-format on
+    }
+
+  public:
+    BatchedExecutor() = default;
+
+    /**
+     * @brief Get the number of gate parameters each row of a parameter batch
+     * must provide for the given operations.
+     *
+     * @param operations Operations to apply.
+     * @return size_t
+     */
+    [[nodiscard]] static auto getNumBatchParams(const OpsData<T> &operations)
+        -> size_t {
+        size_t num_params = 0;
+        for (size_t op_idx = 0; op_idx < operations.getSize(); op_idx++) {
+            if (operations.getOpsMatrices()[op_idx].empty() &&
+                !operations.isStatePreparation(op_idx)) {
+                num_params += operations.getOpsParams()[op_idx].size();
+            }
+        }
+        return num_params;
+    }
+
+    /**
+     * @brief Calculate the final statevector of every batch member.
+     *
+     * @param psi Pointer to the initial statevector data.
+     * @param num_elements Length of the statevector data.
+     * @param operations Operations to apply.
+     * @param param_batch Gate parameters, one row per batch member.
+     * @return std::vector<std::vector<std::complex<T>>> Final statevector of
+     * each batch member.
+     */
+    auto executeStates(const std::complex<T> *psi, size_t num_elements,
+                       const OpsData<T> &operations,
+                       const std::vector<std::vector<T>> &param_batch)
+        -> std::vector<std::vector<std::complex<T>>> {
+        std::vector<std::vector<std::complex<T>>> states(param_batch.size());
+        execute(psi, num_elements, operations, param_batch,
+                [&states](size_t b, StateVectorManaged<T> &state) {
+                    states[b] = std::move(state.getDataVector());
+                });
+        return states;
+    }
+
+    /**
+     * @brief Calculate the expectation values of the observables for every
+     * batch member.
+     *
+     * @param psi Pointer to the initial statevector data.
+     * @param num_elements Length of the statevector data.
+     * @param observables Observables to measure.
+     * @param operations Operations to apply.
+     * @param param_batch Gate parameters, one row per batch member.
+     * @return std::vector<std::vector<T>> Expectation values, with one row per
+     * batch member and one column per observable.
+     */
+    auto executeExpval(const std::complex<T> *psi, size_t num_elements,
+                       const std::vector<ObsDatum<T>> &observables,
+                       const OpsData<T> &operations,
+                       const std::vector<std::vector<T>> &param_batch)
+        -> std::vector<std::vector<T>> {
+        std::vector<std::vector<T>> expvals(
+            param_batch.size(), std::vector<T>(observables.size(), 0));
+        execute(psi, num_elements, operations, param_batch,
+                [&](size_t b, StateVectorManaged<T> &state) {
+                    StateVectorManaged<T> obs_state(state);
+                    for (size_t o = 0; o < observables.size(); o++) {
+                        obs_state.updateData(state.getDataVector());
+                        applyObservable(obs_state, observables[o]);
+                        expvals[b][o] = std::real(Util::innerProdC(
+                            state.getDataVector(), obs_state.getDataVector()));
+                    }
+                });
+        return expvals;
+    }
+};
+
+} // namespace Pennylane::Algorithms
@@ -0,0 +1,634 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines expectation values and variances of Pauli words and Hamiltonians
+ * built from them, of dense Hermitian matrices and of sparse Hamiltonians,
+ * computed directly from the statevector amplitudes.
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Error.hpp"
+#include "StateVector.hpp"
+#include "Util.hpp"
+
+namespace Pennylane::Algorithms {
+
+/**
+ * @brief Pauli word encoded as bit masks over the statevector indices.
+ *
+ * A Pauli word acts on the computational basis as
+ * \f$P|j\rangle = i^{n_Y} (-1)^{|j \wedge z|} |j \oplus x\rangle\f$, where the
+ * mask \f$x\f$ marks the wires acted on by X or Y, \f$z\f$ those acted on by Z
+ * or Y, and \f$n_Y\f$ is the number of Y factors.
+ */
+class PauliWord {
+  private:
+    size_t x_mask_{0};
+    size_t z_mask_{0};
+    size_t num_y_{0};
+
+  public:
+    /**
+     * @brief Construct a Pauli word from its single-qubit factors.
+     *
+     * @param paulis Name of each factor: `Identity`, `PauliX`, `PauliY` or
+     * `PauliZ`.
+     * @param wires Wire of each factor.
+     * @param num_qubits Number of qubits of the statevector.
+     */
+    PauliWord(const std::vector<std::string> &paulis,
+              const std::vector<size_t> &wires, size_t num_qubits) {
+        PL_ABORT_IF_NOT(paulis.size() == wires.size(),
+                        "Each Pauli factor must act on exactly one wire.");
+        size_t used_mask = 0;
+        for (size_t i = 0; i < paulis.size(); i++) {
+            PL_ABORT_IF_NOT(wires[i] < num_qubits,
+                            "Pauli factor wire is out of range.");
+            const size_t bit = static_cast<size_t>(1U)
+                               << (num_qubits - 1 - wires[i]);
+            PL_ABORT_IF((used_mask & bit) != 0,
+                        "Each wire may only appear once in a Pauli word.");
+            used_mask |= bit;
+
+            if (paulis[i] == "PauliX") {
+                x_mask_ |= bit;
+            } else if (paulis[i] == "PauliY") {
+                x_mask_ |= bit;
+                z_mask_ |= bit;
+                num_y_++;
+            } else if (paulis[i] == "PauliZ") {
+                z_mask_ |= bit;
+            } else {
+                PL_ABORT_IF_NOT(paulis[i] == "Identity",
+                                "Unsupported Pauli factor.");
+            }
+        }
+    }
+
+    /**
+     * @brief Get the mask of the bits flipped by the word.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getXMask() const -> size_t { return x_mask_; }
+
+    /**
+     * @brief Get the mask of the bits contributing a sign.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getZMask() const -> size_t { return z_mask_; }
+
+    /**
+     * @brief Get the number of Y factors.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getNumY() const -> size_t { return num_y_; }
+};
+
+/**
+ * @brief Real linear combination of Pauli words.
+ *
+ * @tparam T Floating-point precision.
+ */
+template <class T = double> class Hamiltonian {
+  private:
+    std::vector<T> coeffs_;
+    std::vector<PauliWord> words_;
+
+  public:
+    /**
+     * @brief Construct a Hamiltonian from its terms.
+     *
+     * @param coeffs Coefficient of each term.
+     * @param words Pauli word of each term.
+     */
+    Hamiltonian(std::vector<T> coeffs, std::vector<PauliWord> words)
+        : coeffs_{std::move(coeffs)}, words_{std::move(words)} {
+        PL_ABORT_IF_NOT(coeffs_.size() == words_.size(),
+                        "Each Pauli word requires exactly one coefficient.");
+    }
+
+    /**
+     * @brief Get the number of terms.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getSize() const -> size_t { return words_.size(); }
+
+    /**
+     * @brief Get the coefficients of the terms.
+     *
+     * @return const std::vector<T>&
+     */
+    [[nodiscard]] auto getCoeffs() const -> const std::vector<T> & {
+        return coeffs_;
+    }
+
+    /**
+     * @brief Get the Pauli words of the terms.
+     *
+     * @return const std::vector<PauliWord>&
+     */
+    [[nodiscard]] auto getWords() const -> const std::vector<PauliWord> & {
+        return words_;
+    }
+};
+
+/**
+ * @brief Hamiltonian over all qubits of the statevector, stored as a complex
+ * matrix in compressed sparse row (CSR) format. Row and column indices follow
+ * the statevector indexing, where wire 0 is the most significant bit.
+ *
+ * @tparam T Floating-point precision.
+ */
+template <class T = double> class SparseHamiltonian {
+  private:
+    std::vector<std::complex<T>> data_;
+    std::vector<size_t> indices_;
+    std::vector<size_t> indptr_;
+
+  public:
+    /**
+     * @brief Construct a sparse Hamiltonian from its CSR arrays.
+     *
+     * @param data Non-zero entries, row by row.
+     * @param indices Column index of each non-zero entry.
+     * @param indptr Offset of the first entry of each row in `data`, followed
+     * by the number of entries.
+     */
+    SparseHamiltonian(std::vector<std::complex<T>> data,
+                      std::vector<size_t> indices, std::vector<size_t> indptr)
+        : data_{std::move(data)}, indices_{std::move(indices)},
+          indptr_{std::move(indptr)} {
+        PL_ABORT_IF(indptr_.size() < 2, "The matrix must have rows.");
+        const size_t dim = indptr_.size() - 1;
+        PL_ABORT_IF_NOT(Util::exp2(Util::log2(dim)) == dim,
+                        "The matrix dimension must be a power of 2.");
+        PL_ABORT_IF_NOT(data_.size() == indices_.size(),
+                        "Each entry requires exactly one column index.");
+        PL_ABORT_IF_NOT(indptr_.front() == 0 &&
+                            indptr_.back() == data_.size() &&
+                            std::is_sorted(indptr_.begin(), indptr_.end()),
+                        "The row offsets are inconsistent with the entries.");
+        PL_ABORT_IF_NOT(std::all_of(indices_.begin(), indices_.end(),
+                                    [dim](size_t col) { return col < dim; }),
+                        "Column index is out of range.");
+    }
+
+    /**
+     * @brief Get the number of rows and columns.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getDim() const -> size_t { return indptr_.size() - 1; }
+
+    /**
+     * @brief Get the number of qubits acted on.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t {
+        return Util::log2(getDim());
+    }
+
+    /**
+     * @brief Get the non-zero entries.
+     *
+     * @return const std::vector<std::complex<T>>&
+     */
+    [[nodiscard]] auto getData() const
+        -> const std::vector<std::complex<T>> & {
+        return data_;
+    }
+
+    /**
+     * @brief Get the column index of each non-zero entry.
+     *
+     * @return const std::vector<size_t>&
+     */
+    [[nodiscard]] auto getIndices() const -> const std::vector<size_t> & {
+        return indices_;
+    }
+
+    /**
+     * @brief Get the row offsets.
+     *
+     * @return const std::vector<size_t>&
+     */
+    [[nodiscard]] auto getIndptr() const -> const std::vector<size_t> & {
+        return indptr_;
+    }
+};
+
+/// @cond DEV
+namespace Internal {
+
+/**
+ * @brief Pauli term with its coefficient and Y phase folded into one complex
+ * weight.
+ */
+template <class T> struct WeightedPauliTerm {
+    std::complex<T> weight;
+    size_t z_mask;
+};
+
+/**
+ * @brief Pauli terms sharing the same flipped bits. All of them pair each
+ * amplitude with the same partner, so a group is handled in one pass over the
+ * statevector.
+ */
+template <class T> struct PauliTermGroup {
+    size_t x_mask;
+    std::vector<WeightedPauliTerm<T>> terms;
+};
+
+/**
+ * @brief Sort the terms of a Hamiltonian into groups of equal X mask.
+ */
+template <class T>
+auto groupPauliTerms(const Hamiltonian<T> &ham)
+    -> std::vector<PauliTermGroup<T>> {
+    // Powers of the imaginary unit
+    const std::vector<std::complex<T>> phases{
+        Util::ONE<T>(), Util::IMAG<T>(), -Util::ONE<T>(), -Util::IMAG<T>()};
+
+    std::vector<size_t> order(ham.getSize());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return ham.getWords()[a].getXMask() < ham.getWords()[b].getXMask();
+    });
+
+    std::vector<PauliTermGroup<T>> groups;
+    for (const size_t t : order) {
+        const PauliWord &word = ham.getWords()[t];
+        if (groups.empty() || groups.back().x_mask != word.getXMask()) {
+            groups.push_back({word.getXMask(), {}});
+        }
+        groups.back().terms.push_back(
+            {ham.getCoeffs()[t] * phases[word.getNumY() % 4],
+             word.getZMask()});
+    }
+    return groups;
+}
+
+/**
+ * @brief Sum of the weighted signs of all terms of a group for basis index
+ * `j`.
+ */
+template <class T>
+inline auto groupWeight(const std::vector<WeightedPauliTerm<T>> &terms,
+                        size_t j) -> std::complex<T> {
+    std::complex<T> weight{0, 0};
+    for (const auto &term : terms) {
+        if ((Util::popcount(j & term.z_mask) & 1U) != 0) {
+            weight -= term.weight;
+        } else {
+            weight += term.weight;
+        }
+    }
+    return weight;
+}
+
+/**
+ * @brief Calculate \f$\langle\psi|\sum_t c_t P_t|\psi\rangle\f$ for one group
+ * of terms without copying the statevector.
+ */
+template <class T>
+auto expvalGroup(const StateVector<T> &sv, const PauliTermGroup<T> &group)
+    -> Util::accumulator_t<T> {
+    const std::complex<T> *arr = sv.getData();
+    const size_t length = sv.getLength();
+    const size_t x_mask = group.x_mask;
+    const auto &terms = group.terms;
+    Util::accumulator_t<T> result = 0;
+
+#if defined(_OPENMP)
+    const bool parallel = length >= sv.getParallelThreshold();
+#pragma omp parallel for num_threads(sv.getNumThreads()) if (parallel)        \
+    default(none) shared(arr, length, x_mask, terms) reduction(+ : result)
+#endif
+    for (size_t j = 0; j < length; j++) {
+        const std::complex<T> pair = std::conj(arr[j ^ x_mask]) * arr[j];
+        result += std::real(groupWeight(terms, j) * pair);
+    }
+    return result;
+}
+
+/**
+ * @brief Accumulate the action of one group of terms on the statevector into
+ * `out`.
+ */
+template <class T>
+void applyGroup(const StateVector<T> &sv, const PauliTermGroup<T> &group,
+                std::complex<T> *out) {
+    const std::complex<T> *arr = sv.getData();
+    const size_t length = sv.getLength();
+    const size_t x_mask = group.x_mask;
+    const auto &terms = group.terms;
+
+    // Every output index is written by exactly one input index
+#if defined(_OPENMP)
+    const bool parallel = length >= sv.getParallelThreshold();
+#pragma omp parallel for num_threads(sv.getNumThreads()) if (parallel)        \
+    default(none) shared(arr, length, x_mask, terms, out)
+#endif
+    for (size_t j = 0; j < length; j++) {
+        out[j ^ x_mask] += groupWeight(terms, j) * arr[j];
+    }
+}
+
+/**
+ * @brief Calculate one row of \f$H|\psi\rangle\f$ for a sparse Hamiltonian.
+ */
+template <class T>
+inline auto sparseRow(const SparseHamiltonian<T> &ham,
+                      const std::complex<T> *arr, size_t row)
+    -> std::complex<T> {
+    const std::complex<T> *data = ham.getData().data();
+    const size_t *indices = ham.getIndices().data();
+    const size_t end = ham.getIndptr()[row + 1];
+    std::complex<T> sum{0, 0};
+    for (size_t k = ham.getIndptr()[row]; k < end; k++) {
+        sum += data[k] * arr[indices[k]];
+    }
+    return sum;
+}
+
+/**
+ * @brief Check that a sparse Hamiltonian acts on the whole statevector.
+ */
+template <class T>
+void checkSparseDim(const StateVector<T> &sv,
+                    const SparseHamiltonian<T> &ham) {
+    PL_ABORT_IF_NOT(ham.getDim() == sv.getLength(),
+                    "The sparse Hamiltonian must act on all qubits of the "
+                    "statevector.");
+}
+
+/**
+ * @brief Calculate \f$\langle\psi|M|\psi\rangle\f$ for a dense matrix
+ * acting on some wires, gathering the amplitudes of each block in place rather
+ * than copying the statevector.
+ */
+template <class T>
+auto expvalDenseMatrix(const StateVector<T> &sv,
+                       const std::vector<std::complex<T>> &matrix,
+                       const std::vector<size_t> &wires)
+    -> Util::accumulator_t<T> {
+    const size_t num_qubits = sv.getNumQubits();
+    const size_t dim = Util::exp2(wires.size());
+    PL_ABORT_IF_NOT(matrix.size() == dim * dim,
+                    "The matrix size does not match the number of wires.");
+    const std::vector<size_t> internal =
+        StateVector<T>::generateBitPatterns(wires, num_qubits);
+    const std::vector<size_t> external = StateVector<T>::generateBitPatterns(
+        StateVector<T>::getIndicesAfterExclusion(wires, num_qubits),
+        num_qubits);
+    const std::complex<T> *arr = sv.getData();
+    const std::complex<T> *mat = matrix.data();
+    const size_t num_blocks = external.size();
+    Util::accumulator_t<T> result = 0;
+
+#if defined(_OPENMP)
+    const bool parallel = sv.getLength() >= sv.getParallelThreshold();
+#pragma omp parallel num_threads(sv.getNumThreads()) if (parallel)            \
+    default(none) shared(arr, mat, dim, internal, external, num_blocks)        \
+    reduction(+ : result)
+#endif
+    {
+        std::vector<std::complex<T>> v(dim);
+#if defined(_OPENMP)
+#pragma omp for
+#endif
+        for (size_t b = 0; b < num_blocks; b++) {
+            const std::complex<T> *block = arr + external[b];
+            for (size_t i = 0; i < dim; i++) {
+                v[i] = block[internal[i]];
+            }
+            for (size_t i = 0; i < dim; i++) {
+                std::complex<T> row{0, 0};
+                for (size_t j = 0; j < dim; j++) {
+                    row += mat[i * dim + j] * v[j];
+                }
+                result += std::real(std::conj(v[i]) * row);
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace Internal
+/// @endcond
+
+/**
+ * @brief Calculate \f$H|\psi\rangle\f$ for a sparse Hamiltonian with a
+ * row-parallel sparse matrix-vector product. Rows hold different numbers of
+ * entries, so they are scheduled dynamically between threads.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Statevector.
+ * @param ham Sparse Hamiltonian of the statevector size.
+ * @param out Buffer of the statevector size receiving the result. It must not
+ * alias the statevector.
+ */
+template <class T>
+void applySparseHamiltonian(const StateVector<T> &sv,
+                            const SparseHamiltonian<T> &ham,
+                            std::complex<T> *out) {
+    Internal::checkSparseDim(sv, ham);
+    const std::complex<T> *arr = sv.getData();
+    const size_t length = sv.getLength();
+
+#if defined(_OPENMP)
+    const bool parallel = length >= sv.getParallelThreshold();
+#pragma omp parallel for num_threads(sv.getNumThreads()) if (parallel)        \
+    schedule(dynamic, 256) default(none) shared(arr, ham, length, out)
+#endif
+    for (size_t row = 0; row < length; row++) {
+        out[row] = Internal::sparseRow(ham, arr, row);
+    }
+}
+
+/**
+ * @brief Calculate the expectation value of a sparse Hamiltonian in a single
+ * pass, without storing \f$H|\psi\rangle\f$.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Statevector.
+ * @param ham Sparse Hamiltonian of the statevector size.
+ * @return T Expectation value.
+ */
+template <class T>
+auto expval(const StateVector<T> &sv, const SparseHamiltonian<T> &ham) -> T {
+    Internal::checkSparseDim(sv, ham);
+    const std::complex<T> *arr = sv.getData();
+    const size_t length = sv.getLength();
+    Util::accumulator_t<T> result = 0;
+
+#if defined(_OPENMP)
+    const bool parallel = length >= sv.getParallelThreshold();
+#pragma omp parallel for num_threads(sv.getNumThreads()) if (parallel)        \
+    schedule(dynamic, 256) default(none) shared(arr, ham, length)              \
+    reduction(+ : result)
+#endif
+    for (size_t row = 0; row < length; row++) {
+        result +=
+            std::real(std::conj(arr[row]) * Internal::sparseRow(ham, arr, row));
+    }
+    return static_cast<T>(result);
+}
+
+/**
+ * @brief Calculate the variance of a sparse Hamiltonian as
+ * \f$\|H|\psi\rangle\|^2 - \langle\psi|H|\psi\rangle^2\f$, in a single pass
+ * without storing \f$H|\psi\rangle\f$.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Statevector.
+ * @param ham Sparse Hamiltonian of the statevector size.
+ * @return T Variance.
+ */
+template <class T>
+auto var(const StateVector<T> &sv, const SparseHamiltonian<T> &ham) -> T {
+    Internal::checkSparseDim(sv, ham);
+    const std::complex<T> *arr = sv.getData();
+    const size_t length = sv.getLength();
+    Util::accumulator_t<T> mean = 0;
+    Util::accumulator_t<T> mean_sq = 0;
+
+#if defined(_OPENMP)
+    const bool parallel = length >= sv.getParallelThreshold();
+#pragma omp parallel for num_threads(sv.getNumThreads()) if (parallel)        \
+    schedule(dynamic, 256) default(none) shared(arr, ham, length)              \
+    reduction(+ : mean, mean_sq)
+#endif
+    for (size_t row = 0; row < length; row++) {
+        const std::complex<T> h_psi = Internal::sparseRow(ham, arr, row);
+        mean += std::real(std::conj(arr[row]) * h_psi);
+        mean_sq += std::norm(h_psi);
+    }
+    return static_cast<T>(mean_sq - mean * mean);
+}
+
+/**
+ * @brief Calculate the expectation value of a dense Hermitian matrix acting on
+ * some wires, without copying the statevector.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Statevector.
+ * @param matrix Hermitian matrix in row-major order of dimension
+ * `2^wires.size()`.
+ * @param wires Wires the matrix acts on.
+ * @return T Expectation value.
+ */
+template <class T>
+auto expval(const StateVector<T> &sv,
+            const std::vector<std::complex<T>> &matrix,
+            const std::vector<size_t> &wires) -> T {
+    return static_cast<T>(Internal::expvalDenseMatrix(sv, matrix, wires));
+}
+
+/**
+ * @brief Calculate the expectation value of a Hamiltonian. Terms flipping the
+ * same bits are evaluated together in a single pass over the statevector, and
+ * no copy of the statevector is made.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Statevector.
+ * @param ham Hamiltonian.
+ * @return T Expectation value.
+ */
+template <class T>
+auto expval(const StateVector<T> &sv, const Hamiltonian<T> &ham) -> T {
+    Util::accumulator_t<T> result = 0;
+    for (const auto &group : Internal::groupPauliTerms(ham)) {
+        result += Internal::expvalGroup(sv, group);
+    }
+    return static_cast<T>(result);
+}
+
+/**
+ * @brief Calculate the expectation value of a Pauli word without copying the
+ * statevector.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Statevector.
+ * @param word Pauli word.
+ * @return T Expectation value.
+ */
+template <class T>
+auto expval(const StateVector<T> &sv, const PauliWord &word) -> T {
+    return expval(sv, Hamiltonian<T>{{1}, {word}});
+}
+
+/**
+ * @brief Calculate the variance of a Hamiltonian as
+ * \f$\|H|\psi\rangle\|^2 - \langle\psi|H|\psi\rangle^2\f$. This requires one
+ * buffer of the statevector size for \f$H|\psi\rangle\f$.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Statevector.
+ * @param ham Hamiltonian.
+ * @return T Variance.
+ */
+template <class T>
+auto var(const StateVector<T> &sv, const Hamiltonian<T> &ham) -> T {
+    const size_t length = sv.getLength();
+    std::vector<std::complex<T>> h_psi(length, {0, 0});
+    for (const auto &group : Internal::groupPauliTerms(ham)) {
+        Internal::applyGroup(sv, group, h_psi.data());
+    }
+
+    const std::complex<T> *arr = sv.getData();
+    const std::complex<T> *out = h_psi.data();
+    Util::accumulator_t<T> mean = 0;
+    Util::accumulator_t<T> mean_sq = 0;
+#if defined(_OPENMP)
+    const bool parallel = length >= sv.getParallelThreshold();
+#pragma omp parallel for num_threads(sv.getNumThreads()) if (parallel)        \
+    default(none) shared(arr, out, length) reduction(+ : mean, mean_sq)
+#endif
+    for (size_t j = 0; j < length; j++) {
+        mean += std::real(std::conj(arr[j]) * out[j]);
+        mean_sq += std::norm(out[j]);
+    }
+    return static_cast<T>(mean_sq - mean * mean);
+}
+
+/**
+ * @brief Calculate the variance of a Pauli word. As \f$P^2 = I\f$, this is
+ * \f$1 - \langle P\rangle^2\f$ and needs no copy of the statevector.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Statevector.
+ * @param word Pauli word.
+ * @return T Variance.
+ */
+template <class T>
+auto var(const StateVector<T> &sv, const PauliWord &word) -> T {
+    const T mean = expval(sv, word);
+    return static_cast<T>(1) - mean * mean;
+}
+
+} // namespace Pennylane::Algorithms
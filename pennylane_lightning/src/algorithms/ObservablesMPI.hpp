@@ -0,0 +1,240 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines expectation values and variances of Pauli words and Hamiltonians
+ * over a statevector distributed with MPI.
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include <mpi.h>
+
+#include "Observables.hpp"
+#include "StateVectorMPI.hpp"
+#include "Util.hpp"
+
+namespace Pennylane::Algorithms {
+
+/// @cond DEV
+namespace Internal {
+
+/**
+ * @brief Get the amplitudes paired by an X mask with a chunk of the local
+ * amplitudes.
+ *
+ * The partner of full index `j` is `j ^ x_mask`. If the mask flips global
+ * bits, the partners live on the process whose rank differs by those bits,
+ * and both processes exchange the chunks the other one needs.
+ *
+ * @param sv Distributed statevector.
+ * @param x_mask Flipped bits of the full index.
+ * @param begin Local index of the first amplitude of the chunk, a multiple of
+ * `count`.
+ * @param count Power-of-two number of amplitudes of the chunk.
+ * @param buffer Receive buffer of `count` elements.
+ * @return const std::complex<T>* Pointer `p` such that `p[i ^ (x_mask &
+ * (count - 1))]` is the partner amplitude of local index `begin + i`.
+ */
+template <class T>
+auto getPartnerChunk(const StateVectorMPI<T> &sv, size_t x_mask, size_t begin,
+                     size_t count, std::vector<std::complex<T>> &buffer)
+    -> const std::complex<T> * {
+    const size_t local_length = sv.getLocal().getLength();
+    const size_t x_global = x_mask >> sv.getNumLocalQubits();
+    const size_t partner_begin = begin ^ (x_mask & (local_length - count));
+    const std::complex<T> *partner_chunk =
+        sv.getLocal().getData() + partner_begin;
+    if (x_global == 0) {
+        return partner_chunk;
+    }
+    const auto partner = static_cast<int>(sv.getRank() ^ x_global);
+    const MPI_Datatype datatype = Util::getMPIDatatype<std::complex<T>>();
+    MPI_Sendrecv(partner_chunk, static_cast<int>(count), datatype, partner, 0,
+                 buffer.data(), static_cast<int>(count), datatype, partner, 0,
+                 sv.getComm(), MPI_STATUS_IGNORE);
+    return buffer.data();
+}
+
+/**
+ * @brief Number of local amplitudes processed per partner chunk.
+ */
+template <class T>
+auto getPartnerChunkSize(const StateVectorMPI<T> &sv) -> size_t {
+    return std::min(StateVectorMPI<T>::EXCHANGE_CHUNK_ELEMENTS,
+                    sv.getLocal().getLength());
+}
+
+/**
+ * @brief Calculate the contribution of this process to
+ * \f$\langle\psi|\sum_t c_t P_t|\psi\rangle\f$ for one group of terms.
+ */
+template <class T>
+auto expvalGroup(const StateVectorMPI<T> &sv, const PauliTermGroup<T> &group)
+    -> Util::accumulator_t<T> {
+    const StateVector<T> &local = sv.getLocal();
+    const size_t count = getPartnerChunkSize(sv);
+    const size_t offset = sv.getLocalOffset();
+    const size_t x_mask = group.x_mask;
+    const size_t x_chunk = x_mask & (count - 1);
+    const auto &terms = group.terms;
+    std::vector<std::complex<T>> buffer(count);
+    Util::accumulator_t<T> result = 0;
+
+    for (size_t begin = 0; begin < local.getLength(); begin += count) {
+        const std::complex<T> *partner =
+            getPartnerChunk(sv, x_mask, begin, count, buffer);
+        const std::complex<T> *arr = local.getData() + begin;
+        const size_t first = offset + begin;
+#if defined(_OPENMP)
+        const bool parallel = count >= local.getParallelThreshold();
+#pragma omp parallel for num_threads(local.getNumThreads()) if (parallel)     \
+    default(none) shared(arr, partner, count, first, x_chunk, terms)          \
+    reduction(+ : result)
+#endif
+        for (size_t i = 0; i < count; i++) {
+            const std::complex<T> pair =
+                std::conj(partner[i ^ x_chunk]) * arr[i];
+            result += std::real(groupWeight(terms, first + i) * pair);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Accumulate the action of one group of terms into the local part
+ * `out` of the distributed result.
+ */
+template <class T>
+void applyGroup(const StateVectorMPI<T> &sv, const PauliTermGroup<T> &group,
+                std::complex<T> *out) {
+    const StateVector<T> &local = sv.getLocal();
+    const size_t count = getPartnerChunkSize(sv);
+    const size_t offset = sv.getLocalOffset();
+    const size_t x_mask = group.x_mask;
+    const size_t x_chunk = x_mask & (count - 1);
+    const auto &terms = group.terms;
+    std::vector<std::complex<T>> buffer(count);
+
+    // Output index j receives the term of its partner j ^ x_mask
+    for (size_t begin = 0; begin < local.getLength(); begin += count) {
+        const std::complex<T> *partner =
+            getPartnerChunk(sv, x_mask, begin, count, buffer);
+        std::complex<T> *dst = out + begin;
+        const size_t first = offset + begin;
+#if defined(_OPENMP)
+        const bool parallel = count >= local.getParallelThreshold();
+#pragma omp parallel for num_threads(local.getNumThreads()) if (parallel)     \
+    default(none) shared(dst, partner, count, first, x_mask, x_chunk, terms)
+#endif
+        for (size_t i = 0; i < count; i++) {
+            dst[i] += groupWeight(terms, (first + i) ^ x_mask) *
+                      partner[i ^ x_chunk];
+        }
+    }
+}
+
+} // namespace Internal
+/// @endcond
+
+/**
+ * @brief Calculate the expectation value of a Hamiltonian over a distributed
+ * statevector. Groups flipping only local bits need no communication, the
+ * others exchange chunks of amplitudes with one partner process. The result
+ * is returned on every process.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Distributed statevector.
+ * @param ham Hamiltonian over all qubits of the statevector.
+ * @return T Expectation value.
+ */
+template <class T>
+auto expval(const StateVectorMPI<T> &sv, const Hamiltonian<T> &ham) -> T {
+    Util::accumulator_t<T> result = 0;
+    for (const auto &group : Internal::groupPauliTerms(ham)) {
+        result += Internal::expvalGroup(sv, group);
+    }
+    return static_cast<T>(sv.allreduceSum(result));
+}
+
+/**
+ * @brief Calculate the expectation value of a Pauli word over a distributed
+ * statevector.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Distributed statevector.
+ * @param word Pauli word over all qubits of the statevector.
+ * @return T Expectation value.
+ */
+template <class T>
+auto expval(const StateVectorMPI<T> &sv, const PauliWord &word) -> T {
+    return expval(sv, Hamiltonian<T>{{1}, {word}});
+}
+
+/**
+ * @brief Calculate the variance of a Hamiltonian over a distributed
+ * statevector. Each process holds one local buffer for its part of
+ * \f$H|\psi\rangle\f$.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Distributed statevector.
+ * @param ham Hamiltonian over all qubits of the statevector.
+ * @return T Variance.
+ */
+template <class T>
+auto var(const StateVectorMPI<T> &sv, const Hamiltonian<T> &ham) -> T {
+    const StateVector<T> &local = sv.getLocal();
+    const size_t length = local.getLength();
+    std::vector<std::complex<T>> h_psi(length, {0, 0});
+    for (const auto &group : Internal::groupPauliTerms(ham)) {
+        Internal::applyGroup(sv, group, h_psi.data());
+    }
+
+    const std::complex<T> *arr = local.getData();
+    const std::complex<T> *out = h_psi.data();
+    Util::accumulator_t<T> mean = 0;
+    Util::accumulator_t<T> mean_sq = 0;
+#if defined(_OPENMP)
+    const bool parallel = length >= local.getParallelThreshold();
+#pragma omp parallel for num_threads(local.getNumThreads()) if (parallel)     \
+    default(none) shared(arr, out, length) reduction(+ : mean, mean_sq)
+#endif
+    for (size_t j = 0; j < length; j++) {
+        mean += std::real(std::conj(arr[j]) * out[j]);
+        mean_sq += std::norm(out[j]);
+    }
+    mean = sv.allreduceSum(mean);
+    mean_sq = sv.allreduceSum(mean_sq);
+    return static_cast<T>(mean_sq - mean * mean);
+}
+
+/**
+ * @brief Calculate the variance of a Pauli word over a distributed
+ * statevector as \f$1 - \langle P\rangle^2\f$.
+ *
+ * @tparam T Floating-point precision.
+ * @param sv Distributed statevector.
+ * @param word Pauli word over all qubits of the statevector.
+ * @return T Variance.
+ */
+template <class T>
+auto var(const StateVectorMPI<T> &sv, const PauliWord &word) -> T {
+    const T mean = expval(sv, word);
+    return static_cast<T>(1) - mean * mean;
+}
+
+} // namespace Pennylane::Algorithms
@@ -0,0 +1,196 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines computational basis sampling of a statevector.
+ */
+#pragma once
+
+#include <climits>
+#include <complex>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "Error.hpp"
+#include "StateVector.hpp"
+#include "Util.hpp"
+
+namespace Pennylane::Algorithms {
+
+/**
+ * @brief Draw computational basis samples from a statevector.
+ *
+ * The constructor builds a Walker/Vose alias table of the measurement
+ * distribution in \f$O(2^n)\f$, after which every sample costs one table
+ * lookup. The table is independent of the statevector once built, so the same
+ * sampler can be drawn from repeatedly.
+ *
+ * Samples are drawn in chunks of `CHUNK_SIZE`, each with its own random
+ * engine seeded from the user seed and the chunk index. The samples for a
+ * given seed are therefore the same for any number of threads.
+ *
+ * @tparam T Floating-point precision.
+ */
+template <class T = double> class Sampler {
+  private:
+    size_t num_qubits_;
+    size_t num_threads_;
+    std::vector<T> prob_;
+    std::vector<size_t> alias_;
+
+  public:
+    /**
+     * @brief Number of samples drawn from each random engine.
+     */
+    static constexpr size_t CHUNK_SIZE = 1U << 14U;
+
+    /**
+     * @brief Build the alias table of the given statevector. The statevector
+     * does not need to be normalized.
+     *
+     * @param sv Statevector to sample from.
+     */
+    explicit Sampler(const StateVector<T> &sv)
+        : num_qubits_{sv.getNumQubits()}, num_threads_{sv.getNumThreads()},
+          prob_(sv.getLength()), alias_(sv.getLength()) {
+        const std::complex<T> *arr = sv.getData();
+        const size_t length = sv.getLength();
+        T *prob = prob_.data();
+        Util::accumulator_t<T> norm = 0;
+
+#if defined(_OPENMP)
+        const bool parallel = length >= sv.getParallelThreshold();
+#pragma omp parallel for num_threads(num_threads_) if (parallel)              \
+    default(none) shared(arr, prob, length) reduction(+ : norm)
+#endif
+        for (size_t i = 0; i < length; i++) {
+            prob[i] = std::norm(arr[i]);
+            norm += prob[i];
+        }
+        PL_ABORT_IF_NOT(norm > 0,
+                        "Cannot sample from a statevector with zero norm.");
+
+        // Scale the probabilities so that they average to one
+        const auto scale = static_cast<T>(
+            static_cast<Util::accumulator_t<T>>(length) / norm);
+        for (auto &p : prob_) {
+            p *= scale;
+        }
+
+        // Indices of the underfull entries fill `work` from the front, those
+        // of the overfull entries from the back.
+        std::vector<size_t> work(length);
+        size_t num_small = 0;
+        size_t num_large = 0;
+        for (size_t i = 0; i < length; i++) {
+            if (prob_[i] < 1) {
+                work[num_small++] = i;
+            } else {
+                work[length - 1 - num_large++] = i;
+            }
+        }
+        std::iota(alias_.begin(), alias_.end(), 0);
+        while (num_small > 0 && num_large > 0) {
+            const size_t small = work[--num_small];
+            const size_t large = work[length - num_large--];
+            alias_[small] = large;
+            prob_[large] = (prob_[large] + prob_[small]) - 1;
+            if (prob_[large] < 1) {
+                work[num_small++] = large;
+            } else {
+                work[length - 1 - num_large++] = large;
+            }
+        }
+        // Entries left over from rounding keep themselves
+        for (size_t i = 0; i < num_small; i++) {
+            prob_[work[i]] = 1;
+        }
+        for (size_t i = 0; i < num_large; i++) {
+            prob_[work[length - 1 - i]] = 1;
+        }
+    }
+
+    /**
+     * @brief Get the number of qubits of the sampled statevector.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Draw samples into a preallocated buffer.
+     *
+     * @param num_samples Number of samples.
+     * @param seed Seed of the random engines.
+     * @param out Output buffer with `num_samples` elements. Each sample is the
+     * index of the measured basis state, i.e. the measured bits packed with
+     * wire 0 as the most significant bit.
+     */
+    void sample(size_t num_samples, size_t seed, size_t *out) const {
+        const size_t num_chunks = (num_samples + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        const size_t num_qubits = num_qubits_;
+        const T *prob = prob_.data();
+        const size_t *alias = alias_.data();
+        constexpr size_t num_engine_bits = CHAR_BIT * sizeof(uint64_t);
+        constexpr double coin_scale = 0x1.0p-53; // 2^-53
+
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (num_chunks > 1)        \
+    default(none) shared(out, num_samples, seed, num_chunks, num_qubits,      \
+                         prob, alias)
+#endif
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            std::seed_seq seq{
+                static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32U),
+                static_cast<uint32_t>(chunk),
+                static_cast<uint32_t>(chunk >> 32U)};
+            std::mt19937_64 engine(seq);
+
+            const size_t end = std::min(num_samples, (chunk + 1) * CHUNK_SIZE);
+            for (size_t s = chunk * CHUNK_SIZE; s < end; s++) {
+                // The leading bits of a draw pick a uniformly random entry
+                const size_t entry =
+                    (num_qubits == 0)
+                        ? 0
+                        : static_cast<size_t>(engine() >>
+                                              (num_engine_bits - num_qubits));
+                const double coin =
+                    static_cast<double>(engine() >> 11U) * coin_scale;
+                out[s] = (coin < static_cast<double>(prob[entry]))
+                             ? entry
+                             : alias[entry];
+            }
+        }
+    }
+
+    /**
+     * @brief Draw samples.
+     *
+     * @see sample(size_t num_samples, size_t seed, size_t *out) const
+     *
+     * @param num_samples Number of samples.
+     * @param seed Seed of the random engines.
+     * @return std::vector<size_t> Indices of the measured basis states.
+     */
+    [[nodiscard]] auto sample(size_t num_samples, size_t seed) const
+        -> std::vector<size_t> {
+        std::vector<size_t> samples(num_samples);
+        sample(num_samples, seed, samples.data());
+        return samples;
+    }
+};
+
+} // namespace Pennylane::Algorithms
@@ -0,0 +1,42 @@
+#pragma once
+#include <complex>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+/**
+ * @brief Report the memory bandwidth of a benchmark, both as bytes per second
+ * and as a `GB` rate counter in GB/s.
+ *
+ * @param state Benchmark state.
+ * @param bytes_per_iteration Bytes read and written by one iteration.
+ */
+inline void setBandwidth(benchmark::State &state, double bytes_per_iteration) {
+    state.SetBytesProcessed(static_cast<int64_t>(
+        bytes_per_iteration * static_cast<double>(state.iterations())));
+    state.counters["GB"] =
+        benchmark::Counter(bytes_per_iteration / 1e9,
+                           benchmark::Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * @brief Create a vector of random complex values.
+ *
+ * @tparam fp_t Floating point precision type.
+ * @param size Number of values.
+ * @param seed Seed of the random generator.
+ * @return std::vector<std::complex<fp_t>>
+ */
+template <class fp_t>
+auto createRandomVector(size_t size, size_t seed = 1337)
+    -> std::vector<std::complex<fp_t>> {
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<fp_t> dist(-1, 1);
+    std::vector<std::complex<fp_t>> values(size);
+    for (auto &value : values) {
+        value = {dist(gen), dist(gen)};
+    }
+    return values;
+}
@@ -0,0 +1,89 @@
+#include <complex>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "AdjointDiff.hpp"
+#include "StateVectorManaged.hpp"
+#include "Util.hpp"
+
+#include "BenchHelpers.hpp"
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+namespace {
+
+/**
+ * @brief Benchmark the adjoint Jacobian of a layered circuit, with all
+ * parameters trainable.
+ *
+ * Each layer applies RX, RY and RZ to every qubit, followed by a ring of
+ * CNOT gates. The observables are PauliZ on the qubits in turn.
+ *
+ * Arguments: number of qubits, number of layers, number of observables.
+ */
+void benchAdjointJacobian(benchmark::State &state) {
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto num_layers = static_cast<size_t>(state.range(1));
+    const auto num_obs = static_cast<size_t>(state.range(2));
+
+    std::vector<std::string> ops_name;
+    std::vector<std::vector<double>> ops_params;
+    std::vector<std::vector<size_t>> ops_wires;
+    double angle = 0.1;
+    for (size_t layer = 0; layer < num_layers; layer++) {
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            for (const auto *name : {"RX", "RY", "RZ"}) {
+                ops_name.emplace_back(name);
+                ops_params.push_back({angle});
+                ops_wires.push_back({wire});
+                angle += 0.1;
+            }
+        }
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            ops_name.emplace_back("CNOT");
+            ops_params.emplace_back();
+            ops_wires.push_back({wire, (wire + 1) % num_qubits});
+        }
+    }
+    AdjointJacobian<double> adj;
+    const auto ops =
+        adj.createOpsData(ops_name, ops_params, ops_wires,
+                          std::vector<bool>(ops_name.size(), false));
+
+    std::vector<ObsDatum<double>> obs;
+    for (size_t o = 0; o < num_obs; o++) {
+        obs.push_back({{"PauliZ"}, {{}}, {{o % num_qubits}}});
+    }
+    std::vector<size_t> t_params(ops.getNumParams());
+    for (size_t p = 0; p < t_params.size(); p++) {
+        t_params[p] = p;
+    }
+
+    const StateVectorManaged<double> psi(num_qubits);
+    std::vector<std::vector<double>> jacobian(
+        num_obs, std::vector<double>(t_params.size(), 0));
+    for ([[maybe_unused]] auto _ : state) {
+        adj.adjointJacobian(psi.getData(), psi.getLength(), jacobian, obs, ops,
+                            t_params, true);
+        benchmark::DoNotOptimize(jacobian.data());
+    }
+    // Lower bound of the traffic: every step of the backward pass reads and
+    // writes the forward state and each observable-applied state once.
+    setBandwidth(state, 2.0 * static_cast<double>(ops.getSize()) *
+                            static_cast<double>(num_obs + 1) *
+                            static_cast<double>(psi.getLength()) *
+                            sizeof(std::complex<double>));
+    state.counters["params"] = static_cast<double>(t_params.size());
+}
+
+} // namespace
+
+BENCHMARK(benchAdjointJacobian)
+    ->Name("AdjointJacobian::adjointJacobian")
+    ->ArgNames({"qubits", "layers", "observables"})
+    ->ArgsProduct({{8, 14}, {1, 4, 16}, {1, 4, 16}})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,136 @@
+#include <complex>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Dispatcher.hpp"
+#include "StateVectorManaged.hpp"
+#include "Util.hpp"
+
+#include "BenchHelpers.hpp"
+
+using namespace Pennylane;
+
+namespace {
+
+/// Numbers of qubits of the statevector benchmarks
+const std::vector<int64_t> NUM_QUBITS{10, 14, 18, 22};
+
+/**
+ * @brief Benchmark one gate, with its first wire at a given position and the
+ * other wires following it cyclically.
+ *
+ * Arguments: number of qubits, position of the first wire.
+ */
+void benchGateOperation(benchmark::State &state, GateOperation gate_op) {
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto position = static_cast<size_t>(state.range(1));
+
+    std::vector<size_t> wires(Util::getGateNumWires(gate_op));
+    for (size_t i = 0; i < wires.size(); i++) {
+        wires[i] = (position + i) % num_qubits;
+    }
+    const std::vector<double> params{0.3, -0.8, 1.2};
+
+    StateVectorManaged<double> sv(
+        createRandomVector<double>(Util::exp2(num_qubits)));
+    for ([[maybe_unused]] auto _ : state) {
+        sv.applyOperation(gate_op, wires, false, params);
+        benchmark::ClobberMemory();
+    }
+    // Every amplitude is read and written once
+    setBandwidth(state, 2.0 * static_cast<double>(sv.getLength()) *
+                            sizeof(std::complex<double>));
+}
+
+/**
+ * @brief Benchmark a dense matrix of a given width, on the lowest wires.
+ *
+ * Arguments: number of qubits, number of wires of the matrix.
+ */
+void benchApplyMatrix(benchmark::State &state) {
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto width = static_cast<size_t>(state.range(1));
+
+    std::vector<size_t> wires(width);
+    for (size_t i = 0; i < width; i++) {
+        wires[i] = i;
+    }
+    const auto matrix = createRandomVector<double>(Util::exp2(2 * width), 42);
+
+    StateVectorManaged<double> sv(
+        createRandomVector<double>(Util::exp2(num_qubits)));
+    for ([[maybe_unused]] auto _ : state) {
+        sv.applyMatrix(matrix, wires, false);
+        benchmark::ClobberMemory();
+    }
+    setBandwidth(state, 2.0 * static_cast<double>(sv.getLength()) *
+                            sizeof(std::complex<double>));
+}
+
+/**
+ * @brief Benchmark a single-qubit matrix on the lowest wire, controlled by the
+ * highest wires.
+ *
+ * Arguments: number of qubits, number of control wires.
+ */
+void benchApplyControlledMatrix(benchmark::State &state) {
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto num_controls = static_cast<size_t>(state.range(1));
+
+    std::vector<size_t> controls(num_controls);
+    for (size_t i = 0; i < num_controls; i++) {
+        controls[i] = num_qubits - 1 - i;
+    }
+    const auto matrix = createRandomVector<double>(4, 42);
+
+    StateVectorManaged<double> sv(
+        createRandomVector<double>(Util::exp2(num_qubits)));
+    for ([[maybe_unused]] auto _ : state) {
+        sv.applyControlledMatrix(matrix, controls, {0}, false);
+        benchmark::ClobberMemory();
+    }
+    // Only the amplitudes with all controls set are read and written
+    setBandwidth(state, 2.0 * static_cast<double>(sv.getLength() >>
+                                                  num_controls) *
+                            sizeof(std::complex<double>));
+}
+
+/**
+ * @brief Register the benchmark of every gate operation, over the numbers of
+ * qubits and with the gate on the lowest, middle and highest wires.
+ */
+auto registerGateBenchmarks() -> bool {
+    for (size_t op = 0; op < Util::NUM_GATE_OPERATIONS; op++) {
+        const auto gate_op = static_cast<GateOperation>(op);
+        const std::string name =
+            "applyOperation/" + std::string(Util::getGateName(gate_op));
+        auto *bench = benchmark::RegisterBenchmark(name.c_str(),
+                                                   benchGateOperation, gate_op);
+        bench->ArgNames({"qubits", "position"});
+        for (const auto num_qubits : NUM_QUBITS) {
+            for (const auto position :
+                 {int64_t{0}, num_qubits / 2, num_qubits - 1}) {
+                bench->Args({num_qubits, position});
+            }
+        }
+    }
+    return true;
+}
+
+[[maybe_unused]] const bool gate_benchmarks_registered =
+    registerGateBenchmarks();
+
+} // namespace
+
+BENCHMARK(benchApplyMatrix)
+    ->Name("applyMatrix")
+    ->ArgNames({"qubits", "width"})
+    ->ArgsProduct({NUM_QUBITS, {1, 2, 3, 4, 5}});
+
+BENCHMARK(benchApplyControlledMatrix)
+    ->Name("applyControlledMatrix")
+    ->ArgNames({"qubits", "controls"})
+    ->ArgsProduct({NUM_QUBITS, {0, 1, 2, 3}});
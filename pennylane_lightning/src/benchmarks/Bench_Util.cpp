@@ -0,0 +1,61 @@
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Util.hpp"
+
+#include "BenchHelpers.hpp"
+
+using namespace Pennylane;
+
+namespace {
+
+/**
+ * @brief Benchmark the conjugated inner product of two vectors.
+ *
+ * Arguments: base-2 logarithm of the vector length.
+ */
+void benchInnerProdC(benchmark::State &state) {
+    const size_t length = Util::exp2(static_cast<size_t>(state.range(0)));
+    const auto v1 = createRandomVector<double>(length, 1);
+    const auto v2 = createRandomVector<double>(length, 2);
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(Util::innerProdC(v1, v2));
+    }
+    setBandwidth(state, 2.0 * static_cast<double>(length) *
+                            sizeof(std::complex<double>));
+}
+
+/**
+ * @brief Benchmark the product of a square matrix and a vector.
+ *
+ * Arguments: base-2 logarithm of the matrix dimension.
+ */
+void benchMatrixVecProd(benchmark::State &state) {
+    const size_t dim = Util::exp2(static_cast<size_t>(state.range(0)));
+    const auto mat = createRandomVector<double>(dim * dim, 1);
+    const auto v_in = createRandomVector<double>(dim, 2);
+    std::vector<std::complex<double>> v_out(dim);
+
+    for ([[maybe_unused]] auto _ : state) {
+        Util::matrixVecProd(mat.data(), v_in.data(), v_out.data(), dim, dim);
+        benchmark::ClobberMemory();
+    }
+    setBandwidth(state, static_cast<double>(dim * dim + 2 * dim) *
+                            sizeof(std::complex<double>));
+}
+
+} // namespace
+
+BENCHMARK(benchInnerProdC)
+    ->Name("innerProdC")
+    ->ArgName("log2_length")
+    ->DenseRange(10, 24, 2);
+
+BENCHMARK(benchMatrixVecProd)
+    ->Name("matrixVecProd")
+    ->ArgName("log2_dim")
+    ->DenseRange(4, 12, 2);
@@ -12,12 +12,21 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
+#include <future>
+#include <memory>
 #include <set>
 #include <tuple>
 #include <vector>
 
 #include "AdjointDiff.hpp"
+#include "BatchedExecution.hpp"
+#include "Instrumentation.hpp"
+#include "Observables.hpp"
+#include "OpStream.hpp"
+#include "Sampler.hpp"
 #include "StateVector.hpp"
+#include "StateVectorManaged.hpp"
 #include "pybind11/complex.h"
 #include "pybind11/numpy.h"
 #include "pybind11/pybind11.h"
@@ -26,6 +35,8 @@
 /// @cond DEV
 namespace {
 using namespace Pennylane::Algorithms;
+using Pennylane::OpStream;
+using Pennylane::OpStreamWorker;
 using Pennylane::StateVector;
 using std::complex;
 using std::set;
@@ -85,22 +96,17 @@ void apply(py::array_t<complex<fp_t>> &stateNumpyArray,
  */
 template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
   private:
+    std::shared_ptr<OpStreamWorker<fp_t>> worker_;
+
+  protected:
     /**
-     * @brief Internal utility struct to track data indices of application for
-     * operations.
+     * @brief Construct a binding class over data owned by a derived class.
      *
+     * @param data Statevector data, possibly set later with `setData`.
+     * @param length Number of amplitudes.
      */
-    struct GateIndices {
-        const std::vector<size_t> internal;
-        const std::vector<size_t> external;
-        GateIndices(const std::vector<size_t> &wires, size_t num_qubits)
-            : internal{std::move(
-                  StateVector<fp_t>::generateBitPatterns(wires, num_qubits))},
-              external{std::move(StateVector<fp_t>::generateBitPatterns(
-                  StateVector<fp_t>::getIndicesAfterExclusion(wires,
-                                                              num_qubits),
-                  num_qubits))} {}
-    };
+    StateVecBinder(complex<fp_t> *data, size_t length)
+        : StateVector<fp_t>(data, length) {}
 
   public:
     /**
@@ -113,6 +119,19 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
               static_cast<complex<fp_t> *>(stateNumpyArray.request().ptr),
               static_cast<size_t>(stateNumpyArray.request().shape[0])) {}
 
+    /**
+     * @brief Get the worker thread applying the streams of `apply_async`,
+     * started on first use and kept for the lifetime of the statevector.
+     *
+     * @return OpStreamWorker<fp_t>&
+     */
+    auto getWorker() -> OpStreamWorker<fp_t> & {
+        if (!worker_) {
+            worker_ = std::make_shared<OpStreamWorker<fp_t>>();
+        }
+        return *worker_;
+    }
+
     /**
      * @brief Apply the given operations to the statevector data array.
      *
@@ -127,6 +146,23 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
         this->applyOperations(ops, wires, inverse, params);
     }
 
+    /**
+     * @brief Apply the given operations to the statevector data array, fusing
+     * runs of consecutive gates.
+     *
+     * @param ops Operations to apply to the statevector.
+     * @param wires Wires on which to apply each operation from `ops`.
+     * @param inverse Indicate whether a given operation is an inverse.
+     * @param params Parameters for each given operation in `ops`.
+     * @param max_fused_wires Maximum number of wires of a fused gate. Zero
+     * disables fusion.
+     */
+    void apply(const vector<string> &ops, const vector<vector<size_t>> &wires,
+               const vector<bool> &inverse, const vector<vector<fp_t>> &params,
+               size_t max_fused_wires) {
+        this->applyOperations(ops, wires, inverse, params, max_fused_wires);
+    }
+
     /**
      * @brief Apply the given operations to the statevector data array.
      *
@@ -148,8 +184,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyPauliX(const std::vector<size_t> &wires, bool inverse,
                      [[maybe_unused]] const std::vector<Param_t> params = {}) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::applyPauliX(idx.internal, idx.external, inverse);
+        StateVector<fp_t>::applyPauliX(wires, inverse);
     }
     /**
      * @brief Apply PauliY gate to the given wires.
@@ -160,8 +195,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyPauliY(const std::vector<size_t> &wires, bool inverse,
                      [[maybe_unused]] const std::vector<Param_t> params = {}) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::applyPauliY(idx.internal, idx.external, inverse);
+        StateVector<fp_t>::applyPauliY(wires, inverse);
     }
     /**
      * @brief Apply PauliZ gate to the given wires.
@@ -172,8 +206,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyPauliZ(const std::vector<size_t> &wires, bool inverse,
                      [[maybe_unused]] const std::vector<Param_t> params = {}) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::applyPauliZ(idx.internal, idx.external, inverse);
+        StateVector<fp_t>::applyPauliZ(wires, inverse);
     }
     /**
      * @brief Apply Hadamard gate to the given wires.
@@ -185,8 +218,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     void
     applyHadamard(const std::vector<size_t> &wires, bool inverse,
                   [[maybe_unused]] const std::vector<Param_t> params = {}) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::applyHadamard(idx.internal, idx.external, inverse);
+        StateVector<fp_t>::applyHadamard(wires, inverse);
     }
     /**
      * @brief Apply S gate to the given wires.
@@ -197,8 +229,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyS(const std::vector<size_t> &wires, bool inverse,
                 [[maybe_unused]] const std::vector<Param_t> params = {}) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::applyS(idx.internal, idx.external, inverse);
+        StateVector<fp_t>::applyS(wires, inverse);
     }
     /**
      * @brief Apply T gate to the given wires.
@@ -209,8 +240,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyT(const std::vector<size_t> &wires, bool inverse,
                 [[maybe_unused]] const std::vector<Param_t> params = {}) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::applyT(idx.internal, idx.external, inverse);
+        StateVector<fp_t>::applyT(wires, inverse);
     }
     /**
      * @brief Apply CNOT (CX) gate to the given wires.
@@ -222,8 +252,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyCNOT(const std::vector<size_t> &wires, bool inverse,
                    [[maybe_unused]] const std::vector<Param_t> params = {}) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::applyCNOT(idx.internal, idx.external, inverse);
+        StateVector<fp_t>::applyCNOT(wires, inverse);
     }
     /**
      * @brief Apply SWAP gate to the given wires.
@@ -235,8 +264,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applySWAP(const std::vector<size_t> &wires, bool inverse,
                    [[maybe_unused]] const std::vector<Param_t> params = {}) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::applySWAP(idx.internal, idx.external, inverse);
+        StateVector<fp_t>::applySWAP(wires, inverse);
     }
     /**
      * @brief Apply CZ gate to the given wires.
@@ -248,8 +276,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyCZ(const std::vector<size_t> &wires, bool inverse,
                  [[maybe_unused]] const std::vector<Param_t> params = {}) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::applyCZ(idx.internal, idx.external, inverse);
+        StateVector<fp_t>::applyCZ(wires, inverse);
     }
     /**
      * @brief Apply CSWAP gate to the given wires.
@@ -261,8 +288,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyCSWAP(const std::vector<size_t> &wires, bool inverse,
                     [[maybe_unused]] const std::vector<Param_t> params = {}) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::applyCSWAP(idx.internal, idx.external, inverse);
+        StateVector<fp_t>::applyCSWAP(wires, inverse);
     }
     /**
      * @brief Apply Toffoli (CCX) gate to the given wires.
@@ -274,8 +300,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyToffoli(const std::vector<size_t> &wires, bool inverse,
                       [[maybe_unused]] const std::vector<Param_t> params = {}) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::applyToffoli(idx.internal, idx.external, inverse);
+        StateVector<fp_t>::applyToffoli(wires, inverse);
     }
     /**
      * @brief Apply Phase-shift (\f$\textrm{diag}(1, \exp(i\theta))\f$) gate to
@@ -287,9 +312,8 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyPhaseShift(const std::vector<size_t> &wires, bool inverse,
                          const std::vector<Param_t> &params) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::template applyPhaseShift<Param_t>(
-            idx.internal, idx.external, inverse, params[0]);
+        StateVector<fp_t>::template applyPhaseShift<Param_t>(wires, inverse,
+                                                             params[0]);
     }
     /**
      * @brief Apply controlled phase-shift
@@ -303,9 +327,8 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     void applyControlledPhaseShift(const std::vector<size_t> &wires,
                                    bool inverse,
                                    const std::vector<Param_t> &params) {
-        const GateIndices idx(wires, this->getNumQubits());
         StateVector<fp_t>::template applyControlledPhaseShift<Param_t>(
-            idx.internal, idx.external, inverse, params[0]);
+            wires, inverse, params[0]);
     }
 
     /**
@@ -319,9 +342,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyRX(const std::vector<size_t> &wires, bool inverse,
                  const std::vector<Param_t> &params) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::template applyRX<Param_t>(idx.internal, idx.external,
-                                                     inverse, params[0]);
+        StateVector<fp_t>::template applyRX<Param_t>(wires, inverse, params[0]);
     }
     /**
      * @brief Apply RY (\f$exp(-i\theta\sigma_y/2)\f$) gate to the given wires.
@@ -334,9 +355,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyRY(const std::vector<size_t> &wires, bool inverse,
                  const std::vector<Param_t> &params) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::template applyRY<Param_t>(idx.internal, idx.external,
-                                                     inverse, params[0]);
+        StateVector<fp_t>::template applyRY<Param_t>(wires, inverse, params[0]);
     }
     /**
      * @brief Apply RZ (\f$exp(-i\theta\sigma_z/2)\f$) gate to the given wires.
@@ -349,9 +368,7 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyRZ(const std::vector<size_t> &wires, bool inverse,
                  const std::vector<Param_t> &params) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::template applyRZ<Param_t>(idx.internal, idx.external,
-                                                     inverse, params[0]);
+        StateVector<fp_t>::template applyRZ<Param_t>(wires, inverse, params[0]);
     }
     /**
      * @brief Apply controlled RX gate to the given wires.
@@ -365,9 +382,8 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyCRX(const std::vector<size_t> &wires, bool inverse,
                   const std::vector<Param_t> &params) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::template applyCRX<Param_t>(
-            idx.internal, idx.external, inverse, params[0]);
+        StateVector<fp_t>::template applyCRX<Param_t>(wires, inverse,
+                                                      params[0]);
     }
     /**
      * @brief Apply controlled RY gate to the given wires.
@@ -381,9 +397,8 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyCRY(const std::vector<size_t> &wires, bool inverse,
                   const std::vector<Param_t> &params) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::template applyCRY<Param_t>(
-            idx.internal, idx.external, inverse, params[0]);
+        StateVector<fp_t>::template applyCRY<Param_t>(wires, inverse,
+                                                      params[0]);
     }
     /**
      * @brief Apply controlled RZ gate to the given wires.
@@ -397,9 +412,8 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyCRZ(const std::vector<size_t> &wires, bool inverse,
                   const std::vector<Param_t> &params) {
-        const GateIndices idx(wires, this->getNumQubits());
-        StateVector<fp_t>::template applyCRZ<Param_t>(
-            idx.internal, idx.external, inverse, params[0]);
+        StateVector<fp_t>::template applyCRZ<Param_t>(wires, inverse,
+                                                      params[0]);
     }
     /**
      * @brief Apply Rot gate to the given wires.
@@ -412,10 +426,8 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyRot(const std::vector<size_t> &wires, bool inverse,
                   const std::vector<Param_t> &params) {
-        const GateIndices idx(wires, this->getNumQubits());
         StateVector<fp_t>::template applyRot<Param_t>(
-            idx.internal, idx.external, inverse, params[0], params[1],
-            params[2]);
+            wires, inverse, params[0], params[1], params[2]);
     }
     /**
      * @brief Apply controlled Rot gate to the given wires.
@@ -429,10 +441,8 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
     template <class Param_t = fp_t>
     void applyCRot(const std::vector<size_t> &wires, bool inverse,
                    const std::vector<Param_t> &params) {
-        const GateIndices idx(wires, this->getNumQubits());
         StateVector<fp_t>::template applyCRot<Param_t>(
-            idx.internal, idx.external, inverse, params[0], params[1],
-            params[2]);
+            wires, inverse, params[0], params[1], params[2]);
     }
 
     /**
@@ -459,13 +469,170 @@ template <class fp_t = double> class StateVecBinder : public StateVector<fp_t> {
         const py::array_t<complex<fp_t>,
                           py::array::c_style | py::array::forcecast> &matrix,
         const vector<size_t> &wires, bool inverse = false) {
-        const vector<size_t> internalIndices = this->generateBitPatterns(wires);
-        const vector<size_t> externalWires =
-            this->getIndicesAfterExclusion(wires);
-        const vector<size_t> externalIndices =
-            this->generateBitPatterns(externalWires);
         this->applyMatrix(static_cast<complex<fp_t> *>(matrix.request().ptr),
-                          internalIndices, externalIndices, inverse);
+                          wires, inverse);
+    }
+
+    /**
+     * @brief Apply a one- or two-qubit matrix controlled by any number of
+     * wires, without building the matrix of the controlled operation.
+     *
+     * @param matrix Numpy complex data representing the target matrix.
+     * @param controls Control wires.
+     * @param targets Target wires.
+     * @param inverse Indicate whether to take adjoint.
+     */
+    void applyControlledMatrixWires(
+        const py::array_t<complex<fp_t>,
+                          py::array::c_style | py::array::forcecast> &matrix,
+        const vector<size_t> &controls, const vector<size_t> &targets,
+        bool inverse = false) {
+        PL_ABORT_IF_NOT(static_cast<size_t>(matrix.size()) ==
+                            Util::exp2(2 * targets.size()),
+                        "The matrix size does not match the number of target "
+                        "wires.");
+        this->applyControlledMatrix(
+            static_cast<complex<fp_t> *>(matrix.request().ptr), controls,
+            targets, inverse);
+    }
+};
+
+/**
+ * @brief Binding class owning its statevector, for devices that keep one state
+ * across executions.
+ *
+ * The amplitudes live in a `%StateVectorManaged` that is never reallocated, so
+ * that NumPy views obtained through the buffer protocol stay valid for the
+ * lifetime of the object. A second buffer, allocated on the first snapshot and
+ * reused afterwards, holds a saved copy of the state. Being a
+ * `%StateVecBinder`, the object is accepted wherever a wrapped NumPy array is.
+ *
+ * @tparam fp_t Floating point precision type.
+ */
+template <class fp_t = double>
+class ManagedStateVecBinder : public StateVecBinder<fp_t> {
+  private:
+    using Storage_t = Pennylane::StateVectorManaged<
+        fp_t, Pennylane::Util::AlignedAllocator<complex<fp_t>>>;
+
+    Storage_t data_;
+    Storage_t snapshot_;
+
+    /**
+     * @brief Run the copies of `storage` with the threads of the gate kernels.
+     */
+    void syncSettings_(Storage_t &storage) const {
+        storage.setNumThreads(this->getNumThreads());
+        storage.setParallelThreshold(this->getParallelThreshold());
+    }
+
+  public:
+    /**
+     * @brief Allocate the statevector in the state \f$|0\cdots 0\rangle\f$.
+     *
+     * @param num_qubits Number of qubits.
+     */
+    explicit ManagedStateVecBinder(size_t num_qubits)
+        : StateVecBinder<fp_t>(nullptr, Pennylane::Util::exp2(num_qubits)),
+          data_(num_qubits) {
+        this->setData(data_.getData());
+    }
+    ManagedStateVecBinder(const ManagedStateVecBinder &) = delete;
+    auto operator=(const ManagedStateVecBinder &)
+        -> ManagedStateVecBinder & = delete;
+
+    /**
+     * @brief Reset the statevector to \f$|0\cdots 0\rangle\f$ in place.
+     */
+    void resetState() {
+        syncSettings_(data_);
+        data_.resetState();
+    }
+
+    /**
+     * @brief Overwrite the statevector in place with a copy of the given data.
+     *
+     * @param state Complex numpy statevector data array of the same length.
+     */
+    void updateData(const py::array_t<complex<fp_t>, py::array::c_style |
+                                                         py::array::forcecast>
+                        &state) {
+        syncSettings_(data_);
+        data_.updateData(state.data(), static_cast<size_t>(state.size()));
+    }
+
+    /**
+     * @brief Save a copy of the current statevector.
+     */
+    void saveSnapshot() {
+        syncSettings_(snapshot_);
+        snapshot_ = data_;
+    }
+
+    /**
+     * @brief Overwrite the statevector with the last saved copy.
+     */
+    void restoreSnapshot() {
+        PL_ABORT_IF(snapshot_.getLength() == 0, "No snapshot was saved.");
+        syncSettings_(data_);
+        data_ = snapshot_;
+    }
+
+    /**
+     * @brief Get a NumPy view of the snapshot buffer, which later snapshots
+     * overwrite in place.
+     *
+     * @param self Python object owning the view.
+     */
+    auto getSnapshot(const py::object &self) -> py::array_t<complex<fp_t>> {
+        PL_ABORT_IF(snapshot_.getLength() == 0, "No snapshot was saved.");
+        return py::array_t<complex<fp_t>>(
+            static_cast<py::ssize_t>(snapshot_.getLength()),
+            snapshot_.getData(), self);
+    }
+};
+
+/**
+ * @brief Operation stream queued on the worker thread of a statevector, as
+ * returned to Python by `apply_async`.
+ *
+ * Destroying the object waits for the operations, so that the statevector,
+ * kept alive by the object, is never freed while they are applied.
+ */
+class PendingOps {
+  private:
+    std::future<void> future_;
+
+  public:
+    explicit PendingOps(std::future<void> future)
+        : future_{std::move(future)} {}
+    PendingOps(PendingOps &&) = default;
+    PendingOps(const PendingOps &) = delete;
+    auto operator=(const PendingOps &) -> PendingOps & = delete;
+    auto operator=(PendingOps &&) -> PendingOps & = delete;
+    ~PendingOps() {
+        if (future_.valid()) {
+            future_.wait();
+        }
+    }
+
+    /**
+     * @brief Block until the operations are applied, rethrowing their error if
+     * any. Further calls return immediately.
+     */
+    void wait() {
+        if (future_.valid()) {
+            future_.get();
+        }
+    }
+
+    /**
+     * @brief Whether the operations are applied, such that `wait` does not
+     * block.
+     */
+    [[nodiscard]] auto done() const -> bool {
+        return !future_.valid() || future_.wait_for(std::chrono::seconds(0)) ==
+                                       std::future_status::ready;
     }
 };
 
@@ -565,6 +732,14 @@ void lightning_class_bindings(py::module &m) {
                  const vector<string> &, const vector<vector<size_t>> &,
                  const vector<bool> &, const vector<vector<PrecisionT>> &>(
                  &StateVecBinder<PrecisionT>::apply))
+        .def("apply",
+             py::overload_cast<const vector<string> &,
+                               const vector<vector<size_t>> &,
+                               const vector<bool> &,
+                               const vector<vector<PrecisionT>> &, size_t>(
+                 &StateVecBinder<PrecisionT>::apply),
+             "Apply the given operations, fusing consecutive gates acting on "
+             "at most `max_fused_wires` wires.")
 
         .def("apply", py::overload_cast<const vector<string> &,
                                         const vector<vector<size_t>> &,
@@ -580,6 +755,98 @@ void lightning_class_bindings(py::module &m) {
                                    py::array::c_style | py::array::forcecast> &,
                  const vector<size_t> &, bool>(
                  &StateVecBinder<PrecisionT>::applyMatrixWires))
+        .def("applyControlledMatrix",
+             &StateVecBinder<PrecisionT>::applyControlledMatrixWires,
+             "Apply a one- or two-qubit matrix controlled by any number of "
+             "wires.")
+        .def(
+            "apply_stream",
+            [](StateVecBinder<PrecisionT> &sv,
+               const OpStream<PrecisionT> &stream, size_t max_fused_wires) {
+                stream.apply(sv, max_fused_wires);
+            },
+            py::arg("stream"), py::arg("max_fused_wires") = 0,
+            py::call_guard<py::gil_scoped_release>(),
+            "Apply a stream of operations, releasing the GIL.")
+        .def(
+            "apply_async",
+            [](StateVecBinder<PrecisionT> &sv,
+               std::shared_ptr<OpStream<PrecisionT>> stream,
+               size_t max_fused_wires) {
+                return PendingOps{sv.getWorker().submit(std::move(stream), sv,
+                                                        max_fused_wires)};
+            },
+            py::arg("stream"), py::arg("max_fused_wires") = 0,
+            py::keep_alive<0, 1>(),
+            "Queue a stream of operations on the worker thread of the "
+            "statevector. The statevector must not be used until the returned "
+            "`PendingOps` is waited on.")
+
+        .def("setBasisState",
+             py::overload_cast<const vector<size_t> &, const vector<size_t> &>(
+                 &StateVecBinder<PrecisionT>::setBasisState),
+             "Set the basis state with the given bits on the given wires and "
+             "the other wires in the zero state.")
+        .def(
+            "setStateVector",
+            [](StateVecBinder<PrecisionT> &sv,
+               const py::array_t<complex<PrecisionT>, py::array::c_style |
+                                                          py::array::forcecast>
+                   &state,
+               const vector<size_t> &wires) {
+                PL_ABORT_IF_NOT(static_cast<size_t>(state.size()) ==
+                                    Pennylane::Util::exp2(wires.size()),
+                                "The state vector must have 2^len(wires) "
+                                "amplitudes.");
+                sv.setStateVector(state.data(), wires);
+            },
+            "Set the state of the given wires, with the other wires in the "
+            "zero state.")
+
+        .def("setNumThreads", &StateVecBinder<PrecisionT>::setNumThreads,
+             "Set the number of OpenMP threads used by the gate kernels.")
+        .def("getNumThreads", &StateVecBinder<PrecisionT>::getNumThreads,
+             "Get the number of OpenMP threads used by the gate kernels.")
+        .def("setParallelThreshold",
+             &StateVecBinder<PrecisionT>::setParallelThreshold,
+             "Set the minimum statevector length for multithreaded kernels.")
+        .def("getParallelThreshold",
+             &StateVecBinder<PrecisionT>::getParallelThreshold,
+             "Get the minimum statevector length for multithreaded kernels.")
+        .def("setCacheBlockQubits",
+             &StateVecBinder<PrecisionT>::setCacheBlockQubits,
+             "Set the number of qubits of the cache blocks used by `apply`. "
+             "Zero disables cache blocking.")
+        .def("getCacheBlockQubits",
+             &StateVecBinder<PrecisionT>::getCacheBlockQubits,
+             "Get the number of qubits of the cache blocks used by `apply`.")
+        .def("setReorderQubits",
+             &StateVecBinder<PrecisionT>::setReorderQubits,
+             "Set the number of most used wires moved to the lowest-order "
+             "positions while `apply` runs. Zero disables wire reordering.")
+        .def("getReorderQubits",
+             &StateVecBinder<PrecisionT>::getReorderQubits,
+             "Get the number of wires moved by wire reordering.")
+        .def("setReorderWires",
+             &StateVecBinder<PrecisionT>::setReorderWires,
+             "Set the wires moved to the lowest-order positions while `apply` "
+             "runs, in place of the most used ones.")
+        .def("getReorderWires",
+             &StateVecBinder<PrecisionT>::getReorderWires,
+             "Get the wires moved to the lowest-order positions.")
+        .def(
+            "probs",
+            [](const StateVecBinder<PrecisionT> &sv,
+               const std::vector<size_t> &wires) {
+                const size_t num_outcomes =
+                    Pennylane::Util::exp2(wires.size());
+                py::array_t<PrecisionT> probs(
+                    static_cast<py::ssize_t>(num_outcomes));
+                sv.probs(wires, probs.mutable_data());
+                return probs;
+            },
+            "Marginal probabilities of the computational basis states of the "
+            "given wires, written directly into a new NumPy array.")
 
         .def("ControlledPhaseShift",
              py::overload_cast<const std::vector<size_t> &, bool,
@@ -636,6 +903,38 @@ void lightning_class_bindings(py::module &m) {
                  &StateVecBinder<PrecisionT>::template applyCRot<Param_t>),
              "Apply the CRot gate.");
 
+    class_name = "StateVectorManagedC" + bitsize;
+    py::class_<ManagedStateVecBinder<PrecisionT>, StateVecBinder<PrecisionT>>(
+        m, class_name.c_str(), py::buffer_protocol(),
+        "Statevector owned by C++ that can be kept across executions. "
+        "`numpy.asarray` returns a writable view of its amplitudes.")
+        .def(py::init<size_t>())
+        .def_buffer([](ManagedStateVecBinder<PrecisionT> &sv) {
+            return py::buffer_info(
+                sv.getData(), sizeof(complex<PrecisionT>),
+                py::format_descriptor<complex<PrecisionT>>::format(), 1,
+                {static_cast<py::ssize_t>(sv.getLength())},
+                {static_cast<py::ssize_t>(sizeof(complex<PrecisionT>))});
+        })
+        .def("resetState", &ManagedStateVecBinder<PrecisionT>::resetState,
+             "Reset the statevector to the all-zero basis state in place.")
+        .def("updateData", &ManagedStateVecBinder<PrecisionT>::updateData,
+             "Copy the given amplitudes into the statevector in place.")
+        .def("saveSnapshot", &ManagedStateVecBinder<PrecisionT>::saveSnapshot,
+             "Save a copy of the statevector in a buffer reused by later "
+             "snapshots.")
+        .def("restoreSnapshot",
+             &ManagedStateVecBinder<PrecisionT>::restoreSnapshot,
+             "Overwrite the statevector with the last saved copy.")
+        .def(
+            "getSnapshot",
+            [](const py::object &self) {
+                return self.cast<ManagedStateVecBinder<PrecisionT> &>()
+                    .getSnapshot(self);
+            },
+            "Get a NumPy view of the snapshot buffer, which later snapshots "
+            "overwrite in place.");
+
     //***********************************************************************//
     //                              Observable
     //***********************************************************************//
@@ -647,6 +946,18 @@ void lightning_class_bindings(py::module &m) {
         py::array_t<Param_t, py::array::c_style | py::array::forcecast>;
 
     using obs_data_var = std::variant<std::monostate, np_arr_r, np_arr_c>;
+    using np_arr_idx =
+        py::array_t<size_t, py::array::c_style | py::array::forcecast>;
+
+    // Copy CSR arrays, as given by scipy.sparse.csr_matrix
+    auto to_sparse = [](const np_arr_c &data, const np_arr_idx &indices,
+                        const np_arr_idx &indptr) {
+        return SparseHamiltonian<PrecisionT>{
+            {data.data(), data.data() + data.size()},
+            {indices.data(), indices.data() + indices.size()},
+            {indptr.data(), indptr.data() + indptr.size()}};
+    };
+
     py::class_<ObsDatum<PrecisionT>>(m, class_name.c_str())
         .def(py::init([](const std::vector<std::string> &names,
                          const std::vector<obs_data_var> &params,
@@ -683,6 +994,24 @@ void lightning_class_bindings(py::module &m) {
             }
             return ObsDatum<PrecisionT>(names, conv_params, wires);
         }))
+        .def_static(
+            "sparse_hamiltonian",
+            [to_sparse](const np_arr_c &data, const np_arr_idx &indices,
+                        const np_arr_idx &indptr,
+                        const std::vector<size_t> &wires) {
+                for (size_t i = 0; i < wires.size(); i++) {
+                    PL_ABORT_IF_NOT(wires[i] == i,
+                                    "A sparse Hamiltonian must act on all "
+                                    "wires in the device order.");
+                }
+                const std::shared_ptr<const SparseHamiltonian<PrecisionT>>
+                    sparse = std::make_shared<SparseHamiltonian<PrecisionT>>(
+                        to_sparse(data, indices, indptr));
+                return ObsDatum<PrecisionT>({"SparseHamiltonian"}, {sparse},
+                                            {wires});
+            },
+            "Observable given by a sparse Hamiltonian in CSR format over all "
+            "wires.")
         .def("__repr__",
              [](const ObsDatum<PrecisionT> &obs) {
                  using namespace Pennylane::Util;
@@ -720,6 +1049,18 @@ void lightning_class_bindings(py::module &m) {
                         } else if constexpr (std::is_same_v<p_t,
                                                             std::monostate>) {
                             params.append(py::list{});
+                        } else if constexpr (std::is_same_v<
+                                                 p_t,
+                                                 std::shared_ptr<
+                                                     const SparseHamiltonian<
+                                                         Param_t>>>) {
+                            params.append(py::make_tuple(
+                                py::array_t<std::complex<Param_t>>(
+                                    py::cast(param->getData())),
+                                py::array_t<size_t>(
+                                    py::cast(param->getIndices())),
+                                py::array_t<size_t>(
+                                    py::cast(param->getIndptr()))));
                         } else {
                             throw("Unsupported data type");
                         }
@@ -740,6 +1081,30 @@ void lightning_class_bindings(py::module &m) {
              const std::vector<std::vector<size_t>> &,
              const std::vector<bool> &,
              const std::vector<std::vector<std::complex<PrecisionT>>> &>())
+        .def(
+            "update_params",
+            [](OpsData<PrecisionT> &ops, const np_arr_r &params,
+               const std::vector<np_arr_c> &matrices) {
+                const auto p_buffer = params.request();
+                const auto *const p_ptr =
+                    static_cast<const Param_t *>(p_buffer.ptr);
+                std::vector<std::vector<std::complex<PrecisionT>>>
+                    conv_matrices(matrices.size());
+                for (size_t op = 0; op < matrices.size(); op++) {
+                    const auto m_buffer = matrices[op].request();
+                    if (m_buffer.size) {
+                        const auto *const m_ptr =
+                            static_cast<const std::complex<Param_t> *>(
+                                m_buffer.ptr);
+                        conv_matrices[op] = std::vector<std::complex<Param_t>>{
+                            m_ptr, m_ptr + m_buffer.size};
+                    }
+                }
+                ops.updateParams({p_ptr, p_ptr + p_buffer.size},
+                                 conv_matrices);
+            },
+            "Replace the parameters of the parametric operations, and the "
+            "non-empty matrices, keeping the rest of the operations.")
         .def("__repr__", [](const OpsData<PrecisionT> &ops) {
             using namespace Pennylane::Util;
             std::ostringstream ops_stream;
@@ -755,6 +1120,42 @@ void lightning_class_bindings(py::module &m) {
             return "Operations: [" + ops_stream.str() + "]";
         });
 
+    //***********************************************************************//
+    //                           Operation streams
+    //***********************************************************************//
+
+    using np_arr_code =
+        py::array_t<uint8_t, py::array::c_style | py::array::forcecast>;
+
+    class_name = "OpStreamC" + bitsize;
+    py::class_<OpStream<PrecisionT>, std::shared_ptr<OpStream<PrecisionT>>>(
+        m, class_name.c_str())
+        .def(py::init([](const np_arr_code &codes,
+                         const std::vector<bool> &inverses,
+                         const np_arr_idx &wires, const np_arr_r &params,
+                         const std::vector<np_arr_c> &matrices) {
+                 std::vector<std::vector<std::complex<PrecisionT>>>
+                     conv_matrices(matrices.size());
+                 for (size_t op = 0; op < matrices.size(); op++) {
+                     conv_matrices[op] = {matrices[op].data(),
+                                          matrices[op].data() +
+                                              matrices[op].size()};
+                 }
+                 return std::make_shared<OpStream<PrecisionT>>(
+                     std::vector<uint8_t>{codes.data(),
+                                          codes.data() + codes.size()},
+                     inverses,
+                     std::vector<size_t>{wires.data(),
+                                         wires.data() + wires.size()},
+                     std::vector<PrecisionT>{params.data(),
+                                             params.data() + params.size()},
+                     std::move(conv_matrices));
+             }),
+             "Decode packed operation codes, inverse flags, concatenated "
+             "wires and parameters, and the matrices of the `MATRIX_OP` "
+             "operations.")
+        .def("__len__", &OpStream<PrecisionT>::getNumOperations);
+
     class_name = "AdjointJacobianC" + bitsize;
     py::class_<AdjointJacobian<PrecisionT>>(m, class_name.c_str())
         .def(py::init<>())
@@ -791,20 +1192,246 @@ void lightning_class_bindings(py::module &m) {
                  return OpsData<PrecisionT>{ops_name, conv_params, ops_wires,
                                             ops_inverses, conv_matrices};
              })
+        .def("register_generator",
+             [](AdjointJacobian<PrecisionT> &adj, const std::string &name,
+                const np_arr_c &matrix, PrecisionT scaling_factor) {
+                 const auto m_buffer = matrix.request();
+                 const auto *const m_ptr =
+                     static_cast<const std::complex<Param_t> *>(m_buffer.ptr);
+                 adj.registerGenerator(name,
+                                       std::vector<std::complex<Param_t>>{
+                                           m_ptr, m_ptr + m_buffer.size},
+                                       scaling_factor);
+             })
+        .def("has_generator", &AdjointJacobian<PrecisionT>::hasGenerator)
         .def("adjoint_jacobian", &AdjointJacobian<PrecisionT>::adjointJacobian)
         .def("adjoint_jacobian",
              [](AdjointJacobian<PrecisionT> &adj,
                 const StateVecBinder<PrecisionT> &sv,
                 const std::vector<ObsDatum<PrecisionT>> &observables,
                 const OpsData<PrecisionT> &operations,
-                const std::vector<size_t> &trainableParams, size_t num_params) {
+                const std::vector<size_t> &trainableParams, size_t num_params,
+                size_t max_obs_states) {
                  std::vector<std::vector<PrecisionT>> jac(
                      observables.size(),
                      std::vector<PrecisionT>(num_params, 0));
                  adj.adjointJacobian(sv.getData(), sv.getLength(), jac,
-                                     observables, operations, trainableParams);
+                                     observables, operations, trainableParams,
+                                     false, max_obs_states);
                  return py::array_t<Param_t>(py::cast(jac));
+             })
+        .def(
+            "adjoint_jacobian",
+            [](AdjointJacobian<PrecisionT> &adj,
+               const StateVecBinder<PrecisionT> &sv,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams, size_t num_params,
+               size_t max_obs_states, bool apply_operations) {
+                std::vector<std::vector<PrecisionT>> jac(
+                    observables.size(), std::vector<PrecisionT>(num_params, 0));
+                adj.adjointJacobian(sv.getData(), sv.getLength(), jac,
+                                    observables, operations, trainableParams,
+                                    apply_operations, max_obs_states);
+                return py::array_t<Param_t>(py::cast(jac));
+            },
+            "Jacobian of the state obtained by applying the operations, "
+            "including state preparations, to the given state if "
+            "`apply_operations` is true.")
+        .def(
+            "adjoint_vjp",
+            [](AdjointJacobian<PrecisionT> &adj,
+               const StateVecBinder<PrecisionT> &sv, const np_arr_r &dy,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams, size_t num_params,
+               bool apply_operations) {
+                const auto dy_buffer = dy.request();
+                const auto *const dy_ptr =
+                    static_cast<const Param_t *>(dy_buffer.ptr);
+                std::vector<PrecisionT> vjp(num_params, 0);
+                adj.adjointVJP(sv.getData(), sv.getLength(), vjp,
+                               {dy_ptr, dy_ptr + dy_buffer.size}, observables,
+                               operations, trainableParams, apply_operations);
+                return py::array_t<Param_t>(py::cast(vjp));
+            },
+            "Vector-Jacobian product of the cotangent `dy`, with one weight "
+            "per observable, computed in a single backward pass.")
+        .def(
+            "adjoint_jacobian_checkpointed",
+            [](AdjointJacobian<PrecisionT> &adj,
+               const StateVecBinder<PrecisionT> &sv,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams, size_t num_params,
+               size_t num_segments, bool apply_operations) {
+                std::vector<std::vector<PrecisionT>> jac(
+                    observables.size(), std::vector<PrecisionT>(num_params, 0));
+                adj.adjointJacobianCheckpointed(
+                    sv.getData(), sv.getLength(), jac, observables, operations,
+                    trainableParams, apply_operations, num_segments);
+                return py::array_t<Param_t>(py::cast(jac));
+            },
+            "Jacobian with the backward pass split into `num_segments` "
+            "segments run in parallel from checkpoints.")
+        .def_static("get_max_obs_states",
+                    &AdjointJacobian<PrecisionT>::getMaxObsStates,
+                    "Number of observables processed together within a "
+                    "memory budget in bytes.")
+        .def_static("get_max_checkpoint_segments",
+                    &AdjointJacobian<PrecisionT>::getMaxCheckpointSegments,
+                    "Number of checkpointed segments within a memory budget "
+                    "in bytes.");
+
+    //***********************************************************************//
+    //                          Batched execution
+    //***********************************************************************//
+
+    // Convert a 2D array of gate parameters into one vector per batch member
+    auto to_param_batch = [](const np_arr_r &param_batch) {
+        const auto buffer = param_batch.request();
+        PL_ABORT_IF_NOT(buffer.ndim == 2,
+                        "The parameter batch must be a 2D array.");
+        const auto *const ptr = static_cast<const Param_t *>(buffer.ptr);
+        const auto batch_size = static_cast<size_t>(buffer.shape[0]);
+        const auto num_params = static_cast<size_t>(buffer.shape[1]);
+        std::vector<std::vector<PrecisionT>> conv_batch(batch_size);
+        for (size_t b = 0; b < batch_size; b++) {
+            conv_batch[b] = std::vector<PrecisionT>{
+                ptr + b * num_params, ptr + (b + 1) * num_params};
+        }
+        return conv_batch;
+    };
+
+    class_name = "BatchedExecutorC" + bitsize;
+    py::class_<BatchedExecutor<PrecisionT>>(m, class_name.c_str())
+        .def(py::init<>())
+        .def("execute_states",
+             [to_param_batch](BatchedExecutor<PrecisionT> &executor,
+                              const StateVecBinder<PrecisionT> &sv,
+                              const OpsData<PrecisionT> &operations,
+                              const np_arr_r &param_batch) {
+                 const auto states = executor.executeStates(
+                     sv.getData(), sv.getLength(), operations,
+                     to_param_batch(param_batch));
+                 return py::array_t<std::complex<Param_t>>(py::cast(states));
+             })
+        .def("execute_expval",
+             [to_param_batch](
+                 BatchedExecutor<PrecisionT> &executor,
+                 const StateVecBinder<PrecisionT> &sv,
+                 const std::vector<ObsDatum<PrecisionT>> &observables,
+                 const OpsData<PrecisionT> &operations,
+                 const np_arr_r &param_batch) {
+                 const auto expvals = executor.executeExpval(
+                     sv.getData(), sv.getLength(), observables, operations,
+                     to_param_batch(param_batch));
+                 return py::array_t<Param_t>(py::cast(expvals));
              });
+
+    //***********************************************************************//
+    //                          Pauli observables
+    //***********************************************************************//
+
+    using pauli_names_t = std::vector<std::string>;
+    using pauli_wires_t = std::vector<size_t>;
+
+    // Build a Hamiltonian of Pauli words acting on the statevector qubits
+    auto to_hamiltonian = [](const StateVecBinder<PrecisionT> &sv,
+                             const std::vector<PrecisionT> &coeffs,
+                             const std::vector<pauli_names_t> &paulis,
+                             const std::vector<pauli_wires_t> &wires) {
+        PL_ABORT_IF_NOT(paulis.size() == wires.size(),
+                        "Each Pauli word requires a list of wires.");
+        std::vector<PauliWord> words;
+        words.reserve(paulis.size());
+        for (size_t t = 0; t < paulis.size(); t++) {
+            words.emplace_back(paulis[t], wires[t], sv.getNumQubits());
+        }
+        return Hamiltonian<PrecisionT>{coeffs, std::move(words)};
+    };
+
+    m.def(
+        "expval_pauli_word",
+        [](const StateVecBinder<PrecisionT> &sv, const pauli_names_t &paulis,
+           const pauli_wires_t &wires) {
+            return expval<PrecisionT>(
+                sv, PauliWord{paulis, wires, sv.getNumQubits()});
+        },
+        "Expectation value of a Pauli word.");
+    m.def(
+        "var_pauli_word",
+        [](const StateVecBinder<PrecisionT> &sv, const pauli_names_t &paulis,
+           const pauli_wires_t &wires) {
+            return var<PrecisionT>(sv,
+                                   PauliWord{paulis, wires, sv.getNumQubits()});
+        },
+        "Variance of a Pauli word.");
+    m.def(
+        "expval_hamiltonian",
+        [to_hamiltonian](const StateVecBinder<PrecisionT> &sv,
+                         const std::vector<PrecisionT> &coeffs,
+                         const std::vector<pauli_names_t> &paulis,
+                         const std::vector<pauli_wires_t> &wires) {
+            return expval<PrecisionT>(
+                sv, to_hamiltonian(sv, coeffs, paulis, wires));
+        },
+        "Expectation value of a linear combination of Pauli words.");
+    m.def(
+        "var_hamiltonian",
+        [to_hamiltonian](const StateVecBinder<PrecisionT> &sv,
+                         const std::vector<PrecisionT> &coeffs,
+                         const std::vector<pauli_names_t> &paulis,
+                         const std::vector<pauli_wires_t> &wires) {
+            return var<PrecisionT>(sv,
+                                   to_hamiltonian(sv, coeffs, paulis, wires));
+        },
+        "Variance of a linear combination of Pauli words.");
+
+    m.def(
+        "expval_sparse_hamiltonian",
+        [to_sparse](const StateVecBinder<PrecisionT> &sv, const np_arr_c &data,
+                    const np_arr_idx &indices, const np_arr_idx &indptr) {
+            return expval<PrecisionT>(sv, to_sparse(data, indices, indptr));
+        },
+        "Expectation value of a sparse Hamiltonian in CSR format over all "
+        "wires.");
+    m.def(
+        "var_sparse_hamiltonian",
+        [to_sparse](const StateVecBinder<PrecisionT> &sv, const np_arr_c &data,
+                    const np_arr_idx &indices, const np_arr_idx &indptr) {
+            return var<PrecisionT>(sv, to_sparse(data, indices, indptr));
+        },
+        "Variance of a sparse Hamiltonian in CSR format over all wires.");
+    m.def(
+        "expval_matrix",
+        [](const StateVecBinder<PrecisionT> &sv, const np_arr_c &matrix,
+           const std::vector<size_t> &wires) {
+            return expval<PrecisionT>(
+                sv, std::vector<std::complex<PrecisionT>>{
+                        matrix.data(), matrix.data() + matrix.size()},
+                wires);
+        },
+        "Expectation value of a dense Hermitian matrix.");
+
+    //***********************************************************************//
+    //                              Sampling
+    //***********************************************************************//
+
+    class_name = "SamplerC" + bitsize;
+    py::class_<Sampler<PrecisionT>>(m, class_name.c_str())
+        .def(py::init<const StateVecBinder<PrecisionT> &>())
+        .def("getNumQubits", &Sampler<PrecisionT>::getNumQubits)
+        .def(
+            "sample",
+            [](const Sampler<PrecisionT> &sampler, size_t num_samples,
+               size_t seed) {
+                py::array_t<size_t> samples(num_samples);
+                sampler.sample(num_samples, seed, samples.mutable_data());
+                return samples;
+            },
+            "Draw basis state indices, with wire 0 as the most significant "
+            "bit.");
 }
 
 /**
@@ -841,6 +1468,48 @@ PYBIND11_MODULE(lightning_qubit_ops, // NOLINT: No control over Pybind internals
               &StateVector<double>::getIndicesAfterExclusion),
           "Get statevector indices for gate application");
 
+    m.def(
+        "instrumentation_enabled",
+        []() { return Pennylane::Util::INSTRUMENTATION_ENABLED; },
+        "Whether the library is built with the instrumentation counters");
+    m.def(
+        "get_instrumentation",
+        []() {
+            py::dict records;
+            for (const auto &[name, record] :
+                 Pennylane::Util::Instrumentation::getInstance()
+                     .getRecords()) {
+                records[py::str(name)] =
+                    py::dict(py::arg("calls") = record.calls,
+                             py::arg("nanoseconds") = record.nanoseconds,
+                             py::arg("bytes") = record.bytes);
+            }
+            return records;
+        },
+        "Get the call count, cumulative time in nanoseconds and bytes touched "
+        "of every instrumented operation");
+    m.def(
+        "reset_instrumentation",
+        []() { Pennylane::Util::Instrumentation::getInstance().reset(); },
+        "Clear the instrumentation counters");
+
+    py::class_<PendingOps>(m, "PendingOps")
+        .def("wait", &PendingOps::wait,
+             py::call_guard<py::gil_scoped_release>(),
+             "Block until the operations are applied, rethrowing their error "
+             "if any.")
+        .def("done", &PendingOps::done,
+             "Whether the operations are applied.");
+
+    py::dict gate_codes;
+    for (size_t op = 0; op < Pennylane::Util::NUM_GATE_OPERATIONS; op++) {
+        const auto gate_op = static_cast<Pennylane::GateOperation>(op);
+        const auto name = Pennylane::Util::getGateName(gate_op);
+        gate_codes[py::str(name.data(), name.size())] = op;
+    }
+    m.attr("GATE_CODES") = gate_codes;
+    m.attr("MATRIX_OP") = OpStream<double>::MATRIX_OP;
+
     lightning_class_bindings<float, float>(m);
     lightning_class_bindings<double, double>(m);
 }
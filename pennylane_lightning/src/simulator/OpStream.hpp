@@ -0,0 +1,278 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a packed stream of operations, submitted to the statevector in one
+ * call and optionally applied on a worker thread.
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Dispatcher.hpp"
+#include "Error.hpp"
+#include "StateVector.hpp"
+#include "Util.hpp"
+
+namespace Pennylane {
+
+/**
+ * @brief Sequence of operations given in packed form.
+ *
+ * Each operation is a one-byte code, the value of its `%GateOperation` or
+ * `MATRIX_OP` for an operation given as a matrix, and an inverse flag. The
+ * wires of all operations are concatenated in one array, as are the
+ * parameters of the gates, each gate taking the number of wires and
+ * parameters of its type. The matrices of the `MATRIX_OP` operations are
+ * given in order, and each acts on the number of wires its dimension implies.
+ *
+ * The stream is decoded and validated once on construction, into runs of
+ * gates separated by matrix operations, so that applying it only dispatches
+ * the gates, with the fusion of `%StateVector::applyGateOperations`.
+ *
+ * @tparam fp_t Floating-point precision.
+ */
+template <class fp_t = double> class OpStream {
+  public:
+    using CFP_t = std::complex<fp_t>;
+
+    /// Code of an operation given as a matrix
+    static constexpr uint8_t MATRIX_OP =
+        static_cast<uint8_t>(GateOperation::NumGates);
+
+    /**
+     * @brief Decode a packed sequence of operations.
+     *
+     * @param codes Code of each operation.
+     * @param inverses Inverse flag of each operation.
+     * @param wires Concatenated wires of the operations.
+     * @param params Concatenated parameters of the gates.
+     * @param matrices Matrix of each `MATRIX_OP` operation, in row-major
+     * order.
+     */
+    OpStream(const std::vector<uint8_t> &codes,
+             const std::vector<bool> &inverses,
+             const std::vector<size_t> &wires,
+             const std::vector<fp_t> &params,
+             std::vector<std::vector<CFP_t>> matrices)
+        : num_ops_{codes.size()}, matrices_{std::move(matrices)} {
+        PL_ABORT_IF_NOT(inverses.size() == codes.size(),
+                        "Each operation requires an inverse flag.");
+
+        size_t wire_idx = 0;
+        size_t param_idx = 0;
+        size_t matrix_idx = 0;
+        segments_.emplace_back();
+        for (size_t op = 0; op < codes.size(); op++) {
+            PL_ABORT_IF(codes[op] > MATRIX_OP, "Invalid operation code.");
+            const bool is_matrix = codes[op] == MATRIX_OP;
+            PL_ABORT_IF(is_matrix && matrix_idx >= matrices_.size(),
+                        "Missing matrix for a matrix operation.");
+
+            const auto gate_op = static_cast<GateOperation>(codes[op]);
+            const size_t num_wires =
+                is_matrix ? Util::dimSize(matrices_[matrix_idx])
+                          : Util::getGateNumWires(gate_op);
+            const size_t num_params =
+                is_matrix ? 0 : Util::getGateNumParams(gate_op);
+            PL_ABORT_IF(wire_idx + num_wires > wires.size(),
+                        "Not enough wires for the operations.");
+            PL_ABORT_IF(param_idx + num_params > params.size(),
+                        "Not enough parameters for the operations.");
+
+            std::vector<size_t> op_wires(wires.begin() + wire_idx,
+                                         wires.begin() + wire_idx + num_wires);
+            wire_idx += num_wires;
+            for (size_t w : op_wires) {
+                max_wire_ = std::max(max_wire_, w + 1);
+            }
+
+            auto &segment = segments_.back();
+            if (is_matrix) {
+                segment.matrix_idx = matrix_idx++;
+                segment.matrix_wires = std::move(op_wires);
+                segment.matrix_inverse = inverses[op];
+                segments_.emplace_back();
+                continue;
+            }
+            segment.gates.push_back(gate_op);
+            segment.wires.push_back(std::move(op_wires));
+            segment.inverses.push_back(inverses[op]);
+            segment.params.emplace_back(params.begin() + param_idx,
+                                        params.begin() + param_idx +
+                                            num_params);
+            param_idx += num_params;
+        }
+        PL_ABORT_IF_NOT(wire_idx == wires.size(),
+                        "More wires than required by the operations.");
+        PL_ABORT_IF_NOT(param_idx == params.size(),
+                        "More parameters than required by the operations.");
+        PL_ABORT_IF_NOT(matrix_idx == matrices_.size(),
+                        "More matrices than matrix operations.");
+    }
+
+    /**
+     * @brief Get the number of operations of the stream.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getNumOperations() const -> size_t { return num_ops_; }
+
+    /**
+     * @brief Apply the operations to a statevector.
+     *
+     * @param sv Statevector to update.
+     * @param max_fused_wires Maximum number of wires of a fused gate, see
+     * `%StateVector::applyOperations`.
+     */
+    void apply(StateVector<fp_t> &sv, size_t max_fused_wires = 0) const {
+        PL_ABORT_IF(max_wire_ > sv.getNumQubits(),
+                    "The operations act on wires outside the statevector.");
+        for (const auto &segment : segments_) {
+            if (!segment.gates.empty()) {
+                sv.applyGateOperations(segment.gates, segment.wires,
+                                       segment.inverses, segment.params,
+                                       max_fused_wires);
+            }
+            if (segment.matrix_idx != NO_MATRIX) {
+                sv.applyMatrix(matrices_[segment.matrix_idx],
+                               segment.matrix_wires, segment.matrix_inverse);
+            }
+        }
+    }
+
+  private:
+    static constexpr size_t NO_MATRIX = static_cast<size_t>(-1);
+
+    /// Run of gates, followed by at most one matrix operation
+    struct Segment {
+        std::vector<GateOperation> gates;
+        std::vector<std::vector<size_t>> wires;
+        std::vector<bool> inverses;
+        std::vector<std::vector<fp_t>> params;
+        size_t matrix_idx{NO_MATRIX};
+        std::vector<size_t> matrix_wires;
+        bool matrix_inverse{false};
+    };
+
+    size_t num_ops_;
+    size_t max_wire_{0};
+    std::vector<std::vector<CFP_t>> matrices_;
+    std::vector<Segment> segments_;
+};
+
+/**
+ * @brief Long-lived worker thread applying streams of operations in the order
+ * they are submitted.
+ *
+ * A single thread serves every submission, so that its OpenMP thread team is
+ * created once and reused by the kernels of all the streams, instead of once
+ * per stream as with a thread per submission.
+ *
+ * @tparam fp_t Floating-point precision.
+ */
+template <class fp_t = double> class OpStreamWorker {
+  public:
+    OpStreamWorker() : thread_{[this]() { run_(); }} {}
+
+    OpStreamWorker(const OpStreamWorker &) = delete;
+    OpStreamWorker(OpStreamWorker &&) = delete;
+    auto operator=(const OpStreamWorker &) -> OpStreamWorker & = delete;
+    auto operator=(OpStreamWorker &&) -> OpStreamWorker & = delete;
+
+    /**
+     * @brief Apply the streams still queued, then stop the thread.
+     */
+    ~OpStreamWorker() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        ready_.notify_one();
+        thread_.join();
+    }
+
+    /**
+     * @brief Queue a stream of operations to apply to a statevector.
+     *
+     * The caller keeps ownership of the statevector, which must outlive the
+     * returned future and not be accessed until it is ready, while the stream
+     * is shared with the worker. Errors raised while applying the operations
+     * are rethrown by `std::future::get`.
+     *
+     * @param stream Operations to apply.
+     * @param sv Statevector to update.
+     * @param max_fused_wires Maximum number of wires of a fused gate.
+     * @return std::future<void>
+     */
+    auto submit(std::shared_ptr<const OpStream<fp_t>> stream,
+                StateVector<fp_t> &sv, size_t max_fused_wires = 0)
+        -> std::future<void> {
+        Task task{std::move(stream), &sv, max_fused_wires, {}};
+        auto future = task.done.get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(std::move(task));
+        }
+        ready_.notify_one();
+        return future;
+    }
+
+  private:
+    struct Task {
+        std::shared_ptr<const OpStream<fp_t>> stream;
+        StateVector<fp_t> *sv{nullptr};
+        size_t max_fused_wires{0};
+        std::promise<void> done;
+    };
+
+    void run_() {
+        while (true) {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock,
+                            [this]() { return stop_ || !queue_.empty(); });
+                if (queue_.empty()) {
+                    return;
+                }
+                task = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            try {
+                task.stream->apply(*task.sv, task.max_fused_wires);
+                task.done.set_value();
+            } catch (...) {
+                task.done.set_exception(std::current_exception());
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<Task> queue_;
+    bool stop_{false};
+    std::thread thread_; // Started last, once the queue is constructed
+};
+
+} // namespace Pennylane
@@ -0,0 +1,168 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Declares the hand-vectorized single-qubit kernels and their runtime CPU
+ * dispatch.
+ *
+ * The kernels for each instruction set live in their own translation unit
+ * (`SIMDKernels_AVX2.cpp`, `SIMDKernels_AVX512.cpp`), compiled with the
+ * matching target flags. These units work on raw floating point pointers only,
+ * so no inline function from a shared header is ever emitted with wider
+ * instructions than the host supports. The kernels are only linked when the
+ * project is configured with `ENABLE_SIMD`, which defines `_ENABLE_SIMD`.
+ */
+#pragma once
+
+#include <complex>
+#include <cstddef>
+
+namespace Pennylane::SIMD {
+
+/**
+ * @brief Instruction sets with dedicated statevector kernels.
+ */
+enum class ISA { None, AVX2, AVX512 };
+
+/**
+ * @brief Minimum statevector length handled by the SIMD kernels. Smaller
+ * states fall back to the scalar kernels.
+ */
+constexpr size_t MIN_LENGTH = 16; // NOLINT(readability-magic-numbers)
+
+/// @cond DEV
+#if defined(_ENABLE_SIMD)
+namespace AVX2 {
+void applyMatrix1Q(double *arr, size_t num_qubits, size_t rev_wire,
+                   const double *matrix, size_t num_threads);
+void applyMatrix1Q(float *arr, size_t num_qubits, size_t rev_wire,
+                   const float *matrix, size_t num_threads);
+void applyDiagonal1Q(double *arr, size_t num_qubits, size_t rev_wire,
+                     const double *diag, size_t num_threads);
+void applyDiagonal1Q(float *arr, size_t num_qubits, size_t rev_wire,
+                     const float *diag, size_t num_threads);
+} // namespace AVX2
+namespace AVX512 {
+void applyMatrix1Q(double *arr, size_t num_qubits, size_t rev_wire,
+                   const double *matrix, size_t num_threads);
+void applyMatrix1Q(float *arr, size_t num_qubits, size_t rev_wire,
+                   const float *matrix, size_t num_threads);
+void applyDiagonal1Q(double *arr, size_t num_qubits, size_t rev_wire,
+                     const double *diag, size_t num_threads);
+void applyDiagonal1Q(float *arr, size_t num_qubits, size_t rev_wire,
+                     const float *diag, size_t num_threads);
+} // namespace AVX512
+#endif
+/// @endcond
+
+/**
+ * @brief Check whether the kernels for the given instruction set were built
+ * and can run on the host CPU. `ISA::None` is always supported.
+ *
+ * @param isa Instruction set.
+ * @return bool
+ */
+inline auto isSupported(ISA isa) -> bool {
+    switch (isa) {
+    case ISA::None:
+        return true;
+#if defined(_ENABLE_SIMD)
+    case ISA::AVX2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case ISA::AVX512:
+        return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Get the widest instruction set supported by the host CPU.
+ *
+ * @return ISA
+ */
+inline auto getBestISA() -> ISA {
+    static const ISA best = []() {
+        for (const ISA isa : {ISA::AVX512, ISA::AVX2}) {
+            if (isSupported(isa)) {
+                return isa;
+            }
+        }
+        return ISA::None;
+    }();
+    return best;
+}
+
+/**
+ * @brief Apply a single-qubit matrix with the kernels of the given instruction
+ * set.
+ *
+ * @tparam fp_t Floating point precision of the statevector.
+ * @param isa Instruction set. Must be supported and not `ISA::None`.
+ * @param arr Statevector data of length at least `MIN_LENGTH`.
+ * @param num_qubits Number of qubits.
+ * @param rev_wire Target bit position, i.e. `num_qubits - wire - 1`.
+ * @param matrix 2x2 matrix in row-major order.
+ * @param num_threads Number of OpenMP threads to use.
+ */
+template <class fp_t>
+void applyMatrix1Q([[maybe_unused]] ISA isa,
+                   [[maybe_unused]] std::complex<fp_t> *arr,
+                   [[maybe_unused]] size_t num_qubits,
+                   [[maybe_unused]] size_t rev_wire,
+                   [[maybe_unused]] const std::complex<fp_t> *matrix,
+                   [[maybe_unused]] size_t num_threads) {
+#if defined(_ENABLE_SIMD)
+    auto *data = reinterpret_cast<fp_t *>(arr);
+    const auto *mat = reinterpret_cast<const fp_t *>(matrix);
+    if (isa == ISA::AVX512) {
+        AVX512::applyMatrix1Q(data, num_qubits, rev_wire, mat, num_threads);
+    } else if (isa == ISA::AVX2) {
+        AVX2::applyMatrix1Q(data, num_qubits, rev_wire, mat, num_threads);
+    }
+#endif
+}
+
+/**
+ * @brief Apply a single-qubit diagonal matrix with the kernels of the given
+ * instruction set.
+ *
+ * @tparam fp_t Floating point precision of the statevector.
+ * @param isa Instruction set. Must be supported and not `ISA::None`.
+ * @param arr Statevector data of length at least `MIN_LENGTH`.
+ * @param num_qubits Number of qubits.
+ * @param rev_wire Target bit position, i.e. `num_qubits - wire - 1`.
+ * @param diag The two diagonal entries of the matrix.
+ * @param num_threads Number of OpenMP threads to use.
+ */
+template <class fp_t>
+void applyDiagonal1Q([[maybe_unused]] ISA isa,
+                     [[maybe_unused]] std::complex<fp_t> *arr,
+                     [[maybe_unused]] size_t num_qubits,
+                     [[maybe_unused]] size_t rev_wire,
+                     [[maybe_unused]] const std::complex<fp_t> *diag,
+                     [[maybe_unused]] size_t num_threads) {
+#if defined(_ENABLE_SIMD)
+    auto *data = reinterpret_cast<fp_t *>(arr);
+    const auto *d = reinterpret_cast<const fp_t *>(diag);
+    if (isa == ISA::AVX512) {
+        AVX512::applyDiagonal1Q(data, num_qubits, rev_wire, d, num_threads);
+    } else if (isa == ISA::AVX2) {
+        AVX2::applyDiagonal1Q(data, num_qubits, rev_wire, d, num_threads);
+    }
+#endif
+}
+
+} // namespace Pennylane::SIMD
@@ -0,0 +1,251 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines the loops shared by the per-instruction-set SIMD kernels.
+ *
+ * This header is only to be included by the `SIMDKernels_*.cpp` translation
+ * units. Each of them instantiates `Kernels` with register traits declared in
+ * an anonymous namespace, so all instantiations have internal linkage and
+ * cannot be merged across units compiled with different target flags. For the
+ * same reason, nothing here may use the standard library.
+ */
+#pragma once
+
+#include <cstddef>
+
+/// @cond DEV
+namespace Pennylane::SIMD::Internal {
+
+using std::size_t;
+
+/**
+ * @brief Single-qubit kernels over interleaved complex data.
+ *
+ * @tparam V Register traits providing the `fp_t` and `vec` types,
+ * `log2_complex_per_reg`, and the `load`, `store`, `set1`, `add`, `mul`,
+ * `fmaddsub`, `swapReIm` and `permute<rev_wire>` operations. `permute<r>`
+ * must exchange the complex lanes `j` and `j ^ (1 << r)` within a register.
+ */
+template <class V> struct Kernels {
+    using fp_t = typename V::fp_t;
+    using vec = typename V::vec;
+
+    static constexpr size_t LOG2_L = V::log2_complex_per_reg;
+    static constexpr size_t L = static_cast<size_t>(1U) << LOG2_L;
+
+    /**
+     * @brief Complex multiplication with the coefficient given as registers of
+     * its duplicated real and imaginary parts.
+     */
+    static inline auto cmul(vec c_re, vec c_im, vec v) -> vec {
+        return V::fmaddsub(c_re, v, V::mul(c_im, V::swapReIm(v)));
+    }
+
+    /**
+     * @brief Write complex value `c` into lane `lane` of the duplicated real
+     * and imaginary coefficient buffers.
+     */
+    static inline void fillLane(fp_t *c_re, fp_t *c_im, size_t lane,
+                                const fp_t *c) {
+        c_re[2 * lane] = c_re[2 * lane + 1] = c[0];
+        c_im[2 * lane] = c_im[2 * lane + 1] = c[1];
+    }
+
+    /**
+     * @brief Matrix kernel for target bits within a single register. Each
+     * lane combines itself and its permuted partner with lane-dependent
+     * coefficients.
+     */
+    template <size_t rev_wire>
+    static void matrixInRegister(fp_t *arr, size_t length, const fp_t *matrix,
+                                 size_t num_threads) {
+        alignas(64) fp_t a_re[2 * L]; // NOLINT(modernize-avoid-c-arrays)
+        alignas(64) fp_t a_im[2 * L]; // NOLINT(modernize-avoid-c-arrays)
+        alignas(64) fp_t b_re[2 * L]; // NOLINT(modernize-avoid-c-arrays)
+        alignas(64) fp_t b_im[2 * L]; // NOLINT(modernize-avoid-c-arrays)
+        for (size_t j = 0; j < L; j++) {
+            const bool bit = ((j >> rev_wire) & 1U) != 0;
+            fillLane(a_re, a_im, j, matrix + (bit ? 6 : 0));
+            fillLane(b_re, b_im, j, matrix + (bit ? 4 : 2));
+        }
+        const vec A_re = V::load(a_re);
+        const vec A_im = V::load(a_im);
+        const vec B_re = V::load(b_re);
+        const vec B_im = V::load(b_im);
+
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) if (num_threads > 1)        \
+    default(none) shared(arr, length, A_re, A_im, B_re, B_im)
+#else
+        static_cast<void>(num_threads);
+#endif
+        for (size_t idx = 0; idx < length; idx += L) {
+            const vec v = V::load(arr + 2 * idx);
+            const vec p = V::template permute<rev_wire>(v);
+            V::store(arr + 2 * idx,
+                     V::add(cmul(A_re, A_im, v), cmul(B_re, B_im, p)));
+        }
+    }
+
+    /**
+     * @brief Matrix kernel for target bits beyond a single register. Whole
+     * registers of the `|0>` and `|1>` halves are combined.
+     */
+    static void matrixCrossRegister(fp_t *arr, size_t length, size_t rev_wire,
+                                    const fp_t *matrix, size_t num_threads) {
+        const vec m00_re = V::set1(matrix[0]);
+        const vec m00_im = V::set1(matrix[1]);
+        const vec m01_re = V::set1(matrix[2]);
+        const vec m01_im = V::set1(matrix[3]);
+        const vec m10_re = V::set1(matrix[4]);
+        const vec m10_im = V::set1(matrix[5]);
+        const vec m11_re = V::set1(matrix[6]);
+        const vec m11_im = V::set1(matrix[7]);
+
+        const size_t shift = static_cast<size_t>(1U) << rev_wire;
+        const size_t parity_low = shift - 1;
+        const size_t parity_high = ~((shift << 1U) - 1);
+        const size_t num_iter = length >> 1U;
+
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) if (num_threads > 1)        \
+    default(none) shared(arr, shift, parity_low, parity_high, num_iter,       \
+                         m00_re, m00_im, m01_re, m01_im, m10_re, m10_im,      \
+                         m11_re, m11_im)
+#else
+        static_cast<void>(num_threads);
+#endif
+        for (size_t k = 0; k < num_iter; k += L) {
+            const size_t i0 = ((k << 1U) & parity_high) | (k & parity_low);
+            const size_t i1 = i0 | shift;
+            const vec v0 = V::load(arr + 2 * i0);
+            const vec v1 = V::load(arr + 2 * i1);
+            V::store(arr + 2 * i0, V::add(cmul(m00_re, m00_im, v0),
+                                          cmul(m01_re, m01_im, v1)));
+            V::store(arr + 2 * i1, V::add(cmul(m10_re, m10_im, v0),
+                                          cmul(m11_re, m11_im, v1)));
+        }
+    }
+
+    /**
+     * @brief Diagonal kernel for target bits within a single register.
+     */
+    template <size_t rev_wire>
+    static void diagonalInRegister(fp_t *arr, size_t length, const fp_t *diag,
+                                   size_t num_threads) {
+        alignas(64) fp_t d_re[2 * L]; // NOLINT(modernize-avoid-c-arrays)
+        alignas(64) fp_t d_im[2 * L]; // NOLINT(modernize-avoid-c-arrays)
+        for (size_t j = 0; j < L; j++) {
+            const bool bit = ((j >> rev_wire) & 1U) != 0;
+            fillLane(d_re, d_im, j, diag + (bit ? 2 : 0));
+        }
+        const vec D_re = V::load(d_re);
+        const vec D_im = V::load(d_im);
+
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) if (num_threads > 1)        \
+    default(none) shared(arr, length, D_re, D_im)
+#else
+        static_cast<void>(num_threads);
+#endif
+        for (size_t idx = 0; idx < length; idx += L) {
+            V::store(arr + 2 * idx, cmul(D_re, D_im, V::load(arr + 2 * idx)));
+        }
+    }
+
+    /**
+     * @brief Diagonal kernel for target bits beyond a single register.
+     */
+    static void diagonalCrossRegister(fp_t *arr, size_t length,
+                                      size_t rev_wire, const fp_t *diag,
+                                      size_t num_threads) {
+        const vec d0_re = V::set1(diag[0]);
+        const vec d0_im = V::set1(diag[1]);
+        const vec d1_re = V::set1(diag[2]);
+        const vec d1_im = V::set1(diag[3]);
+
+        const size_t shift = static_cast<size_t>(1U) << rev_wire;
+        const size_t parity_low = shift - 1;
+        const size_t parity_high = ~((shift << 1U) - 1);
+        const size_t num_iter = length >> 1U;
+
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) if (num_threads > 1)        \
+    default(none) shared(arr, shift, parity_low, parity_high, num_iter,       \
+                         d0_re, d0_im, d1_re, d1_im)
+#else
+        static_cast<void>(num_threads);
+#endif
+        for (size_t k = 0; k < num_iter; k += L) {
+            const size_t i0 = ((k << 1U) & parity_high) | (k & parity_low);
+            const size_t i1 = i0 | shift;
+            V::store(arr + 2 * i0, cmul(d0_re, d0_im, V::load(arr + 2 * i0)));
+            V::store(arr + 2 * i1, cmul(d1_re, d1_im, V::load(arr + 2 * i1)));
+        }
+    }
+
+    /**
+     * @brief Select the in-register kernel instantiation for `rev_wire`.
+     */
+    template <size_t r = 0>
+    static void matrixLow(fp_t *arr, size_t length, size_t rev_wire,
+                          const fp_t *matrix, size_t num_threads) {
+        if constexpr (r < LOG2_L) {
+            if (rev_wire == r) {
+                matrixInRegister<r>(arr, length, matrix, num_threads);
+            } else {
+                matrixLow<r + 1>(arr, length, rev_wire, matrix, num_threads);
+            }
+        }
+    }
+
+    /**
+     * @brief Select the in-register kernel instantiation for `rev_wire`.
+     */
+    template <size_t r = 0>
+    static void diagonalLow(fp_t *arr, size_t length, size_t rev_wire,
+                            const fp_t *diag, size_t num_threads) {
+        if constexpr (r < LOG2_L) {
+            if (rev_wire == r) {
+                diagonalInRegister<r>(arr, length, diag, num_threads);
+            } else {
+                diagonalLow<r + 1>(arr, length, rev_wire, diag, num_threads);
+            }
+        }
+    }
+
+    static void applyMatrix1Q(fp_t *arr, size_t num_qubits, size_t rev_wire,
+                              const fp_t *matrix, size_t num_threads) {
+        const size_t length = static_cast<size_t>(1U) << num_qubits;
+        if (rev_wire < LOG2_L) {
+            matrixLow(arr, length, rev_wire, matrix, num_threads);
+        } else {
+            matrixCrossRegister(arr, length, rev_wire, matrix, num_threads);
+        }
+    }
+
+    static void applyDiagonal1Q(fp_t *arr, size_t num_qubits, size_t rev_wire,
+                                const fp_t *diag, size_t num_threads) {
+        const size_t length = static_cast<size_t>(1U) << num_qubits;
+        if (rev_wire < LOG2_L) {
+            diagonalLow(arr, length, rev_wire, diag, num_threads);
+        } else {
+            diagonalCrossRegister(arr, length, rev_wire, diag, num_threads);
+        }
+    }
+};
+
+} // namespace Pennylane::SIMD::Internal
+/// @endcond
@@ -0,0 +1,100 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * AVX2 + FMA single-qubit kernels. Compiled with `-mavx2 -mfma` only; see
+ * `SIMDKernels.hpp` for the rules this unit must follow.
+ */
+#include <immintrin.h>
+
+#include "SIMDKernelsImpl.hpp"
+
+/// @cond DEV
+namespace {
+using std::size_t;
+
+struct AVX2Double {
+    using fp_t = double;
+    using vec = __m256d;
+    static constexpr size_t log2_complex_per_reg = 1;
+
+    static inline auto load(const fp_t *p) -> vec { return _mm256_loadu_pd(p); }
+    static inline void store(fp_t *p, vec v) { _mm256_storeu_pd(p, v); }
+    static inline auto set1(fp_t x) -> vec { return _mm256_set1_pd(x); }
+    static inline auto add(vec a, vec b) -> vec { return _mm256_add_pd(a, b); }
+    static inline auto mul(vec a, vec b) -> vec { return _mm256_mul_pd(a, b); }
+    static inline auto fmaddsub(vec a, vec b, vec c) -> vec {
+        return _mm256_fmaddsub_pd(a, b, c);
+    }
+    static inline auto swapReIm(vec v) -> vec {
+        return _mm256_permute_pd(v, 0b0101);
+    }
+    template <size_t rev_wire> static inline auto permute(vec v) -> vec {
+        static_assert(rev_wire == 0);
+        return _mm256_permute2f128_pd(v, v, 0x01);
+    }
+};
+
+struct AVX2Float {
+    using fp_t = float;
+    using vec = __m256;
+    static constexpr size_t log2_complex_per_reg = 2;
+
+    static inline auto load(const fp_t *p) -> vec { return _mm256_loadu_ps(p); }
+    static inline void store(fp_t *p, vec v) { _mm256_storeu_ps(p, v); }
+    static inline auto set1(fp_t x) -> vec { return _mm256_set1_ps(x); }
+    static inline auto add(vec a, vec b) -> vec { return _mm256_add_ps(a, b); }
+    static inline auto mul(vec a, vec b) -> vec { return _mm256_mul_ps(a, b); }
+    static inline auto fmaddsub(vec a, vec b, vec c) -> vec {
+        return _mm256_fmaddsub_ps(a, b, c);
+    }
+    static inline auto swapReIm(vec v) -> vec {
+        return _mm256_permute_ps(v, 0b10110001);
+    }
+    template <size_t rev_wire> static inline auto permute(vec v) -> vec {
+        static_assert(rev_wire < 2);
+        if constexpr (rev_wire == 0) {
+            return _mm256_permute_ps(v, 0b01001110);
+        } else {
+            return _mm256_permute2f128_ps(v, v, 0x01);
+        }
+    }
+};
+} // namespace
+/// @endcond
+
+namespace Pennylane::SIMD::AVX2 {
+
+void applyMatrix1Q(double *arr, size_t num_qubits, size_t rev_wire,
+                   const double *matrix, size_t num_threads) {
+    Internal::Kernels<AVX2Double>::applyMatrix1Q(arr, num_qubits, rev_wire,
+                                                 matrix, num_threads);
+}
+void applyMatrix1Q(float *arr, size_t num_qubits, size_t rev_wire,
+                   const float *matrix, size_t num_threads) {
+    Internal::Kernels<AVX2Float>::applyMatrix1Q(arr, num_qubits, rev_wire,
+                                                matrix, num_threads);
+}
+void applyDiagonal1Q(double *arr, size_t num_qubits, size_t rev_wire,
+                     const double *diag, size_t num_threads) {
+    Internal::Kernels<AVX2Double>::applyDiagonal1Q(arr, num_qubits, rev_wire,
+                                                   diag, num_threads);
+}
+void applyDiagonal1Q(float *arr, size_t num_qubits, size_t rev_wire,
+                     const float *diag, size_t num_threads) {
+    Internal::Kernels<AVX2Float>::applyDiagonal1Q(arr, num_qubits, rev_wire,
+                                                  diag, num_threads);
+}
+
+} // namespace Pennylane::SIMD::AVX2
@@ -0,0 +1,114 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * AVX-512 single-qubit kernels. Compiled with `-mavx512f` only; see
+ * `SIMDKernels.hpp` for the rules this unit must follow.
+ *
+ * Elements are exchanged with the `permutex2var` intrinsics: the in-lane
+ * permutes and shuffles pass an undefined source register, which GCC 12
+ * reports as maybe-uninitialized and breaks the `-Werror` builds.
+ */
+#include <immintrin.h>
+
+#include "SIMDKernelsImpl.hpp"
+
+/// @cond DEV
+namespace {
+using std::size_t;
+
+struct AVX512Double {
+    using fp_t = double;
+    using vec = __m512d;
+    static constexpr size_t log2_complex_per_reg = 2;
+
+    static inline auto load(const fp_t *p) -> vec { return _mm512_loadu_pd(p); }
+    static inline void store(fp_t *p, vec v) { _mm512_storeu_pd(p, v); }
+    static inline auto set1(fp_t x) -> vec { return _mm512_set1_pd(x); }
+    static inline auto add(vec a, vec b) -> vec { return _mm512_add_pd(a, b); }
+    static inline auto mul(vec a, vec b) -> vec { return _mm512_mul_pd(a, b); }
+    static inline auto fmaddsub(vec a, vec b, vec c) -> vec {
+        return _mm512_fmaddsub_pd(a, b, c);
+    }
+    static inline auto swapReIm(vec v) -> vec {
+        return _mm512_permutex2var_pd(v, xorIndex(1), v);
+    }
+    template <size_t rev_wire> static inline auto permute(vec v) -> vec {
+        static_assert(rev_wire < 2);
+        return _mm512_permutex2var_pd(v, xorIndex(2U << rev_wire), v);
+    }
+
+    /// Index vector selecting element `i ^ mask` for every element `i`
+    static inline auto xorIndex(long long mask) -> __m512i {
+        return _mm512_xor_si512(_mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0),
+                                _mm512_set1_epi64(mask));
+    }
+};
+
+struct AVX512Float {
+    using fp_t = float;
+    using vec = __m512;
+    static constexpr size_t log2_complex_per_reg = 3;
+
+    static inline auto load(const fp_t *p) -> vec { return _mm512_loadu_ps(p); }
+    static inline void store(fp_t *p, vec v) { _mm512_storeu_ps(p, v); }
+    static inline auto set1(fp_t x) -> vec { return _mm512_set1_ps(x); }
+    static inline auto add(vec a, vec b) -> vec { return _mm512_add_ps(a, b); }
+    static inline auto mul(vec a, vec b) -> vec { return _mm512_mul_ps(a, b); }
+    static inline auto fmaddsub(vec a, vec b, vec c) -> vec {
+        return _mm512_fmaddsub_ps(a, b, c);
+    }
+    static inline auto swapReIm(vec v) -> vec {
+        return _mm512_permutex2var_ps(v, xorIndex(1), v);
+    }
+    template <size_t rev_wire> static inline auto permute(vec v) -> vec {
+        static_assert(rev_wire < 3);
+        return _mm512_permutex2var_ps(v, xorIndex(2U << rev_wire), v);
+    }
+
+    /// Index vector selecting element `i ^ mask` for every element `i`
+    static inline auto xorIndex(int mask) -> __m512i {
+        return _mm512_xor_si512(
+            _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+                             0),
+            _mm512_set1_epi32(mask));
+    }
+};
+} // namespace
+/// @endcond
+
+namespace Pennylane::SIMD::AVX512 {
+
+void applyMatrix1Q(double *arr, size_t num_qubits, size_t rev_wire,
+                   const double *matrix, size_t num_threads) {
+    Internal::Kernels<AVX512Double>::applyMatrix1Q(arr, num_qubits, rev_wire,
+                                                   matrix, num_threads);
+}
+void applyMatrix1Q(float *arr, size_t num_qubits, size_t rev_wire,
+                   const float *matrix, size_t num_threads) {
+    Internal::Kernels<AVX512Float>::applyMatrix1Q(arr, num_qubits, rev_wire,
+                                                  matrix, num_threads);
+}
+void applyDiagonal1Q(double *arr, size_t num_qubits, size_t rev_wire,
+                     const double *diag, size_t num_threads) {
+    Internal::Kernels<AVX512Double>::applyDiagonal1Q(arr, num_qubits, rev_wire,
+                                                     diag, num_threads);
+}
+void applyDiagonal1Q(float *arr, size_t num_qubits, size_t rev_wire,
+                     const float *diag, size_t num_threads) {
+    Internal::Kernels<AVX512Float>::applyDiagonal1Q(arr, num_qubits, rev_wire,
+                                                    diag, num_threads);
+}
+
+} // namespace Pennylane::SIMD::AVX512
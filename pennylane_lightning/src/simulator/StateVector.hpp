@@ -25,25 +25,28 @@
 #endif
 /// @endcond
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <complex>
-#include <functional>
+#include <limits>
+#include <numeric>
 #include <set>
 #include <stdexcept>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "Dispatcher.hpp"
 #include "Error.hpp"
 #include "Gates.hpp"
+#include "Instrumentation.hpp"
+#include "SIMDKernels.hpp"
 #include "Util.hpp"
 
 #include <iostream>
 
 /// @cond DEV
 namespace {
-using namespace std::placeholders;
-using std::bind;
 using std::size_t;
 using std::string;
 using std::vector;
@@ -69,27 +72,16 @@ template <class fp_t = double> class StateVector {
   private:
     using CFP_t = std::complex<fp_t>;
 
-    /***********************************************************************
-     *
-     * @brief The function dispatching implementation allow the gates to be
-     *called directly using a string representation of their names. This enables
-     *simplifcation of the call process from Python.
-     *
-     ***********************************************************************/
-
-    using Func =
-        std::function<void(const vector<size_t> &, const vector<size_t> &, bool,
-                           const vector<fp_t> &)>;
-
-    using FMap = std::unordered_map<string, Func>;
-
-    //***********************************************************************//
-
     CFP_t *arr_{nullptr};
     size_t length_{0};
     size_t num_qubits_{0};
-    const std::unordered_map<string, size_t> gate_wires_;
-    const FMap gates_;
+
+    size_t num_threads_{Util::getMaxNumThreads()};
+    size_t parallel_threshold_{DEFAULT_PARALLEL_THRESHOLD};
+    SIMD::ISA simd_isa_{SIMD::getBestISA()};
+    size_t cache_block_qubits_{0};
+    size_t reorder_qubits_{0};
+    vector<size_t> reorder_wires_;
 
   public:
     /**
@@ -97,7 +89,46 @@ template <class fp_t = double> class StateVector {
      */
     using scalar_type_t = fp_t;
 
-    StateVector() : gate_wires_{} {};
+    /**
+     * @brief Default minimum number of statevector elements before the gate
+     * kernels split their loops across OpenMP threads.
+     */
+    static constexpr size_t DEFAULT_PARALLEL_THRESHOLD =
+        (1U << 14U); // NOLINT(readability-magic-numbers)
+
+    /**
+     * @brief Minimum number of wires for which `applyMatrix` multiplies
+     * blocks of gathered amplitudes by the matrix as a matrix-matrix product.
+     */
+    static constexpr size_t DENSE_MATRIX_MIN_WIRES = 3;
+
+    /**
+     * @brief Number of amplitudes gathered per block by the matrix-matrix
+     * path of `applyMatrix`, sized for the block to stay in the L1 cache.
+     */
+    static constexpr size_t DENSE_MATRIX_BLOCK_ELEMENTS =
+        (1U << 11U); // NOLINT(readability-magic-numbers)
+
+    /**
+     * @brief Maximum number of combined wires of a run of consecutive diagonal
+     * gates that `applyOperations` merges into one `applyDiagonal` call.
+     */
+    static constexpr size_t DIAGONAL_FUSION_MAX_WIRES = 12;
+
+    /**
+     * @brief Base-2 logarithm of the number of contiguous amplitudes per block
+     * of `applyDiagonal`, whose diagonal indices are looked up from a table.
+     */
+    static constexpr size_t DIAGONAL_BLOCK_BITS = 10;
+
+    /**
+     * @brief Minimum number of additional gates acting on a wire, compared to
+     * the wire it displaces, for automatic wire reordering to exchange them,
+     * as each exchange costs two passes over the statevector.
+     */
+    static constexpr size_t REORDER_MIN_GAIN = 4;
+
+    StateVector() = default;
 
     /**
      * @brief Construct a new `%StateVector` object from a given complex data
@@ -108,167 +139,7 @@ template <class fp_t = double> class StateVector {
      * power-of-2 (qubits only).
      */
     StateVector(CFP_t *arr, size_t length)
-        : arr_{arr}, length_{length}, num_qubits_{Util::log2(length_)},
-          gate_wires_{
-              // Add mapping from function name to required wires.
-              {"PauliX", 1},   {"PauliY", 1},     {"PauliZ", 1},
-              {"Hadamard", 1}, {"T", 1},          {"S", 1},
-              {"RX", 1},       {"RY", 1},         {"RZ", 1},
-              {"Rot", 1},      {"PhaseShift", 1}, {"ControlledPhaseShift", 2},
-              {"CNOT", 2},     {"SWAP", 2},       {"CZ", 2},
-              {"CRX", 2},      {"CRY", 2},        {"CRZ", 2},
-              {"CRot", 2},     {"CSWAP", 3},      {"Toffoli", 3}},
-          gates_{
-              // Add mapping from function name to generalised signature for
-              // dispatch. Methods exist with the same signatures to simplify
-              // dispatch. Non-parametric gate-calls will ignore the parameter
-              // arguments if unused.
-              {"PauliX",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyPauliX_(std::forward<decltype(PH1)>(PH1),
-                                std::forward<decltype(PH2)>(PH2),
-                                std::forward<decltype(PH3)>(PH3),
-                                std::forward<decltype(PH4)>(PH4));
-               }},
-              {"PauliY",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyPauliY_(std::forward<decltype(PH1)>(PH1),
-                                std::forward<decltype(PH2)>(PH2),
-                                std::forward<decltype(PH3)>(PH3),
-                                std::forward<decltype(PH4)>(PH4));
-               }},
-              {"PauliZ",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyPauliZ_(std::forward<decltype(PH1)>(PH1),
-                                std::forward<decltype(PH2)>(PH2),
-                                std::forward<decltype(PH3)>(PH3),
-                                std::forward<decltype(PH4)>(PH4));
-               }},
-              {"Hadamard",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyHadamard_(std::forward<decltype(PH1)>(PH1),
-                                  std::forward<decltype(PH2)>(PH2),
-                                  std::forward<decltype(PH3)>(PH3),
-                                  std::forward<decltype(PH4)>(PH4));
-               }},
-              {"S",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyS_(std::forward<decltype(PH1)>(PH1),
-                           std::forward<decltype(PH2)>(PH2),
-                           std::forward<decltype(PH3)>(PH3),
-                           std::forward<decltype(PH4)>(PH4));
-               }},
-              {"T",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyT_(std::forward<decltype(PH1)>(PH1),
-                           std::forward<decltype(PH2)>(PH2),
-                           std::forward<decltype(PH3)>(PH3),
-                           std::forward<decltype(PH4)>(PH4));
-               }},
-              {"CNOT",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyCNOT_(std::forward<decltype(PH1)>(PH1),
-                              std::forward<decltype(PH2)>(PH2),
-                              std::forward<decltype(PH3)>(PH3),
-                              std::forward<decltype(PH4)>(PH4));
-               }},
-              {"SWAP",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applySWAP_(std::forward<decltype(PH1)>(PH1),
-                              std::forward<decltype(PH2)>(PH2),
-                              std::forward<decltype(PH3)>(PH3),
-                              std::forward<decltype(PH4)>(PH4));
-               }},
-              {"CSWAP",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyCSWAP_(std::forward<decltype(PH1)>(PH1),
-                               std::forward<decltype(PH2)>(PH2),
-                               std::forward<decltype(PH3)>(PH3),
-                               std::forward<decltype(PH4)>(PH4));
-               }},
-              {"CZ",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyCZ_(std::forward<decltype(PH1)>(PH1),
-                            std::forward<decltype(PH2)>(PH2),
-                            std::forward<decltype(PH3)>(PH3),
-                            std::forward<decltype(PH4)>(PH4));
-               }},
-              {"Toffoli",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyToffoli_(std::forward<decltype(PH1)>(PH1),
-                                 std::forward<decltype(PH2)>(PH2),
-                                 std::forward<decltype(PH3)>(PH3),
-                                 std::forward<decltype(PH4)>(PH4));
-               }},
-              {"PhaseShift",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyPhaseShift_(std::forward<decltype(PH1)>(PH1),
-                                    std::forward<decltype(PH2)>(PH2),
-                                    std::forward<decltype(PH3)>(PH3),
-                                    std::forward<decltype(PH4)>(PH4));
-               }},
-              {"ControlledPhaseShift",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyControlledPhaseShift_(std::forward<decltype(PH1)>(PH1),
-                                              std::forward<decltype(PH2)>(PH2),
-                                              std::forward<decltype(PH3)>(PH3),
-                                              std::forward<decltype(PH4)>(PH4));
-               }},
-              {"RX",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyRX_(std::forward<decltype(PH1)>(PH1),
-                            std::forward<decltype(PH2)>(PH2),
-                            std::forward<decltype(PH3)>(PH3),
-                            std::forward<decltype(PH4)>(PH4));
-               }},
-              {"RY",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyRY_(std::forward<decltype(PH1)>(PH1),
-                            std::forward<decltype(PH2)>(PH2),
-                            std::forward<decltype(PH3)>(PH3),
-                            std::forward<decltype(PH4)>(PH4));
-               }},
-              {"RZ",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyRZ_(std::forward<decltype(PH1)>(PH1),
-                            std::forward<decltype(PH2)>(PH2),
-                            std::forward<decltype(PH3)>(PH3),
-                            std::forward<decltype(PH4)>(PH4));
-               }},
-              {"Rot",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyRot_(std::forward<decltype(PH1)>(PH1),
-                             std::forward<decltype(PH2)>(PH2),
-                             std::forward<decltype(PH3)>(PH3),
-                             std::forward<decltype(PH4)>(PH4));
-               }},
-              {"CRX",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyCRX_(std::forward<decltype(PH1)>(PH1),
-                             std::forward<decltype(PH2)>(PH2),
-                             std::forward<decltype(PH3)>(PH3),
-                             std::forward<decltype(PH4)>(PH4));
-               }},
-              {"CRY",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyCRY_(std::forward<decltype(PH1)>(PH1),
-                             std::forward<decltype(PH2)>(PH2),
-                             std::forward<decltype(PH3)>(PH3),
-                             std::forward<decltype(PH4)>(PH4));
-               }},
-              {"CRZ",
-               [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyCRZ_(std::forward<decltype(PH1)>(PH1),
-                             std::forward<decltype(PH2)>(PH2),
-                             std::forward<decltype(PH3)>(PH3),
-                             std::forward<decltype(PH4)>(PH4));
-               }},
-              {"CRot", [this](auto &&PH1, auto &&PH2, auto &&PH3, auto &&PH4) {
-                   applyCRot_(std::forward<decltype(PH1)>(PH1),
-                              std::forward<decltype(PH2)>(PH2),
-                              std::forward<decltype(PH3)>(PH3),
-                              std::forward<decltype(PH4)>(PH4));
-               }}} {};
+        : arr_{arr}, length_{length}, num_qubits_{Util::log2(length_)} {}
 
     /**
      * @brief Get the underlying data pointer.
@@ -327,6 +198,157 @@ template <class fp_t = double> class StateVector {
         return num_qubits_;
     }
 
+    /**
+     * @brief Set the number of OpenMP threads used by the gate kernels.
+     * Defaults to the OpenMP maximum (`OMP_NUM_THREADS`), and has no effect
+     * when built without OpenMP.
+     *
+     * @param num_threads Number of threads. Must be at least 1.
+     */
+    void setNumThreads(size_t num_threads) {
+        PL_ABORT_IF(num_threads == 0, "The number of threads must be positive.")
+        num_threads_ = num_threads;
+    }
+
+    /**
+     * @brief Get the number of OpenMP threads used by the gate kernels.
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]] auto getNumThreads() const -> std::size_t {
+        return num_threads_;
+    }
+
+    /**
+     * @brief Set the minimum number of statevector elements for which the gate
+     * kernels run in parallel. Smaller states are processed by a single
+     * thread to avoid the cost of spawning a parallel region.
+     *
+     * @param length Minimum statevector length for multithreaded kernels.
+     */
+    void setParallelThreshold(size_t length) { parallel_threshold_ = length; }
+
+    /**
+     * @brief Get the minimum number of statevector elements for which the gate
+     * kernels run in parallel.
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]] auto getParallelThreshold() const -> std::size_t {
+        return parallel_threshold_;
+    }
+
+    /**
+     * @brief Select the instruction set of the vectorized single-qubit
+     * kernels. Defaults to the widest one supported by the CPU, and
+     * `SIMD::ISA::None` selects the scalar kernels.
+     *
+     * @param isa Instruction set. Must be supported by the build and the CPU.
+     */
+    void setKernelISA(SIMD::ISA isa) {
+        PL_ABORT_IF_NOT(SIMD::isSupported(isa),
+                        "The requested instruction set is not supported.")
+        simd_isa_ = isa;
+    }
+
+    /**
+     * @brief Get the instruction set of the vectorized single-qubit kernels.
+     *
+     * @return SIMD::ISA
+     */
+    [[nodiscard]] auto getKernelISA() const -> SIMD::ISA { return simd_isa_; }
+
+    /**
+     * @brief Enable cache blocking in `applyOperations`.
+     *
+     * Consecutive gates acting only on the `block_qubits` lowest-order qubits
+     * (the last wires) are then applied block by block: every gate of the
+     * group to the first `2^block_qubits` amplitudes, then every gate to the
+     * next block, and so on, so that each block is loaded from memory once
+     * per group rather than once per gate. Gates on disjoint wires are
+     * reordered to make the groups as large as possible. Higher-order wires
+     * are brought into the blocks by exchanging them with the low-order wires
+     * needed last, several wires at a time in one pass over the statevector,
+     * and the wire order is restored once all gates are applied.
+     *
+     * @param block_qubits Number of qubits of a block, chosen so that a block
+     * fits in the cache (e.g. 16 for 1 MiB of `complex<double>`). Zero, the
+     * default, disables cache blocking, as does a value not smaller than the
+     * number of qubits.
+     */
+    void setCacheBlockQubits(size_t block_qubits) {
+        cache_block_qubits_ = block_qubits;
+    }
+
+    /**
+     * @brief Get the number of qubits of a cache block, zero if cache blocking
+     * is disabled.
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]] auto getCacheBlockQubits() const -> std::size_t {
+        return cache_block_qubits_;
+    }
+
+    /**
+     * @brief Enable wire reordering in `applyOperations`.
+     *
+     * The strides of the gate kernels grow with the significance of the
+     * qubits they act on, the first wires being the most significant, so that
+     * gates on them touch amplitudes pages apart. With reordering, the
+     * `num_qubits` wires used by the most gates of a batch are exchanged onto
+     * the lowest-order positions for the batch, in one pass over the
+     * statevector, and exchanged back once it is applied. A wire only
+     * displaces another one if it is used by at least `REORDER_MIN_GAIN` more
+     * gates. The amplitudes are thus in wire order whenever `applyOperations`
+     * returns, for every reader of the data.
+     *
+     * @param num_qubits Number of low-order positions to fill with the wires
+     * used most. Zero, the default, disables reordering. Ignored when cache
+     * blocking, which already moves the wires of the gates to the low-order
+     * positions, is enabled.
+     */
+    void setReorderQubits(size_t num_qubits) { reorder_qubits_ = num_qubits; }
+
+    /**
+     * @brief Get the number of low-order positions filled by wire reordering,
+     * zero if automatic reordering is disabled.
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]] auto getReorderQubits() const -> std::size_t {
+        return reorder_qubits_;
+    }
+
+    /**
+     * @brief Move the given wires to the lowest-order positions for every
+     * batch of `applyOperations`, in place of the wires chosen from the gates
+     * by `setReorderQubits`.
+     *
+     * @param wires Distinct wires of the statevector. Empty, the default,
+     * restores the automatic choice.
+     */
+    void setReorderWires(const vector<size_t> &wires) {
+        for (size_t i = 0; i < wires.size(); i++) {
+            PL_ABORT_IF_NOT(wires[i] < num_qubits_,
+                            "Invalid wire to reorder.");
+            PL_ABORT_IF(std::find(wires.begin() + i + 1, wires.end(),
+                                  wires[i]) != wires.end(),
+                        "Each wire may only appear once.");
+        }
+        reorder_wires_ = wires;
+    }
+
+    /**
+     * @brief Get the wires moved to the lowest-order positions by
+     * `setReorderWires`.
+     *
+     * @return const vector<size_t>&
+     */
+    [[nodiscard]] auto getReorderWires() const -> const vector<size_t> & {
+        return reorder_wires_;
+    }
+
     /**
      * @brief Apply a single gate to the state-vector.
      *
@@ -337,19 +359,88 @@ template <class fp_t = double> class StateVector {
      */
     void applyOperation(const string &opName, const vector<size_t> &wires,
                         bool inverse = false, const vector<fp_t> &params = {}) {
-        const auto gate = gates_.at(opName);
-        if (gate_wires_.at(opName) != wires.size()) {
-            throw std::invalid_argument(
-                string("The gate of type ") + opName + " requires " +
-                std::to_string(gate_wires_.at(opName)) + " wires, but " +
-                std::to_string(wires.size()) + " were supplied");
-        }
+        applyOperation(Util::lookupGateOperation(opName), wires, inverse,
+                       params);
+    }
+
+    /**
+     * @brief Apply a single gate to the state-vector.
+     *
+     * @param gate_op Gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(GateOperation gate_op, const vector<size_t> &wires,
+                        bool inverse = false, const vector<fp_t> &params = {}) {
+        static constexpr auto gate_table = makeGateTable_(
+            std::make_index_sequence<Util::NUM_GATE_OPERATIONS>{});
+        PL_ABORT_IF_NOT(static_cast<size_t>(gate_op) <
+                            Util::NUM_GATE_OPERATIONS,
+                        "Invalid gate operation.");
+        PL_INSTRUMENT_SCOPE(Util::getGateName(gate_op),
+                            2 * length_ * sizeof(CFP_t));
+        (this->*gate_table[static_cast<size_t>(gate_op)])(wires, inverse,
+                                                           params);
+    }
 
-        const vector<size_t> internalIndices = generateBitPatterns(wires);
-        const vector<size_t> externalWires = getIndicesAfterExclusion(wires);
-        const vector<size_t> externalIndices =
-            generateBitPatterns(externalWires);
-        gate(internalIndices, externalIndices, inverse, params);
+    /**
+     * @brief Apply a single gate known at compile time to the state-vector.
+     *
+     * @tparam gate_op Gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    template <GateOperation gate_op>
+    void applyOperation(const vector<size_t> &wires, bool inverse = false,
+                        const vector<fp_t> &params = {}) {
+        checkGateWires_(gate_op, wires);
+        if constexpr (gate_op == GateOperation::PauliX) {
+            applyPauliX_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::PauliY) {
+            applyPauliY_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::PauliZ) {
+            applyPauliZ_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::Hadamard) {
+            applyHadamard_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::S) {
+            applyS_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::T) {
+            applyT_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::RX) {
+            applyRX_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::RY) {
+            applyRY_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::RZ) {
+            applyRZ_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::PhaseShift) {
+            applyPhaseShift_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::Rot) {
+            applyRot_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::CNOT) {
+            applyCNOT_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::SWAP) {
+            applySWAP_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::CZ) {
+            applyCZ_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::ControlledPhaseShift) {
+            applyControlledPhaseShift_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::CRX) {
+            applyCRX_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::CRY) {
+            applyCRY_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::CRZ) {
+            applyCRZ_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::CRot) {
+            applyCRot_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::CSWAP) {
+            applyCSWAP_(wires, inverse, params);
+        } else if constexpr (gate_op == GateOperation::Toffoli) {
+            applyToffoli_(wires, inverse, params);
+        } else {
+            static_assert(gate_op != gate_op, "Unhandled gate operation.");
+        }
     }
 
     /**
@@ -371,13 +462,7 @@ template <class fp_t = double> class StateVector {
                                         std::to_string(wires.size()) +
                                         " were supplied.");
         }
-
-        const vector<size_t> internalIndices = generateBitPatterns(wires);
-        const vector<size_t> externalWires = getIndicesAfterExclusion(wires);
-        const vector<size_t> externalIndices =
-            generateBitPatterns(externalWires);
-
-        applyMatrix(matrix, internalIndices, externalIndices, inverse);
+        applyMatrix(matrix, wires, inverse);
     }
 
     /**
@@ -387,21 +472,81 @@ template <class fp_t = double> class StateVector {
      * @param wires Vector of wires on which to apply index-matched gate name.
      * @param inverse Indicates whether gate at matched index is to be inverted.
      * @param params Optional parameter data for index matched gates.
+     * @param max_fused_wires Maximum number of wires of a fused gate. When
+     * non-zero, runs of consecutive gates acting on at most this many wires
+     * are merged into a single dense matrix and applied in one sweep over the
+     * statevector. Zero disables fusion. Runs of consecutive diagonal gates
+     * are merged into one diagonal independently of this setting. Neither
+     * applies when cache blocking is enabled, see `setCacheBlockQubits`.
+     * Otherwise the wires used most may first be moved to the lowest-order
+     * positions, see `setReorderQubits`.
      */
     void applyOperations(const vector<string> &ops,
                          const vector<vector<size_t>> &wires,
                          const vector<bool> &inverse,
-                         const vector<vector<fp_t>> &params) {
-        const size_t numOperations = ops.size();
+                         const vector<vector<fp_t>> &params,
+                         size_t max_fused_wires = 0) {
+        vector<GateOperation> gate_ops(ops.size());
+        for (size_t i = 0; i < ops.size(); i++) {
+            gate_ops[i] = Util::lookupGateOperation(ops[i]);
+        }
+        applyGateOperations(gate_ops, wires, inverse, params, max_fused_wires);
+    }
+
+    /**
+     * @brief Apply multiple gates, given by identifier, to the state-vector.
+     *
+     * @see applyOperations(const vector<string> &ops, const
+     * vector<vector<size_t>> &wires, const vector<bool> &inverse, const
+     * vector<vector<fp_t>> &params, size_t max_fused_wires)
+     */
+    void applyGateOperations(const vector<GateOperation> &gate_ops,
+                             const vector<vector<size_t>> &wires,
+                             const vector<bool> &inverse,
+                             const vector<vector<fp_t>> &params,
+                             size_t max_fused_wires = 0) {
+        const size_t numOperations = gate_ops.size();
         if (numOperations != wires.size() || numOperations != params.size()) {
             throw std::invalid_argument(
                 "Invalid arguments: number of operations, wires, and "
                 "parameters must all be equal");
         }
-
         for (size_t i = 0; i < numOperations; i++) {
-            applyOperation(ops[i], wires[i], inverse[i], params[i]);
+            checkGateWires_(gate_ops[i], wires[i]);
+        }
+
+        if (cache_block_qubits_ > 0 && cache_block_qubits_ < num_qubits_) {
+            applyCacheBlocked_(gate_ops, wires, inverse, params);
+            return;
+        }
+
+        const auto reorder_pairs = getReorderPairs_(wires);
+        if (reorder_pairs.empty()) {
+            applyGateRuns_(gate_ops, wires, inverse, params, max_fused_wires);
+            return;
+        }
+
+        // Physical position of every wire during the batch
+        vector<size_t> position(num_qubits_);
+        std::iota(position.begin(), position.end(), 0);
+        for (const auto &[pos0, pos1] : reorder_pairs) {
+            std::swap(position[pos0], position[pos1]);
+        }
+        vector<vector<size_t>> physical_wires{wires};
+        for (auto &op_wires : physical_wires) {
+            for (auto &wire : op_wires) {
+                wire = (wire < num_qubits_) ? position[wire] : wire;
+            }
         }
+        swapQubitPairs_(reorder_pairs);
+        try {
+            applyGateRuns_(gate_ops, physical_wires, inverse, params,
+                           max_fused_wires);
+        } catch (...) {
+            swapQubitPairs_(reorder_pairs);
+            throw;
+        }
+        swapQubitPairs_(reorder_pairs);
     }
     /**
      * @brief Apply multiple gates to the state-vector.
@@ -413,16 +558,8 @@ template <class fp_t = double> class StateVector {
     void applyOperations(const vector<string> &ops,
                          const vector<vector<size_t>> &wires,
                          const vector<bool> &inverse) {
-        const size_t numOperations = ops.size();
-        if (numOperations != wires.size()) {
-            throw std::invalid_argument(
-                "Invalid arguments: number of operations, wires, and "
-                "parameters must all be equal");
-        }
-
-        for (size_t i = 0; i < numOperations; i++) {
-            applyOperation(ops[i], wires[i], inverse[i]);
-        }
+        applyOperations(ops, wires, inverse,
+                        vector<vector<fp_t>>(ops.size()));
     }
 
     /**
@@ -468,6 +605,8 @@ template <class fp_t = double> class StateVector {
      */
     static auto generateBitPatterns(const vector<size_t> &qubitIndices,
                                     size_t num_qubits) -> vector<size_t> {
+        PL_INSTRUMENT_SCOPE("generateBitPatterns",
+                            Util::exp2(qubitIndices.size()) * sizeof(size_t));
         vector<size_t> indices;
         indices.reserve(Util::exp2(qubitIndices.size()));
         indices.emplace_back(0);
@@ -505,42 +644,7 @@ template <class fp_t = double> class StateVector {
      */
     void applyMatrix(const vector<CFP_t> &matrix, const vector<size_t> &indices,
                      const vector<size_t> &externalIndices, bool inverse) {
-        if (static_cast<size_t>(1ULL << (Util::log2(indices.size()) +
-                                         Util::log2(externalIndices.size()))) !=
-            length_) {
-            throw std::out_of_range(
-                "The given indices do not match the state-vector length.");
-        }
-
-        vector<CFP_t> v(indices.size());
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
-            // Gather
-            size_t pos = 0;
-            for (const size_t &index : indices) {
-                v[pos] = shiftedState[index];
-                pos++;
-            }
-
-            // Apply + scatter
-            for (size_t i = 0; i < indices.size(); i++) {
-                size_t index = indices[i];
-                shiftedState[index] = 0;
-
-                if (inverse) {
-                    for (size_t j = 0; j < indices.size(); j++) {
-                        const size_t baseIndex = j * indices.size();
-                        shiftedState[index] +=
-                            std::conj(matrix[baseIndex + i]) * v[j];
-                    }
-                } else {
-                    const size_t baseIndex = i * indices.size();
-                    for (size_t j = 0; j < indices.size(); j++) {
-                        shiftedState[index] += matrix[baseIndex + j] * v[j];
-                    }
-                }
-            }
-        }
+        applyMatrix(matrix.data(), indices, externalIndices, inverse);
     }
 
     /**
@@ -561,31 +665,44 @@ template <class fp_t = double> class StateVector {
                 "The given indices do not match the state-vector length.");
         }
 
-        vector<CFP_t> v(indices.size());
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
-            // Gather
-            size_t pos = 0;
-            for (const size_t &index : indices) {
-                v[pos] = shiftedState[index];
-                pos++;
-            }
+        const size_t num_indices = indices.size();
+        const size_t num_externals = externalIndices.size();
+        [[maybe_unused]] const bool parallel = useParallel_();
 
-            // Apply + scatter
-            for (size_t i = 0; i < indices.size(); i++) {
-                size_t index = indices[i];
-                shiftedState[index] = 0;
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(num_threads_) if (parallel) default(none)     \
+    shared(matrix, indices, externalIndices, inverse, num_indices,             \
+           num_externals)
+#endif
+        {
+            // Each thread gathers into its own scratch buffer
+            vector<CFP_t> v(num_indices);
+#if defined(_OPENMP)
+#pragma omp for
+#endif
+            for (size_t k = 0; k < num_externals; k++) {
+                CFP_t *shiftedState = arr_ + externalIndices[k];
+                // Gather
+                for (size_t pos = 0; pos < num_indices; pos++) {
+                    v[pos] = shiftedState[indices[pos]];
+                }
 
-                if (inverse) {
-                    for (size_t j = 0; j < indices.size(); j++) {
-                        const size_t baseIndex = j * indices.size();
-                        shiftedState[index] +=
-                            std::conj(matrix[baseIndex + i]) * v[j];
-                    }
-                } else {
-                    const size_t baseIndex = i * indices.size();
-                    for (size_t j = 0; j < indices.size(); j++) {
-                        shiftedState[index] += matrix[baseIndex + j] * v[j];
+                // Apply + scatter
+                for (size_t i = 0; i < num_indices; i++) {
+                    const size_t index = indices[i];
+                    shiftedState[index] = 0;
+
+                    if (inverse) {
+                        for (size_t j = 0; j < num_indices; j++) {
+                            const size_t baseIndex = j * num_indices;
+                            shiftedState[index] +=
+                                std::conj(matrix[baseIndex + i]) * v[j];
+                        }
+                    } else {
+                        const size_t baseIndex = i * num_indices;
+                        for (size_t j = 0; j < num_indices; j++) {
+                            shiftedState[index] += matrix[baseIndex + j] * v[j];
+                        }
                     }
                 }
             }
@@ -604,10 +721,9 @@ template <class fp_t = double> class StateVector {
     void applyPauliX(const vector<size_t> &indices,
                      const vector<size_t> &externalIndices,
                      [[maybe_unused]] bool inverse) {
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             std::swap(shiftedState[indices[0]], shiftedState[indices[1]]);
-        }
+        });
     }
 
     /**
@@ -622,13 +738,12 @@ template <class fp_t = double> class StateVector {
     void applyPauliY(const vector<size_t> &indices,
                      const vector<size_t> &externalIndices,
                      [[maybe_unused]] bool inverse) {
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             CFP_t v0 = shiftedState[indices[0]];
             shiftedState[indices[0]] = CFP_t{shiftedState[indices[1]].imag(),
                                              -shiftedState[indices[1]].real()};
             shiftedState[indices[1]] = CFP_t{-v0.imag(), v0.real()};
-        }
+        });
     }
 
     /**
@@ -643,10 +758,9 @@ template <class fp_t = double> class StateVector {
     void applyPauliZ(const vector<size_t> &indices,
                      const vector<size_t> &externalIndices,
                      [[maybe_unused]] bool inverse) {
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             shiftedState[indices[1]] = -shiftedState[indices[1]];
-        }
+        });
     }
 
     /**
@@ -661,15 +775,13 @@ template <class fp_t = double> class StateVector {
     void applyHadamard(const vector<size_t> &indices,
                        const vector<size_t> &externalIndices,
                        [[maybe_unused]] bool inverse) {
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
-
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             const CFP_t v0 = shiftedState[indices[0]];
             const CFP_t v1 = shiftedState[indices[1]];
 
             shiftedState[indices[0]] = Util::INVSQRT2<fp_t>() * (v0 + v1);
             shiftedState[indices[1]] = Util::INVSQRT2<fp_t>() * (v0 - v1);
-        }
+        });
     }
 
     /**
@@ -686,10 +798,9 @@ template <class fp_t = double> class StateVector {
         const CFP_t shift =
             (inverse) ? -Util::IMAG<fp_t>() : Util::IMAG<fp_t>();
 
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             shiftedState[indices[1]] *= shift;
-        }
+        });
     }
 
     /**
@@ -708,10 +819,9 @@ template <class fp_t = double> class StateVector {
                 ? std::conj(std::exp(CFP_t(0, static_cast<fp_t>(M_PI / 4))))
                 : std::exp(CFP_t(0, static_cast<fp_t>(M_PI / 4)));
 
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             shiftedState[indices[1]] *= shift;
-        }
+        });
     }
 
     /**
@@ -734,15 +844,14 @@ template <class fp_t = double> class StateVector {
         const Param_t js =
             (inverse) ? -std::sin(-angle / 2) : std::sin(-angle / 2);
 
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             const CFP_t v0 = shiftedState[indices[0]];
             const CFP_t v1 = shiftedState[indices[1]];
             shiftedState[indices[0]] =
                 c * v0 + js * CFP_t{-v1.imag(), v1.real()};
             shiftedState[indices[1]] =
                 js * CFP_t{-v0.imag(), v0.real()} + c * v1;
-        }
+        });
     }
     /**
      * @brief Apply RY gate operation to given indices of statevector.
@@ -764,13 +873,12 @@ template <class fp_t = double> class StateVector {
         const Param_t s =
             (inverse) ? -std::sin(angle / 2) : std::sin(angle / 2);
 
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             const CFP_t v0 = shiftedState[indices[0]];
             const CFP_t v1 = shiftedState[indices[1]];
             shiftedState[indices[0]] = c * v0 - s * v1;
             shiftedState[indices[1]] = s * v0 + c * v1;
-        }
+        });
     }
     /**
      * @brief Apply RZ gate operation to given indices of statevector.
@@ -793,11 +901,10 @@ template <class fp_t = double> class StateVector {
         const CFP_t shift1 = (inverse) ? std::conj(first) : first;
         const CFP_t shift2 = (inverse) ? std::conj(second) : second;
 
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             shiftedState[indices[0]] *= shift1;
             shiftedState[indices[1]] *= shift2;
-        }
+        });
     }
     /**
      * @brief Apply phase shift gate operation to given indices of statevector.
@@ -817,10 +924,9 @@ template <class fp_t = double> class StateVector {
                          Param_t angle) {
         const CFP_t s = inverse ? std::conj(std::exp(CFP_t(0, angle)))
                                 : std::exp(CFP_t(0, angle));
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             shiftedState[indices[1]] *= s;
-        }
+        });
     }
 
     /**
@@ -842,10 +948,9 @@ template <class fp_t = double> class StateVector {
                                    bool inverse, Param_t angle) {
         const CFP_t s = inverse ? std::conj(std::exp(CFP_t(0, angle)))
                                 : std::exp(CFP_t(0, angle));
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             shiftedState[indices[3]] *= s;
-        }
+        });
     }
 
     /**
@@ -874,13 +979,12 @@ template <class fp_t = double> class StateVector {
         const CFP_t t3 = (inverse) ? -rot[2] : rot[2];
         const CFP_t t4 = (inverse) ? std::conj(rot[3]) : rot[3];
 
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             const CFP_t v0 = shiftedState[indices[0]];
             const CFP_t v1 = shiftedState[indices[1]];
             shiftedState[indices[0]] = t1 * v0 + t2 * v1;
             shiftedState[indices[1]] = t3 * v0 + t4 * v1;
-        }
+        });
     }
 
     /**
@@ -895,10 +999,9 @@ template <class fp_t = double> class StateVector {
     void applyCNOT(const vector<size_t> &indices,
                    const vector<size_t> &externalIndices,
                    [[maybe_unused]] bool inverse) {
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             std::swap(shiftedState[indices[2]], shiftedState[indices[3]]);
-        }
+        });
     }
 
     /**
@@ -913,10 +1016,9 @@ template <class fp_t = double> class StateVector {
     void applySWAP(const vector<size_t> &indices,
                    const vector<size_t> &externalIndices,
                    [[maybe_unused]] bool inverse) {
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             std::swap(shiftedState[indices[1]], shiftedState[indices[2]]);
-        }
+        });
     }
     /**
      * @brief Apply CZ gate to given indices of statevector.
@@ -930,10 +1032,9 @@ template <class fp_t = double> class StateVector {
     void applyCZ(const vector<size_t> &indices,
                  const vector<size_t> &externalIndices,
                  [[maybe_unused]] bool inverse) {
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             shiftedState[indices[3]] *= -1;
-        }
+        });
     }
 
     /**
@@ -956,15 +1057,14 @@ template <class fp_t = double> class StateVector {
         const Param_t js =
             (inverse) ? -std::sin(-angle / 2) : std::sin(-angle / 2);
 
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             const CFP_t v0 = shiftedState[indices[2]];
             const CFP_t v1 = shiftedState[indices[3]];
             shiftedState[indices[2]] =
                 c * v0 + js * CFP_t{-v1.imag(), v1.real()};
             shiftedState[indices[3]] =
                 js * CFP_t{-v0.imag(), v0.real()} + c * v1;
-        }
+        });
     }
 
     /**
@@ -987,13 +1087,12 @@ template <class fp_t = double> class StateVector {
         const Param_t s =
             (inverse) ? -std::sin(angle / 2) : std::sin(angle / 2);
 
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             const CFP_t v0 = shiftedState[indices[2]];
             const CFP_t v1 = shiftedState[indices[3]];
             shiftedState[indices[2]] = c * v0 - s * v1;
             shiftedState[indices[3]] = s * v0 + c * v1;
-        }
+        });
     }
 
     /**
@@ -1018,11 +1117,10 @@ template <class fp_t = double> class StateVector {
         const CFP_t m11 = (inverse)
                               ? CFP_t(std::cos(angle / 2), -std::sin(angle / 2))
                               : CFP_t(std::cos(angle / 2), std::sin(angle / 2));
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             shiftedState[indices[2]] *= m00;
             shiftedState[indices[3]] *= m11;
-        }
+        });
     }
 
     /**
@@ -1051,13 +1149,12 @@ template <class fp_t = double> class StateVector {
         const CFP_t t3 = (inverse) ? -rot[2] : rot[2];
         const CFP_t t4 = (inverse) ? std::conj(rot[3]) : rot[3];
 
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             const CFP_t v0 = shiftedState[indices[2]];
             const CFP_t v1 = shiftedState[indices[3]];
             shiftedState[indices[2]] = t1 * v0 + t2 * v1;
             shiftedState[indices[3]] = t3 * v0 + t4 * v1;
-        }
+        });
     }
 
     /**
@@ -1075,11 +1172,10 @@ template <class fp_t = double> class StateVector {
         // Participating swapped indices
         static const size_t op_idx0 = 6;
         static const size_t op_idx1 = 7;
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             std::swap(shiftedState[indices[op_idx0]],
                       shiftedState[indices[op_idx1]]);
-        }
+        });
     }
 
     /**
@@ -1097,135 +1193,2191 @@ template <class fp_t = double> class StateVector {
         // Participating swapped indices
         static const size_t op_idx0 = 5;
         static const size_t op_idx1 = 6;
-        for (const size_t &externalIndex : externalIndices) {
-            CFP_t *shiftedState = arr_ + externalIndex;
+        applyKernel_(externalIndices, [&](CFP_t *shiftedState) {
             std::swap(shiftedState[indices[op_idx0]],
                       shiftedState[indices[op_idx1]]);
-        }
+        });
     }
 
-  private:
     //***********************************************************************//
-    //  Internal utility functions for opName dispatch use only.
+    //  Index-free kernels.
+    //
+    //  The following overloads take the gate wires directly and compute the
+    //  participating amplitude offsets on the fly by inserting zero bits at
+    //  the target positions of a loop counter, avoiding the allocation of
+    //  internal and external index vectors for every gate call.
     //***********************************************************************//
-    inline void applyPauliX_(const vector<size_t> &indices,
-                             const vector<size_t> &externalIndices,
-                             bool inverse, const vector<fp_t> &params) {
-        static_cast<void>(params);
-        applyPauliX(indices, externalIndices, inverse);
-    }
-    inline void applyPauliY_(const vector<size_t> &indices,
-                             const vector<size_t> &externalIndices,
-                             bool inverse, const vector<fp_t> &params) {
-        static_cast<void>(params);
-        applyPauliY(indices, externalIndices, inverse);
-    }
-    inline void applyPauliZ_(const vector<size_t> &indices,
-                             const vector<size_t> &externalIndices,
-                             bool inverse, const vector<fp_t> &params) {
-        static_cast<void>(params);
-        applyPauliZ(indices, externalIndices, inverse);
-    }
-    inline void applyHadamard_(const vector<size_t> &indices,
-                               const vector<size_t> &externalIndices,
-                               bool inverse, const vector<fp_t> &params) {
-        static_cast<void>(params);
-        applyHadamard(indices, externalIndices, inverse);
-    }
-    inline void applyS_(const vector<size_t> &indices,
-                        const vector<size_t> &externalIndices, bool inverse,
-                        const vector<fp_t> &params) {
-        static_cast<void>(params);
-        applyS(indices, externalIndices, inverse);
+
+    /**
+     * @brief Apply a given matrix directly to the statevector.
+     *
+     * @param matrix Perfect square matrix in row-major order.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyMatrix(const vector<CFP_t> &matrix, const vector<size_t> &wires,
+                     bool inverse) {
+        applyMatrix(matrix.data(), wires, inverse);
     }
-    inline void applyT_(const vector<size_t> &indices,
-                        const vector<size_t> &externalIndices, bool inverse,
-                        const vector<fp_t> &params) {
-        static_cast<void>(params);
-        applyT(indices, externalIndices, inverse);
+
+    /**
+     * @brief Apply a given matrix directly to the statevector read directly
+     * from numpy data. Data can be in 1D or 2D format.
+     *
+     * @param matrix Pointer to a perfect square matrix in row-major order of
+     * dimension `2^wires.size()`.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyMatrix(const CFP_t *matrix, const vector<size_t> &wires,
+                     bool inverse) {
+        PL_INSTRUMENT_SCOPE("applyMatrix", 2 * length_ * sizeof(CFP_t));
+        const size_t dim = Util::exp2(wires.size());
+        if (isDiagonalMatrix_(matrix, dim)) {
+            vector<CFP_t> diag(dim);
+            for (size_t i = 0; i < dim; i++) {
+                diag[i] = matrix[i * dim + i];
+            }
+            applyDiagonal(diag.data(), wires, inverse);
+            return;
+        }
+        if (wires.size() >= DENSE_MATRIX_MIN_WIRES) {
+            applyDenseMatrix_(matrix, wires, inverse);
+            return;
+        }
+
+        const vector<size_t> indices = generateBitPatterns(wires);
+        const vector<size_t> parity = getParityMasks_(wires);
+        const size_t num_indices = indices.size();
+        const size_t num_iter = length_ >> wires.size();
+        [[maybe_unused]] const bool parallel = useParallel_();
+
+        // Take the adjoint once rather than in the inner loop
+        vector<CFP_t> op_matrix(matrix, matrix + num_indices * num_indices);
+        if (inverse) {
+            for (size_t i = 0; i < num_indices; i++) {
+                for (size_t j = 0; j < num_indices; j++) {
+                    op_matrix[i * num_indices + j] =
+                        std::conj(matrix[j * num_indices + i]);
+                }
+            }
+        }
+        const CFP_t *mat = op_matrix.data();
+
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(num_threads_) if (parallel) default(none)     \
+    shared(mat, indices, parity, num_indices, num_iter)
+#endif
+        {
+            // Each thread gathers into its own scratch buffer
+            vector<CFP_t> v(num_indices);
+#if defined(_OPENMP)
+#pragma omp for
+#endif
+            for (size_t k = 0; k < num_iter; k++) {
+                CFP_t *shiftedState = arr_ + insertZeroBits_(k, parity);
+                // Gather
+                for (size_t pos = 0; pos < num_indices; pos++) {
+                    v[pos] = shiftedState[indices[pos]];
+                }
+
+                // Apply + scatter
+                for (size_t i = 0; i < num_indices; i++) {
+                    const size_t baseIndex = i * num_indices;
+                    CFP_t result{0, 0};
+                    for (size_t j = 0; j < num_indices; j++) {
+                        result += mat[baseIndex + j] * v[j];
+                    }
+                    shiftedState[indices[i]] = result;
+                }
+            }
+        }
     }
-    inline void applyRX_(const vector<size_t> &indices,
-                         const vector<size_t> &externalIndices, bool inverse,
-                         const vector<fp_t> &params) {
-        applyRX(indices, externalIndices, inverse, params[0]);
+
+    /**
+     * @brief Apply a matrix to the statevector and, in the same pass over the
+     * data, compute the overlaps \f$\langle \psi | G_g | \phi \rangle\f$ of
+     * the statevector \f$\psi\f$ before the update with another state
+     * \f$\phi\f$, for matrices \f$G_g\f$ acting on the same wires.
+     *
+     * The adjoint method uses it to undo a gate from an observable-applied
+     * state while computing the Jacobian entries of the gate parameters,
+     * reading the state once and without a generator-applied copy of the
+     * forward state.
+     *
+     * @param matrix Matrix to apply, in row-major order of dimension
+     * `2^wires.size()`.
+     * @param wires Wires of the matrices.
+     * @param other State \f$\phi\f$, of the same length.
+     * @param generators Matrices \f$G_g\f$, of the dimension of `matrix`.
+     * @return Overlap for each matrix of `generators`.
+     */
+    auto applyMatrixWithOverlaps(const vector<CFP_t> &matrix,
+                                 const vector<size_t> &wires,
+                                 const StateVector<fp_t> &other,
+                                 const vector<vector<CFP_t>> &generators)
+        -> vector<CFP_t> {
+        PL_INSTRUMENT_SCOPE("applyMatrixWithOverlaps",
+                            3 * length_ * sizeof(CFP_t));
+        using AccT = std::complex<Util::accumulator_t<fp_t>>;
+        const size_t num_indices = Util::exp2(wires.size());
+        PL_ABORT_IF_NOT(matrix.size() == num_indices * num_indices,
+                        "The matrix size does not match the number of wires.");
+        PL_ABORT_IF_NOT(other.getLength() == length_,
+                        "The states must have the same length.");
+        for (const auto &generator : generators) {
+            PL_ABORT_IF_NOT(generator.size() == matrix.size(),
+                            "The generators must have the dimension of the "
+                            "matrix.");
+        }
+
+        const vector<size_t> indices = generateBitPatterns(wires);
+        const vector<size_t> parity = getParityMasks_(wires);
+        const size_t num_iter = length_ >> wires.size();
+        const size_t num_generators = generators.size();
+        const CFP_t *other_arr = other.getData();
+        [[maybe_unused]] const bool parallel = useParallel_();
+        vector<AccT> overlaps(num_generators, AccT{0, 0});
+
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(num_threads_) if (parallel) default(none)     \
+    shared(matrix, generators, indices, parity, num_indices, num_iter,         \
+           num_generators, other_arr, overlaps)
+#endif
+        {
+            // Each thread gathers into its own scratch buffers and
+            // accumulates its own overlaps
+            vector<CFP_t> v(num_indices);
+            vector<CFP_t> w(num_indices);
+            vector<AccT> local(num_generators, AccT{0, 0});
+#if defined(_OPENMP)
+#pragma omp for
+#endif
+            for (size_t k = 0; k < num_iter; k++) {
+                const size_t offset = insertZeroBits_(k, parity);
+                CFP_t *shiftedState = arr_ + offset;
+                const CFP_t *shiftedOther = other_arr + offset;
+                // Gather
+                for (size_t pos = 0; pos < num_indices; pos++) {
+                    v[pos] = shiftedState[indices[pos]];
+                    w[pos] = shiftedOther[indices[pos]];
+                }
+
+                // Overlaps of the original amplitudes
+                for (size_t g = 0; g < num_generators; g++) {
+                    const CFP_t *gen = generators[g].data();
+                    for (size_t i = 0; i < num_indices; i++) {
+                        CFP_t gw{0, 0};
+                        for (size_t j = 0; j < num_indices; j++) {
+                            gw += gen[i * num_indices + j] * w[j];
+                        }
+                        local[g] += AccT{std::conj(v[i]) * gw};
+                    }
+                }
+
+                // Apply + scatter
+                for (size_t i = 0; i < num_indices; i++) {
+                    const size_t baseIndex = i * num_indices;
+                    CFP_t result{0, 0};
+                    for (size_t j = 0; j < num_indices; j++) {
+                        result += matrix[baseIndex + j] * v[j];
+                    }
+                    shiftedState[indices[i]] = result;
+                }
+            }
+#if defined(_OPENMP)
+#pragma omp critical
+#endif
+            for (size_t g = 0; g < num_generators; g++) {
+                overlaps[g] += local[g];
+            }
+        }
+
+        vector<CFP_t> result(num_generators);
+        for (size_t g = 0; g < num_generators; g++) {
+            result[g] = CFP_t{overlaps[g]};
+        }
+        return result;
     }
-    inline void applyRY_(const vector<size_t> &indices,
-                         const vector<size_t> &externalIndices, bool inverse,
-                         const vector<fp_t> &params) {
-        applyRY(indices, externalIndices, inverse, params[0]);
+
+    /**
+     * @brief Multiply the statevector by a diagonal matrix.
+     *
+     * @param diag Diagonal of the matrix.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyDiagonal(const vector<CFP_t> &diag, const vector<size_t> &wires,
+                       bool inverse) {
+        PL_ABORT_IF_NOT(diag.size() == Util::exp2(wires.size()),
+                        "The diagonal size does not match the number of "
+                        "wires.");
+        applyDiagonal(diag.data(), wires, inverse);
     }
-    inline void applyRZ_(const vector<size_t> &indices,
-                         const vector<size_t> &externalIndices, bool inverse,
+
+    /**
+     * @brief Multiply the statevector by a diagonal matrix.
+     *
+     * Every amplitude is multiplied by the diagonal entry selected by its bits
+     * on the given wires, in a single pass over the statevector. The
+     * statevector is swept in blocks of `2^DIAGONAL_BLOCK_BITS` contiguous
+     * amplitudes, so that the contribution of the low bits to the diagonal
+     * index is read from a table and that of the high bits is computed once
+     * per block.
+     *
+     * @param diag Pointer to the `2^wires.size()` diagonal entries, ordered
+     * with `wires[0]` as the most significant bit.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyDiagonal(const CFP_t *diag, const vector<size_t> &wires,
+                       bool inverse) {
+        const size_t num_wires = wires.size();
+        vector<CFP_t> phases(diag, diag + Util::exp2(num_wires));
+        if (inverse) {
+            for (auto &phase : phases) {
+                phase = std::conj(phase);
+            }
+        }
+
+        const size_t block_bits = std::min(num_qubits_, DIAGONAL_BLOCK_BITS);
+        const size_t block_size = Util::exp2(block_bits);
+        // Diagonal index contributed by the offset within a block
+        vector<size_t> low_index(block_size, 0);
+        // Statevector bit and diagonal index bit of the wires above the block
+        vector<std::pair<size_t, size_t>> high_bits;
+        for (size_t w = 0; w < num_wires; w++) {
+            const size_t rev_wire = num_qubits_ - wires[w] - 1;
+            const size_t diag_bit = static_cast<size_t>(1U)
+                                    << (num_wires - w - 1);
+            if (rev_wire < block_bits) {
+                for (size_t j = 0; j < block_size; j++) {
+                    if ((j >> rev_wire) & 1U) {
+                        low_index[j] |= diag_bit;
+                    }
+                }
+            } else {
+                high_bits.emplace_back(static_cast<size_t>(1U) << rev_wire,
+                                       diag_bit);
+            }
+        }
+
+        const CFP_t *phase_data = phases.data();
+        const size_t num_blocks = length_ >> block_bits;
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(phase_data, low_index, high_bits, block_bits, block_size,           \
+           num_blocks)
+#endif
+        for (size_t b = 0; b < num_blocks; b++) {
+            const size_t base = b << block_bits;
+            size_t high_index = 0;
+            for (const auto &[state_bit, diag_bit] : high_bits) {
+                if ((base & state_bit) != 0) {
+                    high_index |= diag_bit;
+                }
+            }
+            const CFP_t *block_phases = phase_data + high_index;
+            CFP_t *block = arr_ + base;
+            for (size_t j = 0; j < block_size; j++) {
+                // Written out to avoid the NaN checks of complex operator*
+                const CFP_t v = block[j];
+                const CFP_t p = block_phases[low_index[j]];
+                block[j] = {v.real() * p.real() - v.imag() * p.imag(),
+                            v.real() * p.imag() + v.imag() * p.real()};
+            }
+        }
+    }
+
+    /**
+     * @brief Apply PauliX gate operation to the given wire.
+     *
+     * @param wires Wire to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     */
+    void applyPauliX(const vector<size_t> &wires,
+                     [[maybe_unused]] bool inverse) {
+        if (applyMatrix1QSIMD_(wires[0], {0, 1, 1, 0})) {
+            return;
+        }
+        applyKernel1Q(wires[0], [&](size_t i0, size_t i1) {
+            std::swap(arr_[i0], arr_[i1]);
+        });
+    }
+
+    /**
+     * @brief Apply PauliY gate operation to the given wire.
+     *
+     * @param wires Wire to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     */
+    void applyPauliY(const vector<size_t> &wires,
+                     [[maybe_unused]] bool inverse) {
+        if (applyMatrix1QSIMD_(wires[0], {0, -Util::IMAG<fp_t>(),
+                                          Util::IMAG<fp_t>(), 0})) {
+            return;
+        }
+        applyKernel1Q(wires[0], [&](size_t i0, size_t i1) {
+            const CFP_t v0 = arr_[i0];
+            arr_[i0] = CFP_t{arr_[i1].imag(), -arr_[i1].real()};
+            arr_[i1] = CFP_t{-v0.imag(), v0.real()};
+        });
+    }
+
+    /**
+     * @brief Apply PauliZ gate operation to the given wire.
+     *
+     * @param wires Wire to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     */
+    void applyPauliZ(const vector<size_t> &wires,
+                     [[maybe_unused]] bool inverse) {
+        if (applyDiagonal1QSIMD_(wires[0], {1, -1})) {
+            return;
+        }
+        applyKernel1Q(wires[0], [&]([[maybe_unused]] size_t i0, size_t i1) {
+            arr_[i1] = -arr_[i1];
+        });
+    }
+
+    /**
+     * @brief Apply Hadamard gate operation to the given wire.
+     *
+     * @param wires Wire to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     */
+    void applyHadamard(const vector<size_t> &wires,
+                       [[maybe_unused]] bool inverse) {
+        const fp_t h = Util::INVSQRT2<fp_t>();
+        if (applyMatrix1QSIMD_(wires[0], {h, h, h, -h})) {
+            return;
+        }
+        applyKernel1Q(wires[0], [&](size_t i0, size_t i1) {
+            const CFP_t v0 = arr_[i0];
+            const CFP_t v1 = arr_[i1];
+            arr_[i0] = Util::INVSQRT2<fp_t>() * (v0 + v1);
+            arr_[i1] = Util::INVSQRT2<fp_t>() * (v0 - v1);
+        });
+    }
+
+    /**
+     * @brief Apply S gate operation to the given wire.
+     *
+     * @param wires Wire to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     */
+    void applyS(const vector<size_t> &wires, bool inverse) {
+        const CFP_t shift =
+            (inverse) ? -Util::IMAG<fp_t>() : Util::IMAG<fp_t>();
+        if (applyDiagonal1QSIMD_(wires[0], {1, shift})) {
+            return;
+        }
+        applyKernel1Q(wires[0], [&]([[maybe_unused]] size_t i0, size_t i1) {
+            arr_[i1] *= shift;
+        });
+    }
+
+    /**
+     * @brief Apply T gate operation to the given wire.
+     *
+     * @param wires Wire to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     */
+    void applyT(const vector<size_t> &wires, bool inverse) {
+        const CFP_t shift =
+            (inverse)
+                ? std::conj(std::exp(CFP_t(0, static_cast<fp_t>(M_PI / 4))))
+                : std::exp(CFP_t(0, static_cast<fp_t>(M_PI / 4)));
+        if (applyDiagonal1QSIMD_(wires[0], {1, shift})) {
+            return;
+        }
+        applyKernel1Q(wires[0], [&]([[maybe_unused]] size_t i0, size_t i1) {
+            arr_[i1] *= shift;
+        });
+    }
+
+    /**
+     * @brief Apply RX gate operation to the given wire.
+     *
+     * @tparam Param_t Precision type for gate parameter. Accepted type are
+     * `float` and `double`.
+     * @param wires Wire to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     * @param angle Rotation angle of gate.
+     */
+    template <typename Param_t = fp_t>
+    void applyRX(const vector<size_t> &wires, bool inverse, Param_t angle) {
+        const Param_t c = std::cos(angle / 2);
+        const Param_t js =
+            (inverse) ? -std::sin(-angle / 2) : std::sin(-angle / 2);
+        if (applyMatrix1QSIMD_(wires[0], {c, CFP_t(0, js), CFP_t(0, js), c})) {
+            return;
+        }
+        applyKernel1Q(wires[0], [&](size_t i0, size_t i1) {
+            const CFP_t v0 = arr_[i0];
+            const CFP_t v1 = arr_[i1];
+            arr_[i0] = c * v0 + js * CFP_t{-v1.imag(), v1.real()};
+            arr_[i1] = js * CFP_t{-v0.imag(), v0.real()} + c * v1;
+        });
+    }
+
+    /**
+     * @brief Apply RY gate operation to the given wire.
+     *
+     * @tparam Param_t Precision type for gate parameter. Accepted type are
+     * `float` and `double`.
+     * @param wires Wire to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     * @param angle Rotation angle of gate.
+     */
+    template <typename Param_t = fp_t>
+    void applyRY(const vector<size_t> &wires, bool inverse, Param_t angle) {
+        const Param_t c = std::cos(angle / 2);
+        const Param_t s =
+            (inverse) ? -std::sin(angle / 2) : std::sin(angle / 2);
+        if (applyMatrix1QSIMD_(wires[0], {c, -s, s, c})) {
+            return;
+        }
+        applyKernel1Q(wires[0], [&](size_t i0, size_t i1) {
+            const CFP_t v0 = arr_[i0];
+            const CFP_t v1 = arr_[i1];
+            arr_[i0] = c * v0 - s * v1;
+            arr_[i1] = s * v0 + c * v1;
+        });
+    }
+
+    /**
+     * @brief Apply RZ gate operation to the given wire.
+     *
+     * @tparam Param_t Precision type for gate parameter. Accepted type are
+     * `float` and `double`.
+     * @param wires Wire to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     * @param angle Rotation angle of gate.
+     */
+    template <typename Param_t = fp_t>
+    void applyRZ(const vector<size_t> &wires, bool inverse, Param_t angle) {
+        const CFP_t first = CFP_t(std::cos(angle / 2), -std::sin(angle / 2));
+        const CFP_t second = CFP_t(std::cos(angle / 2), std::sin(angle / 2));
+        const CFP_t shift1 = (inverse) ? std::conj(first) : first;
+        const CFP_t shift2 = (inverse) ? std::conj(second) : second;
+        if (applyDiagonal1QSIMD_(wires[0], {shift1, shift2})) {
+            return;
+        }
+        applyKernel1Q(wires[0], [&](size_t i0, size_t i1) {
+            arr_[i0] *= shift1;
+            arr_[i1] *= shift2;
+        });
+    }
+
+    /**
+     * @brief Apply phase shift gate operation to the given wire.
+     *
+     * @tparam Param_t Precision type for gate parameter. Accepted type are
+     * `float` and `double`.
+     * @param wires Wire to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     * @param angle Phase shift angle.
+     */
+    template <typename Param_t = fp_t>
+    void applyPhaseShift(const vector<size_t> &wires, bool inverse,
+                         Param_t angle) {
+        const CFP_t s = inverse ? std::conj(std::exp(CFP_t(0, angle)))
+                                : std::exp(CFP_t(0, angle));
+        if (applyDiagonal1QSIMD_(wires[0], {1, s})) {
+            return;
+        }
+        applyKernel1Q(wires[0], [&]([[maybe_unused]] size_t i0, size_t i1) {
+            arr_[i1] *= s;
+        });
+    }
+
+    /**
+     * @brief Apply controlled phase shift gate operation to the given wires.
+     *
+     * @tparam Param_t Precision type for gate parameter. Accepted type are
+     * `float` and `double`.
+     * @param wires Wires to apply the gate to. First index for control wire,
+     * second index for target wire.
+     * @param inverse Take adjoint of given operation.
+     * @param angle Phase shift angle.
+     */
+    template <typename Param_t = fp_t>
+    void applyControlledPhaseShift(const vector<size_t> &wires, bool inverse,
+                                   Param_t angle) {
+        const CFP_t s = inverse ? std::conj(std::exp(CFP_t(0, angle)))
+                                : std::exp(CFP_t(0, angle));
+        applyKernel2Q(wires, [&]([[maybe_unused]] size_t i00,
+                                 [[maybe_unused]] size_t i01,
+                                 [[maybe_unused]] size_t i10,
+                                 size_t i11) { arr_[i11] *= s; });
+    }
+
+    /**
+     * @brief Apply Rot gate \f$RZ(\omega)RY(\theta)RZ(\phi)\f$ to the given
+     * wire.
+     *
+     * @tparam Param_t Precision type for gate parameter. Accepted type are
+     * `float` and `double`.
+     * @param wires Wire to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     * @param phi Gate rotation parameter \f$\phi\f$.
+     * @param theta Gate rotation parameter \f$\theta\f$.
+     * @param omega Gate rotation parameter \f$\omega\f$.
+     */
+    template <typename Param_t = fp_t>
+    void applyRot(const vector<size_t> &wires, bool inverse, Param_t phi,
+                  Param_t theta, Param_t omega) {
+        const vector<CFP_t> rot = Gates::getRot<fp_t>(phi, theta, omega);
+
+        const CFP_t t1 = (inverse) ? std::conj(rot[0]) : rot[0];
+        const CFP_t t2 = (inverse) ? -rot[1] : rot[1];
+        const CFP_t t3 = (inverse) ? -rot[2] : rot[2];
+        const CFP_t t4 = (inverse) ? std::conj(rot[3]) : rot[3];
+
+        if (applyMatrix1QSIMD_(wires[0], {t1, t2, t3, t4})) {
+            return;
+        }
+        applyKernel1Q(wires[0], [&](size_t i0, size_t i1) {
+            const CFP_t v0 = arr_[i0];
+            const CFP_t v1 = arr_[i1];
+            arr_[i0] = t1 * v0 + t2 * v1;
+            arr_[i1] = t3 * v0 + t4 * v1;
+        });
+    }
+
+    /**
+     * @brief Apply CNOT (CX) gate to the given wires.
+     *
+     * @param wires Wires to apply the gate to. First index for control wire,
+     * second index for target wire.
+     * @param inverse Take adjoint of given operation.
+     */
+    void applyCNOT(const vector<size_t> &wires, [[maybe_unused]] bool inverse) {
+        applyKernel2Q(wires, [&]([[maybe_unused]] size_t i00,
+                                 [[maybe_unused]] size_t i01, size_t i10,
+                                 size_t i11) {
+            std::swap(arr_[i10], arr_[i11]);
+        });
+    }
+
+    /**
+     * @brief Apply SWAP gate to the given wires.
+     *
+     * @param wires Wires to apply the gate to.
+     * @param inverse Take adjoint of given operation.
+     */
+    void applySWAP(const vector<size_t> &wires, [[maybe_unused]] bool inverse) {
+        applyKernel2Q(wires, [&]([[maybe_unused]] size_t i00, size_t i01,
+                                 size_t i10, [[maybe_unused]] size_t i11) {
+            std::swap(arr_[i01], arr_[i10]);
+        });
+    }
+
+    /**
+     * @brief Apply CZ gate to the given wires.
+     *
+     * @param wires Wires to apply the gate to. First index for control wire,
+     * second index for target wire.
+     * @param inverse Take adjoint of given operation.
+     */
+    void applyCZ(const vector<size_t> &wires, [[maybe_unused]] bool inverse) {
+        applyKernel2Q(wires, [&]([[maybe_unused]] size_t i00,
+                                 [[maybe_unused]] size_t i01,
+                                 [[maybe_unused]] size_t i10,
+                                 size_t i11) { arr_[i11] *= -1; });
+    }
+
+    /**
+     * @brief Apply CRX gate to the given wires.
+     *
+     * @tparam Param_t Precision type for gate parameter. Accepted type are
+     * `float` and `double`.
+     * @param wires Wires to apply the gate to. First index for control wire,
+     * second index for target wire.
+     * @param inverse Take adjoint of given operation.
+     * @param angle Rotation angle of gate.
+     */
+    template <typename Param_t = fp_t>
+    void applyCRX(const vector<size_t> &wires, bool inverse, Param_t angle) {
+        const Param_t c = std::cos(angle / 2);
+        const Param_t js =
+            (inverse) ? -std::sin(-angle / 2) : std::sin(-angle / 2);
+        applyKernel2Q(wires, [&]([[maybe_unused]] size_t i00,
+                                 [[maybe_unused]] size_t i01, size_t i10,
+                                 size_t i11) {
+            const CFP_t v0 = arr_[i10];
+            const CFP_t v1 = arr_[i11];
+            arr_[i10] = c * v0 + js * CFP_t{-v1.imag(), v1.real()};
+            arr_[i11] = js * CFP_t{-v0.imag(), v0.real()} + c * v1;
+        });
+    }
+
+    /**
+     * @brief Apply CRY gate to the given wires.
+     *
+     * @tparam Param_t Precision type for gate parameter. Accepted type are
+     * `float` and `double`.
+     * @param wires Wires to apply the gate to. First index for control wire,
+     * second index for target wire.
+     * @param inverse Take adjoint of given operation.
+     * @param angle Rotation angle of gate.
+     */
+    template <typename Param_t = fp_t>
+    void applyCRY(const vector<size_t> &wires, bool inverse, Param_t angle) {
+        const Param_t c = std::cos(angle / 2);
+        const Param_t s =
+            (inverse) ? -std::sin(angle / 2) : std::sin(angle / 2);
+        applyKernel2Q(wires, [&]([[maybe_unused]] size_t i00,
+                                 [[maybe_unused]] size_t i01, size_t i10,
+                                 size_t i11) {
+            const CFP_t v0 = arr_[i10];
+            const CFP_t v1 = arr_[i11];
+            arr_[i10] = c * v0 - s * v1;
+            arr_[i11] = s * v0 + c * v1;
+        });
+    }
+
+    /**
+     * @brief Apply CRZ gate to the given wires.
+     *
+     * @tparam Param_t Precision type for gate parameter. Accepted type are
+     * `float` and `double`.
+     * @param wires Wires to apply the gate to. First index for control wire,
+     * second index for target wire.
+     * @param inverse Take adjoint of given operation.
+     * @param angle Rotation angle of gate.
+     */
+    template <typename Param_t = fp_t>
+    void applyCRZ(const vector<size_t> &wires, bool inverse, Param_t angle) {
+        const CFP_t m00 =
+            (inverse) ? CFP_t(std::cos(angle / 2), std::sin(angle / 2))
+                      : CFP_t(std::cos(angle / 2), -std::sin(angle / 2));
+        const CFP_t m11 = (inverse)
+                              ? CFP_t(std::cos(angle / 2), -std::sin(angle / 2))
+                              : CFP_t(std::cos(angle / 2), std::sin(angle / 2));
+        applyKernel2Q(wires, [&]([[maybe_unused]] size_t i00,
+                                 [[maybe_unused]] size_t i01, size_t i10,
+                                 size_t i11) {
+            arr_[i10] *= m00;
+            arr_[i11] *= m11;
+        });
+    }
+
+    /**
+     * @brief Apply CRot gate (controlled \f$RZ(\omega)RY(\theta)RZ(\phi)\f$) to
+     * the given wires.
+     *
+     * @tparam Param_t Precision type for gate parameter. Accepted type are
+     * `float` and `double`.
+     * @param wires Wires to apply the gate to. First index for control wire,
+     * second index for target wire.
+     * @param inverse Take adjoint of given operation.
+     * @param phi Gate rotation parameter \f$\phi\f$.
+     * @param theta Gate rotation parameter \f$\theta\f$.
+     * @param omega Gate rotation parameter \f$\omega\f$.
+     */
+    template <typename Param_t = fp_t>
+    void applyCRot(const vector<size_t> &wires, bool inverse, Param_t phi,
+                   Param_t theta, Param_t omega) {
+        const auto rot = Gates::getRot<fp_t>(phi, theta, omega);
+
+        const CFP_t t1 = (inverse) ? std::conj(rot[0]) : rot[0];
+        const CFP_t t2 = (inverse) ? -rot[1] : rot[1];
+        const CFP_t t3 = (inverse) ? -rot[2] : rot[2];
+        const CFP_t t4 = (inverse) ? std::conj(rot[3]) : rot[3];
+
+        applyKernel2Q(wires, [&]([[maybe_unused]] size_t i00,
+                                 [[maybe_unused]] size_t i01, size_t i10,
+                                 size_t i11) {
+            const CFP_t v0 = arr_[i10];
+            const CFP_t v1 = arr_[i11];
+            arr_[i10] = t1 * v0 + t2 * v1;
+            arr_[i11] = t3 * v0 + t4 * v1;
+        });
+    }
+
+    /**
+     * @brief Apply Toffoli (CCX) gate to the given wires.
+     *
+     * @param wires Wires to apply the gate to. First and second indices for
+     * control wires, third index for target wire.
+     * @param inverse Take adjoint of given operation.
+     */
+    void applyToffoli(const vector<size_t> &wires,
+                      [[maybe_unused]] bool inverse) {
+        applyControlledKernel1Q({wires[0], wires[1]}, wires[2],
+                                [&](size_t i0, size_t i1) {
+                                    std::swap(arr_[i0], arr_[i1]);
+                                });
+    }
+
+    /**
+     * @brief Apply CSWAP gate to the given wires.
+     *
+     * @param wires Wires to apply the gate to. First index for control wire,
+     * second and third indices for target wires.
+     * @param inverse Take adjoint of given operation.
+     */
+    void applyCSWAP(const vector<size_t> &wires,
+                    [[maybe_unused]] bool inverse) {
+        applyControlledKernel2Q({wires[0]}, {wires[1], wires[2]},
+                                [&]([[maybe_unused]] size_t i00, size_t i01,
+                                    size_t i10, [[maybe_unused]] size_t i11) {
+                                    std::swap(arr_[i01], arr_[i10]);
+                                });
+    }
+
+    /**
+     * @brief Call the given kernel for every pair of amplitudes differing
+     * only in the bit of the given wire.
+     *
+     * This is the loop used by the index-free single-qubit kernels, and can be
+     * used to write custom kernels (e.g. gate generators) without building
+     * index vectors.
+     *
+     * @tparam Kernel Callable with signature `void(size_t i0, size_t i1)`,
+     * where `i0` and `i1` are the statevector indices with the wire bit unset
+     * and set respectively.
+     * @param wire Target wire.
+     * @param kernel Kernel to apply to each amplitude pair.
+     */
+    template <class Kernel> void applyKernel1Q(size_t wire, Kernel &&kernel) {
+        const size_t rev_wire = num_qubits_ - wire - 1;
+        const size_t rev_wire_shift = static_cast<size_t>(1U) << rev_wire;
+        const size_t parity_low = Util::fillTrailingOnes(rev_wire);
+        const size_t parity_high = Util::fillLeadingOnes(rev_wire + 1);
+        const size_t num_iter = length_ >> 1U;
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(kernel, rev_wire_shift, parity_low, parity_high, num_iter)
+#endif
+        for (size_t k = 0; k < num_iter; k++) {
+            const size_t i0 = ((k << 1U) & parity_high) | (k & parity_low);
+            kernel(i0, i0 | rev_wire_shift);
+        }
+    }
+
+    /**
+     * @brief Call the given kernel for every group of four amplitudes
+     * differing only in the bits of the two given wires.
+     *
+     * @tparam Kernel Callable with signature
+     * `void(size_t i00, size_t i01, size_t i10, size_t i11)`, where the first
+     * and second bit of each name give the value of `wires[0]` and `wires[1]`
+     * respectively.
+     * @param wires Two target wires.
+     * @param kernel Kernel to apply to each amplitude group.
+     */
+    template <class Kernel>
+    void applyKernel2Q(const vector<size_t> &wires, Kernel &&kernel) {
+        const size_t rev_wire0 = num_qubits_ - wires[0] - 1;
+        const size_t rev_wire1 = num_qubits_ - wires[1] - 1;
+        const size_t rev_wire0_shift = static_cast<size_t>(1U) << rev_wire0;
+        const size_t rev_wire1_shift = static_cast<size_t>(1U) << rev_wire1;
+        const size_t rev_wire_min = std::min(rev_wire0, rev_wire1);
+        const size_t rev_wire_max = std::max(rev_wire0, rev_wire1);
+        const size_t parity_low = Util::fillTrailingOnes(rev_wire_min);
+        const size_t parity_high = Util::fillLeadingOnes(rev_wire_max + 1);
+        const size_t parity_middle = Util::fillLeadingOnes(rev_wire_min + 1) &
+                                     Util::fillTrailingOnes(rev_wire_max);
+        const size_t num_iter = length_ >> 2U;
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(kernel, rev_wire0_shift, rev_wire1_shift, parity_low, parity_high,  \
+           parity_middle, num_iter)
+#endif
+        for (size_t k = 0; k < num_iter; k++) {
+            const size_t i00 = ((k << 2U) & parity_high) |
+                               ((k << 1U) & parity_middle) | (k & parity_low);
+            const size_t i10 = i00 | rev_wire0_shift;
+            const size_t i01 = i00 | rev_wire1_shift;
+            kernel(i00, i01, i10, i10 | rev_wire1_shift);
+        }
+    }
+
+    /**
+     * @brief Call the given kernel for every statevector offset with all bits
+     * of the given wires unset.
+     *
+     * @tparam Kernel Callable with signature `void(size_t offset)`. The
+     * participating amplitudes are found by adding the values from
+     * `generateBitPatterns(wires)` to the offset.
+     * @param wires Target wires.
+     * @param kernel Kernel to apply at every offset.
+     */
+    template <class Kernel>
+    void applyKernelNQ(const vector<size_t> &wires, Kernel &&kernel) {
+        const vector<size_t> parity = getParityMasks_(wires);
+        const size_t num_iter = length_ >> wires.size();
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(kernel, parity, num_iter)
+#endif
+        for (size_t k = 0; k < num_iter; k++) {
+            kernel(insertZeroBits_(k, parity));
+        }
+    }
+
+    /**
+     * @brief Call the given kernel for every pair of amplitudes differing
+     * only in the bit of the target wire, among those with all control bits
+     * set. Only the `length >> (controls.size() + 1)` affected pairs are
+     * visited.
+     *
+     * @tparam Kernel Callable with signature `void(size_t i0, size_t i1)`,
+     * where `i0` and `i1` are the statevector indices with the target bit
+     * unset and set respectively.
+     * @param controls Control wires.
+     * @param target Target wire.
+     * @param kernel Kernel to apply to each amplitude pair.
+     */
+    template <class Kernel>
+    void applyControlledKernel1Q(const vector<size_t> &controls,
+                                 size_t target, Kernel &&kernel) {
+        if (controls.empty()) {
+            applyKernel1Q(target, std::forward<Kernel>(kernel));
+            return;
+        }
+        if (controls.size() == 1) {
+            applyKernel2Q({controls[0], target},
+                          [&]([[maybe_unused]] size_t i00,
+                              [[maybe_unused]] size_t i01, size_t i10,
+                              size_t i11) { kernel(i10, i11); });
+            return;
+        }
+        vector<size_t> wires(controls);
+        wires.push_back(target);
+        const vector<size_t> parity = getParityMasks_(wires);
+        const size_t control_mask = getWiresMask_(controls);
+        const size_t target_shift = static_cast<size_t>(1U)
+                                    << (num_qubits_ - target - 1);
+        const size_t num_iter = length_ >> wires.size();
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(kernel, parity, control_mask, target_shift, num_iter)
+#endif
+        for (size_t k = 0; k < num_iter; k++) {
+            const size_t i0 = insertZeroBits_(k, parity) | control_mask;
+            kernel(i0, i0 | target_shift);
+        }
+    }
+
+    /**
+     * @brief Call the given kernel for every group of four amplitudes
+     * differing only in the bits of the two target wires, among those with
+     * all control bits set. Only the `length >> (controls.size() + 2)`
+     * affected groups are visited.
+     *
+     * @tparam Kernel Callable with signature
+     * `void(size_t i00, size_t i01, size_t i10, size_t i11)`, where the first
+     * and second bit of each name give the value of `targets[0]` and
+     * `targets[1]` respectively.
+     * @param controls Control wires.
+     * @param targets Two target wires.
+     * @param kernel Kernel to apply to each amplitude group.
+     */
+    template <class Kernel>
+    void applyControlledKernel2Q(const vector<size_t> &controls,
+                                 const vector<size_t> &targets,
+                                 Kernel &&kernel) {
+        if (controls.empty()) {
+            applyKernel2Q(targets, std::forward<Kernel>(kernel));
+            return;
+        }
+        vector<size_t> wires(controls);
+        wires.insert(wires.end(), targets.begin(), targets.end());
+        const vector<size_t> parity = getParityMasks_(wires);
+        const size_t control_mask = getWiresMask_(controls);
+        const size_t target0_shift = static_cast<size_t>(1U)
+                                     << (num_qubits_ - targets[0] - 1);
+        const size_t target1_shift = static_cast<size_t>(1U)
+                                     << (num_qubits_ - targets[1] - 1);
+        const size_t num_iter = length_ >> wires.size();
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(kernel, parity, control_mask, target0_shift, target1_shift,         \
+           num_iter)
+#endif
+        for (size_t k = 0; k < num_iter; k++) {
+            const size_t i00 = insertZeroBits_(k, parity) | control_mask;
+            const size_t i10 = i00 | target0_shift;
+            const size_t i01 = i00 | target1_shift;
+            kernel(i00, i01, i10, i10 | target1_shift);
+        }
+    }
+
+    /**
+     * @brief Apply a one- or two-qubit matrix to the target wires, controlled
+     * by any number of wires, without building the matrix of the controlled
+     * operation. Only the amplitudes with all control bits set are read and
+     * written.
+     *
+     * @param matrix Matrix of the target operation in row-major order, of
+     * dimension `2^targets.size()`.
+     * @param controls Control wires.
+     * @param targets One or two target wires.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyControlledMatrix(const CFP_t *matrix,
+                               const vector<size_t> &controls,
+                               const vector<size_t> &targets, bool inverse) {
+        PL_ABORT_IF_NOT(targets.size() == 1 || targets.size() == 2,
+                        "Controlled matrices act on one or two target wires.");
+        vector<size_t> wires(controls);
+        wires.insert(wires.end(), targets.begin(), targets.end());
+        PL_ABORT_IF_NOT(Util::popcount(getWiresMask_(wires)) == wires.size(),
+                        "The control and target wires must be distinct.");
+        PL_INSTRUMENT_SCOPE("applyControlledMatrix",
+                            2 * (length_ >> controls.size()) * sizeof(CFP_t));
+
+        const size_t dim = Util::exp2(targets.size());
+        std::array<CFP_t, 16> mat{};
+        for (size_t i = 0; i < dim; i++) {
+            for (size_t j = 0; j < dim; j++) {
+                mat[i * dim + j] = inverse ? std::conj(matrix[j * dim + i])
+                                           : matrix[i * dim + j];
+            }
+        }
+
+        if (targets.size() == 1) {
+            applyControlledKernel1Q(
+                controls, targets[0], [&](size_t i0, size_t i1) {
+                    const CFP_t v0 = arr_[i0];
+                    const CFP_t v1 = arr_[i1];
+                    arr_[i0] = mat[0] * v0 + mat[1] * v1;
+                    arr_[i1] = mat[2] * v0 + mat[3] * v1;
+                });
+            return;
+        }
+        applyControlledKernel2Q(
+            controls, targets,
+            [&](size_t i00, size_t i01, size_t i10, size_t i11) {
+                const std::array<size_t, 4> idx{i00, i01, i10, i11};
+                const std::array<CFP_t, 4> v{arr_[i00], arr_[i01], arr_[i10],
+                                             arr_[i11]};
+                for (size_t i = 0; i < 4; i++) {
+                    arr_[idx[i]] = mat[4 * i] * v[0] + mat[4 * i + 1] * v[1] +
+                                   mat[4 * i + 2] * v[2] +
+                                   mat[4 * i + 3] * v[3];
+                }
+            });
+    }
+
+    /**
+     * @see applyControlledMatrix(const CFP_t *matrix, const vector<size_t>
+     * &controls, const vector<size_t> &targets, bool inverse)
+     */
+    void applyControlledMatrix(const vector<CFP_t> &matrix,
+                               const vector<size_t> &controls,
+                               const vector<size_t> &targets, bool inverse) {
+        PL_ABORT_IF_NOT(matrix.size() == Util::exp2(2 * targets.size()),
+                        "The matrix size does not match the number of target "
+                        "wires.");
+        applyControlledMatrix(matrix.data(), controls, targets, inverse);
+    }
+
+    /**
+     * @brief Project onto the subspace with all control bits set, by zeroing
+     * every other amplitude. The amplitudes are zeroed in contiguous runs
+     * below the lowest control bit and the kept amplitudes are not touched.
+     *
+     * @param controls Control wires.
+     */
+    void projectOntoControls(const vector<size_t> &controls) {
+        if (controls.empty()) {
+            return;
+        }
+        const size_t control_mask = getWiresMask_(controls);
+        const size_t run_shift = Util::log2(control_mask & (~control_mask + 1));
+        const size_t run_length = static_cast<size_t>(1U) << run_shift;
+        const size_t num_runs = length_ >> run_shift;
+        CFP_t *arr = arr_;
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(arr, control_mask, run_shift, run_length, num_runs)
+#endif
+        for (size_t r = 0; r < num_runs; r++) {
+            const size_t begin = r << run_shift;
+            if ((begin & control_mask) != control_mask) {
+                std::fill(arr + begin, arr + begin + run_length, CFP_t{0, 0});
+            }
+        }
+    }
+
+    //***********************************************************************//
+    //  State preparation.
+    //***********************************************************************//
+
+    /**
+     * @brief Set the statevector to a computational basis state.
+     *
+     * The amplitudes are zeroed with the same threads and static schedule as
+     * the gate kernels before the single non-zero amplitude is written.
+     *
+     * @param index Index of the basis state.
+     */
+    void setBasisState(size_t index) {
+        PL_ABORT_IF_NOT(index < length_, "Invalid basis state index.");
+        zeroFill_();
+        arr_[index] = {1, 0};
+    }
+
+    /**
+     * @brief Set the statevector to the computational basis state with the
+     * given bits on the given wires, and the other wires in \f$|0\rangle\f$.
+     *
+     * @param state Bit of each wire, 0 or 1.
+     * @param wires Wires to set.
+     */
+    void setBasisState(const vector<size_t> &state,
+                       const vector<size_t> &wires) {
+        PL_ABORT_IF_NOT(state.size() == wires.size(),
+                        "The basis state and wires must be of equal length.");
+        checkStateWires_(wires);
+        size_t index = 0;
+        for (size_t i = 0; i < wires.size(); i++) {
+            PL_ABORT_IF(state[i] > 1,
+                        "The basis state must consist of 0 or 1 values.");
+            index |= state[i] << (num_qubits_ - 1 - wires[i]);
+        }
+        setBasisState(index);
+    }
+
+    /**
+     * @brief Set the statevector to a state of the given wires, with the other
+     * wires in \f$|0\rangle\f$.
+     *
+     * @see setStateVector(const CFP_t *state, const vector<size_t> &wires)
+     *
+     * @param state The `2^wires.size()` amplitudes of the subsystem.
+     * @param wires Wires of the subsystem.
+     */
+    void setStateVector(const vector<CFP_t> &state,
+                        const vector<size_t> &wires) {
+        PL_ABORT_IF_NOT(state.size() == Util::exp2(wires.size()),
+                        "The state vector must have 2^wires.size() "
+                        "amplitudes.");
+        setStateVector(state.data(), wires);
+    }
+
+    /**
+     * @brief Set the statevector to a state of the given wires, with the other
+     * wires in \f$|0\rangle\f$.
+     *
+     * Unless the subsystem covers every wire, the amplitudes are first zeroed.
+     * The subsystem amplitudes are then scattered to their statevector
+     * indices, composed from two small tables over the leading and trailing
+     * wires. Both passes are split across the threads of the gate kernels.
+     *
+     * @param state Pointer to the `2^wires.size()` amplitudes of the
+     * subsystem, ordered with `wires[0]` as the most significant bit.
+     * @param wires Wires of the subsystem.
+     */
+    void setStateVector(const CFP_t *state, const vector<size_t> &wires) {
+        checkStateWires_(wires);
+        if (wires.size() < num_qubits_) {
+            zeroFill_();
+        }
+        const size_t num_low = wires.size() / 2;
+        const vector<size_t> high_patterns = generateBitPatterns(
+            {wires.begin(), wires.end() - num_low}, num_qubits_);
+        const vector<size_t> low_patterns = generateBitPatterns(
+            {wires.end() - num_low, wires.end()}, num_qubits_);
+        const size_t low_mask = Util::fillTrailingOnes(num_low);
+        const size_t num_amplitudes = Util::exp2(wires.size());
+        CFP_t *arr = arr_;
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    schedule(static) shared(arr, state, high_patterns, low_patterns,          \
+                            low_mask, num_low, num_amplitudes)
+#endif
+        for (size_t i = 0; i < num_amplitudes; i++) {
+            arr[high_patterns[i >> num_low] | low_patterns[i & low_mask]] =
+                state[i];
+        }
+    }
+
+    //***********************************************************************//
+    //  Measurements.
+    //***********************************************************************//
+
+    /**
+     * @brief Compute the marginal probabilities of the computational basis
+     * states of the given wires into a preallocated buffer.
+     *
+     * The probabilities are summed directly from the amplitudes, without
+     * forming the probability vector of the full register. The bits of each
+     * outcome index follow the order of `wires`, with `wires[0]` as the most
+     * significant bit.
+     *
+     * @param wires Wires to compute the marginal probabilities of.
+     * @param out Output buffer with `2^wires.size()` elements.
+     */
+    void probs(const vector<size_t> &wires, fp_t *out) const {
+        for (size_t i = 0; i < wires.size(); i++) {
+            PL_ABORT_IF_NOT(wires[i] < num_qubits_,
+                            "Invalid wire for the probabilities.");
+            PL_ABORT_IF(std::find(wires.begin() + i + 1, wires.end(),
+                                  wires[i]) != wires.end(),
+                        "Each wire may only appear once.");
+        }
+        const size_t num_outcomes = Util::exp2(wires.size());
+        const size_t num_iter = length_ >> wires.size();
+        const CFP_t *arr = arr_;
+        [[maybe_unused]] const bool parallel = useParallel_();
+
+        if (num_outcomes >= num_iter) {
+            // Split the outcomes across threads, each summing its own entry.
+            // The outcome bit patterns are composed from two small tables
+            // over the leading and trailing wires.
+            const size_t num_low = wires.size() / 2;
+            const vector<size_t> high_patterns = generateBitPatterns(
+                {wires.begin(), wires.end() - num_low}, num_qubits_);
+            const vector<size_t> low_patterns = generateBitPatterns(
+                {wires.end() - num_low, wires.end()}, num_qubits_);
+            const vector<size_t> offsets = generateBitPatterns(
+                getIndicesAfterExclusion(wires, num_qubits_), num_qubits_);
+            const size_t low_mask = Util::fillTrailingOnes(num_low);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(arr, out, high_patterns, low_patterns, offsets, low_mask,          \
+           num_low, num_outcomes, num_iter)
+#endif
+            for (size_t m = 0; m < num_outcomes; m++) {
+                const size_t pattern =
+                    high_patterns[m >> num_low] | low_patterns[m & low_mask];
+                Util::accumulator_t<fp_t> sum = 0;
+                for (size_t k = 0; k < num_iter; k++) {
+                    sum += std::norm(arr[pattern | offsets[k]]);
+                }
+                out[m] = static_cast<fp_t>(sum);
+            }
+        } else {
+            // Few outcomes: split the amplitudes and reduce a small buffer in
+            // the accumulation precision
+            const vector<size_t> patterns =
+                generateBitPatterns(wires, num_qubits_);
+            const vector<size_t> parity = getParityMasks_(wires);
+            vector<Util::accumulator_t<fp_t>> sums(num_outcomes, 0);
+            Util::accumulator_t<fp_t> *sums_ptr = sums.data();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(arr, patterns, parity, num_outcomes, num_iter)                      \
+        reduction(+ : sums_ptr[:num_outcomes])
+#endif
+            for (size_t k = 0; k < num_iter; k++) {
+                const size_t offset = insertZeroBits_(k, parity);
+                for (size_t m = 0; m < num_outcomes; m++) {
+                    sums_ptr[m] += std::norm(arr[offset | patterns[m]]);
+                }
+            }
+            std::transform(sums.begin(), sums.end(), out, [](auto sum) {
+                return static_cast<fp_t>(sum);
+            });
+        }
+    }
+
+    /**
+     * @brief Compute the marginal probabilities of the computational basis
+     * states of the given wires.
+     *
+     * @see probs(const vector<size_t> &wires, fp_t *out) const
+     *
+     * @param wires Wires to compute the marginal probabilities of.
+     * @return vector<fp_t> Probabilities of the `2^wires.size()` outcomes.
+     */
+    [[nodiscard]] auto probs(const vector<size_t> &wires) const
+        -> vector<fp_t> {
+        vector<fp_t> out(Util::exp2(wires.size()));
+        probs(wires, out.data());
+        return out;
+    }
+
+  private:
+    //***********************************************************************//
+    //  Internal utility functions for kernel loops.
+    //***********************************************************************//
+
+    /**
+     * @brief Indicate whether the kernels should run multithreaded for the
+     * current statevector size and thread count.
+     */
+    [[nodiscard]] inline auto useParallel_() const -> bool {
+        return num_threads_ > 1 && length_ >= parallel_threshold_;
+    }
+
+    /**
+     * @brief Zero every amplitude, with the same threads and static schedule
+     * as the gate kernels.
+     */
+    void zeroFill_() {
+        CFP_t *arr = arr_;
+        const size_t length = length_;
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    schedule(static) shared(arr, length)
+#endif
+        for (size_t i = 0; i < length; i++) {
+            arr[i] = {0, 0};
+        }
+    }
+
+    /**
+     * @brief Call the given kernel on the statevector shifted by every
+     * external index offset. The loop is split across OpenMP threads once the
+     * statevector reaches the parallel threshold.
+     *
+     * @tparam Kernel Callable with signature `void(CFP_t *shiftedState)`.
+     * @param externalIndices Non-participating qubit amplitude index offsets.
+     * @param kernel Kernel to apply at every offset.
+     */
+    template <class Kernel>
+    inline void applyKernel_(const vector<size_t> &externalIndices,
+                             Kernel &&kernel) {
+        const size_t num_externals = externalIndices.size();
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(externalIndices, kernel, num_externals)
+#endif
+        for (size_t k = 0; k < num_externals; k++) {
+            kernel(arr_ + externalIndices[k]);
+        }
+    }
+
+    /**
+     * @brief Apply a single-qubit matrix with the vectorized kernels of the
+     * selected instruction set.
+     *
+     * @param wire Target wire.
+     * @param matrix 2x2 matrix in row-major order.
+     * @return bool Whether the gate was applied. The caller falls back to the
+     * scalar kernel otherwise.
+     */
+    auto applyMatrix1QSIMD_(size_t wire, const std::array<CFP_t, 4> &matrix)
+        -> bool {
+        if (simd_isa_ == SIMD::ISA::None || length_ < SIMD::MIN_LENGTH) {
+            return false;
+        }
+        SIMD::applyMatrix1Q(simd_isa_, arr_, num_qubits_,
+                            num_qubits_ - wire - 1, matrix.data(),
+                            useParallel_() ? num_threads_ : 1);
+        return true;
+    }
+
+    /**
+     * @brief Apply a single-qubit diagonal matrix with the vectorized kernels
+     * of the selected instruction set.
+     *
+     * @param wire Target wire.
+     * @param diag The two diagonal entries of the matrix.
+     * @return bool Whether the gate was applied. The caller falls back to the
+     * scalar kernel otherwise.
+     */
+    auto applyDiagonal1QSIMD_(size_t wire, const std::array<CFP_t, 2> &diag)
+        -> bool {
+        if (simd_isa_ == SIMD::ISA::None || length_ < SIMD::MIN_LENGTH) {
+            return false;
+        }
+        SIMD::applyDiagonal1Q(simd_isa_, arr_, num_qubits_,
+                              num_qubits_ - wire - 1, diag.data(),
+                              useParallel_() ? num_threads_ : 1);
+        return true;
+    }
+
+    /**
+     * @brief Get the masks used by `insertZeroBits_` for the given wires,
+     * ordered from the least significant insertion position upwards.
+     *
+     * @param wires Target wires.
+     * @return vector<size_t>
+     */
+    [[nodiscard]] auto getParityMasks_(const vector<size_t> &wires) const
+        -> vector<size_t> {
+        vector<size_t> parity(wires.size());
+        for (size_t i = 0; i < wires.size(); i++) {
+            parity[i] = Util::fillTrailingOnes(num_qubits_ - wires[i] - 1);
+        }
+        std::sort(parity.begin(), parity.end());
+        return parity;
+    }
+
+    /**
+     * @brief Get the mask of the statevector index bits of the given wires.
+     *
+     * @param wires Wires.
+     * @return size_t
+     */
+    [[nodiscard]] auto getWiresMask_(const vector<size_t> &wires) const
+        -> size_t {
+        size_t mask = 0;
+        for (const size_t wire : wires) {
+            mask |= static_cast<size_t>(1U) << (num_qubits_ - wire - 1);
+        }
+        return mask;
+    }
+
+    /**
+     * @brief Map a loop counter onto a statevector offset by inserting a zero
+     * bit below each of the given masks.
+     *
+     * @param k Loop counter in the range `[0, length_ >> parity.size())`.
+     * @param parity Sorted masks from `getParityMasks_`.
+     * @return size_t
+     */
+    static inline auto insertZeroBits_(size_t k, const vector<size_t> &parity)
+        -> size_t {
+        for (const size_t mask : parity) {
+            k = ((k & ~mask) << 1U) | (k & mask);
+        }
+        return k;
+    }
+
+    /**
+     * @brief Member function applying a gate through the generalised dispatch
+     * signature.
+     */
+    using GateMethod = void (StateVector::*)(const vector<size_t> &, bool,
+                                             const vector<fp_t> &);
+
+    /**
+     * @brief Build the table of gate methods indexed by `GateOperation`.
+     */
+    template <size_t... gate_idx>
+    static constexpr auto makeGateTable_(std::index_sequence<gate_idx...>)
+        -> std::array<GateMethod, sizeof...(gate_idx)> {
+        return {&StateVector::template applyOperation<
+            static_cast<GateOperation>(gate_idx)>...};
+    }
+
+    /**
+     * @brief Check that the number of wires matches the gate.
+     *
+     * @param gate_op Gate.
+     * @param wires Wires to apply gate to.
+     */
+    static void checkGateWires_(GateOperation gate_op,
+                                const vector<size_t> &wires) {
+        const size_t num_wires = Util::getGateNumWires(gate_op);
+        if (num_wires != wires.size()) {
+            throw std::invalid_argument(
+                string("The gate of type ") +
+                string(Util::getGateName(gate_op)) + " requires " +
+                std::to_string(num_wires) + " wires, but " +
+                std::to_string(wires.size()) + " were supplied");
+        }
+    }
+
+    /**
+     * @brief Check that the wires of a state preparation are distinct wires of
+     * the statevector.
+     */
+    void checkStateWires_(const vector<size_t> &wires) const {
+        for (size_t i = 0; i < wires.size(); i++) {
+            PL_ABORT_IF_NOT(wires[i] < num_qubits_,
+                            "Invalid wire for the state preparation.");
+            PL_ABORT_IF(std::find(wires.begin() + i + 1, wires.end(),
+                                  wires[i]) != wires.end(),
+                        "Each wire may only appear once.");
+        }
+    }
+
+    //***********************************************************************//
+    //  Internal utility functions for dense matrices.
+    //***********************************************************************//
+
+    /**
+     * @brief Indicate whether all off-diagonal entries of a square matrix are
+     * zero.
+     *
+     * @param matrix Matrix in row-major order.
+     * @param dim Dimension of the matrix.
+     */
+    static auto isDiagonalMatrix_(const CFP_t *matrix, size_t dim) -> bool {
+        for (size_t i = 0; i < dim; i++) {
+            for (size_t j = 0; j < dim; j++) {
+                if (i != j && matrix[i * dim + j] != CFP_t{0, 0}) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Apply a matrix on many wires as a blocked matrix-matrix product.
+     *
+     * The amplitudes of consecutive offsets are gathered into the rows of a
+     * block \f$V\f$, which is replaced by \f$V A^T\f$, where \f$A\f$ is the
+     * matrix or its adjoint. \f$A^T\f$ is formed once per call, so the adjoint
+     * costs nothing in the inner loops. The product uses CBLAS when enabled,
+     * and otherwise a kernel over the real and imaginary parts of \f$A^T\f$
+     * that the compiler vectorizes. Blocks are distributed over OpenMP
+     * threads.
+     *
+     * @param matrix Perfect square matrix in row-major order.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyDenseMatrix_(const CFP_t *matrix, const vector<size_t> &wires,
+                           bool inverse) {
+        const size_t dim = Util::exp2(wires.size());
+        const vector<size_t> indices = generateBitPatterns(wires);
+        const vector<size_t> parity = getParityMasks_(wires);
+        const size_t num_iter = length_ >> wires.size();
+        const size_t block_rows =
+            std::min(num_iter, std::max<size_t>(
+                                   1, DENSE_MATRIX_BLOCK_ELEMENTS / dim));
+        const size_t num_blocks = (num_iter + block_rows - 1) / block_rows;
+        [[maybe_unused]] const bool parallel = useParallel_();
+
+        // A^T[j][i] is M[i][j], or conj(M[j][i]) for the adjoint
+        vector<CFP_t> mat_t(dim * dim);
+        for (size_t j = 0; j < dim; j++) {
+            for (size_t i = 0; i < dim; i++) {
+                mat_t[j * dim + i] = inverse ? std::conj(matrix[j * dim + i])
+                                             : matrix[i * dim + j];
+            }
+        }
+        vector<fp_t> mat_t_re;
+        vector<fp_t> mat_t_im;
+        if constexpr (!USE_CBLAS) {
+            mat_t_re.resize(dim * dim);
+            mat_t_im.resize(dim * dim);
+            for (size_t idx = 0; idx < dim * dim; idx++) {
+                mat_t_re[idx] = std::real(mat_t[idx]);
+                mat_t_im[idx] = std::imag(mat_t[idx]);
+            }
+        }
+
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(num_threads_) if (parallel) default(none)     \
+    shared(mat_t, mat_t_re, mat_t_im, indices, parity, dim, num_iter,          \
+           block_rows, num_blocks)
+#endif
+        {
+            // Each thread gathers into its own scratch blocks
+            vector<CFP_t> in(block_rows * dim);
+            vector<CFP_t> out(block_rows * dim);
+            vector<fp_t> acc_re(dim);
+            vector<fp_t> acc_im(dim);
+#if defined(_OPENMP)
+#pragma omp for
+#endif
+            for (size_t blk = 0; blk < num_blocks; blk++) {
+                const size_t k_begin = blk * block_rows;
+                const size_t rows = std::min(block_rows, num_iter - k_begin);
+                for (size_t r = 0; r < rows; r++) {
+                    const CFP_t *shiftedState =
+                        arr_ + insertZeroBits_(k_begin + r, parity);
+                    for (size_t j = 0; j < dim; j++) {
+                        in[r * dim + j] = shiftedState[indices[j]];
+                    }
+                }
+
+                if constexpr (USE_CBLAS) {
+                    Util::matrixMatProd(in.data(), mat_t.data(), out.data(),
+                                        rows, dim, dim);
+                } else {
+                    for (size_t r = 0; r < rows; r++) {
+                        std::fill(acc_re.begin(), acc_re.end(), 0);
+                        std::fill(acc_im.begin(), acc_im.end(), 0);
+                        for (size_t j = 0; j < dim; j++) {
+                            const fp_t v_re = std::real(in[r * dim + j]);
+                            const fp_t v_im = std::imag(in[r * dim + j]);
+                            const fp_t *a_re = mat_t_re.data() + j * dim;
+                            const fp_t *a_im = mat_t_im.data() + j * dim;
+                            for (size_t i = 0; i < dim; i++) {
+                                acc_re[i] += v_re * a_re[i] - v_im * a_im[i];
+                                acc_im[i] += v_re * a_im[i] + v_im * a_re[i];
+                            }
+                        }
+                        for (size_t i = 0; i < dim; i++) {
+                            out[r * dim + i] = {acc_re[i], acc_im[i]};
+                        }
+                    }
+                }
+
+                for (size_t r = 0; r < rows; r++) {
+                    CFP_t *shiftedState =
+                        arr_ + insertZeroBits_(k_begin + r, parity);
+                    for (size_t i = 0; i < dim; i++) {
+                        shiftedState[indices[i]] = out[r * dim + i];
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Apply the gates of a batch, merging the runs of consecutive
+     * diagonal gates and fusing the others.
+     *
+     * @see `applyOperations`.
+     */
+    void applyGateRuns_(const vector<GateOperation> &gate_ops,
+                        const vector<vector<size_t>> &wires,
+                        const vector<bool> &inverse,
+                        const vector<vector<fp_t>> &params,
+                        size_t max_fused_wires) {
+        const size_t numOperations = gate_ops.size();
+
+        // Statevector bound to the columns of fused matrices and diagonals
+        StateVector<fp_t> column_sv(nullptr, 1);
+        column_sv.setNumThreads(1);
+
+        // Runs of two or more diagonal gates are applied as one diagonal, the
+        // gates in between individually or fused
+        size_t begin = 0;
+        size_t i = 0;
+        while (i < numOperations) {
+            size_t run_end = i;
+            vector<size_t> run_wires;
+            while (run_end < numOperations &&
+                   Util::isDiagonalGate(gate_ops[run_end])) {
+                vector<size_t> merged = mergeWires_(run_wires, wires[run_end]);
+                if (merged.size() > DIAGONAL_FUSION_MAX_WIRES) {
+                    break;
+                }
+                run_wires = std::move(merged);
+                run_end++;
+            }
+            if (run_end - i < 2) {
+                i++;
+                continue;
+            }
+            applyOperationRange_(column_sv, gate_ops, wires, inverse, params,
+                                 begin, i, max_fused_wires);
+            applyDiagonalRun_(column_sv, gate_ops, wires, inverse, params, i,
+                              run_end, run_wires);
+            begin = run_end;
+            i = run_end;
+        }
+        applyOperationRange_(column_sv, gate_ops, wires, inverse, params,
+                             begin, numOperations, max_fused_wires);
+    }
+
+    /**
+     * @brief Get the disjoint pairs of positions to exchange so that the wires
+     * to reorder, given by `setReorderWires` or else chosen from the gates of
+     * a batch, are on the lowest-order positions.
+     *
+     * @param wires Wires of the gates of the batch.
+     * @return Pairs of a high-order and a low-order position, empty if
+     * reordering is disabled or not worthwhile.
+     */
+    auto getReorderPairs_(const vector<vector<size_t>> &wires) const
+        -> vector<std::pair<size_t, size_t>> {
+        const bool automatic = reorder_wires_.empty();
+        if (automatic && (reorder_qubits_ == 0 || wires.empty())) {
+            return {};
+        }
+        vector<size_t> uses(num_qubits_, 0);
+        for (const auto &op_wires : wires) {
+            for (const size_t wire : op_wires) {
+                if (wire < num_qubits_) {
+                    uses[wire]++;
+                }
+            }
+        }
+
+        // Wires used most first, preferring those already on low-order
+        // positions (the last wires) on ties
+        vector<size_t> local_wires{reorder_wires_};
+        if (automatic) {
+            vector<size_t> order(num_qubits_);
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(),
+                             [&uses](size_t wire0, size_t wire1) {
+                                 return std::make_pair(uses[wire0], wire0) >
+                                        std::make_pair(uses[wire1], wire1);
+                             });
+            const size_t num_local = std::min(reorder_qubits_, num_qubits_);
+            local_wires.assign(order.begin(), order.begin() + num_local);
+        }
+
+        const size_t first_local = num_qubits_ - local_wires.size();
+        vector<bool> is_local(num_qubits_, false);
+        vector<size_t> incoming;
+        for (const size_t wire : local_wires) {
+            is_local[wire] = true;
+            if (wire < first_local) {
+                incoming.push_back(wire);
+            }
+        }
+        vector<size_t> outgoing;
+        for (size_t pos = first_local; pos < num_qubits_; pos++) {
+            if (!is_local[pos]) {
+                outgoing.push_back(pos);
+            }
+        }
+        if (automatic) {
+            std::stable_sort(outgoing.begin(), outgoing.end(),
+                             [&uses](size_t wire0, size_t wire1) {
+                                 return uses[wire0] < uses[wire1];
+                             });
+        }
+
+        vector<std::pair<size_t, size_t>> pairs;
+        for (size_t k = 0; k < incoming.size(); k++) {
+            if (automatic &&
+                uses[incoming[k]] < uses[outgoing[k]] + REORDER_MIN_GAIN) {
+                break;
+            }
+            pairs.emplace_back(incoming[k], outgoing[k]);
+        }
+        return pairs;
+    }
+
+    //***********************************************************************//
+    //  Internal utility functions for gate fusion.
+    //***********************************************************************//
+
+    /**
+     * @brief Get the union of two wire lists, in order of first appearance.
+     */
+    static auto mergeWires_(const vector<size_t> &block_wires,
+                            const vector<size_t> &op_wires) -> vector<size_t> {
+        vector<size_t> merged{block_wires};
+        for (const size_t wire : op_wires) {
+            if (std::find(merged.begin(), merged.end(), wire) == merged.end()) {
+                merged.push_back(wire);
+            }
+        }
+        return merged;
+    }
+
+    /**
+     * @brief Get the positions of the wires of a gate within the wires of the
+     * block containing it.
+     */
+    static auto getLocalWires_(const vector<size_t> &block_wires,
+                               const vector<size_t> &op_wires)
+        -> vector<size_t> {
+        vector<size_t> local_wires(op_wires.size());
+        for (size_t k = 0; k < op_wires.size(); k++) {
+            local_wires[k] = static_cast<size_t>(
+                std::find(block_wires.begin(), block_wires.end(), op_wires[k]) -
+                block_wires.begin());
+        }
+        return local_wires;
+    }
+
+    /**
+     * @brief Apply the gates `[begin, end)`, fusing runs of consecutive gates
+     * whose combined wires do not exceed `max_fused_wires` when it is
+     * non-zero.
+     *
+     * @see `applyOperations`.
+     */
+    void applyOperationRange_(StateVector<fp_t> &column_sv,
+                              const vector<GateOperation> &gate_ops,
+                              const vector<vector<size_t>> &wires,
+                              const vector<bool> &inverse,
+                              const vector<vector<fp_t>> &params, size_t begin,
+                              size_t end, size_t max_fused_wires) {
+        if (max_fused_wires == 0) {
+            for (size_t i = begin; i < end; i++) {
+                applyOperation(gate_ops[i], wires[i], inverse[i], params[i]);
+            }
+            return;
+        }
+
+        size_t block_begin = begin;
+        vector<size_t> block_wires;
+        for (size_t i = begin; i < end; i++) {
+            vector<size_t> merged = mergeWires_(block_wires, wires[i]);
+            if (i > block_begin && merged.size() > max_fused_wires) {
+                applyFusedBlock_(column_sv, gate_ops, wires, inverse, params,
+                                 block_begin, i, block_wires);
+                block_begin = i;
+                merged = wires[i];
+            }
+            block_wires = std::move(merged);
+        }
+        if (block_begin < end) {
+            applyFusedBlock_(column_sv, gate_ops, wires, inverse, params,
+                             block_begin, end, block_wires);
+        }
+    }
+
+    /**
+     * @brief Merge the diagonal gates `[begin, end)` into one diagonal acting
+     * on `run_wires` and apply it to the statevector.
+     *
+     * The diagonal is built by applying each gate kernel to the all-ones
+     * vector, so every gate contributes exactly what its kernel computes.
+     *
+     * @param column_sv Scratch statevector used to apply gates to the
+     * diagonal.
+     * @param gate_ops Gates of all operations.
+     * @param begin Index of the first gate in the run.
+     * @param end Index past the last gate in the run.
+     * @param run_wires Union of the wires of all gates in the run.
+     */
+    void applyDiagonalRun_(StateVector<fp_t> &column_sv,
+                           const vector<GateOperation> &gate_ops,
+                           const vector<vector<size_t>> &wires,
+                           const vector<bool> &inverse,
+                           const vector<vector<fp_t>> &params, size_t begin,
+                           size_t end, const vector<size_t> &run_wires) {
+        vector<CFP_t> diag(Util::exp2(run_wires.size()), 1);
+        column_sv.setData(diag.data());
+        column_sv.setLength(diag.size());
+        for (size_t op = begin; op < end; op++) {
+            column_sv.applyOperation(gate_ops[op],
+                                     getLocalWires_(run_wires, wires[op]),
+                                     inverse[op], params[op]);
+        }
+        applyDiagonal(diag.data(), run_wires, false);
+    }
+
+    /**
+     * @brief Merge the gates `[begin, end)` into one matrix acting on
+     * `block_wires` and apply it to the statevector.
+     *
+     * The matrix is built by applying each gate kernel to the columns of the
+     * identity, so every gate contributes exactly what its kernel computes.
+     *
+     * @param column_sv Scratch statevector used to apply gates to columns.
+     * @param gate_ops Gates of all operations.
+     * @param begin Index of the first gate in the block.
+     * @param end Index past the last gate in the block.
+     * @param block_wires Union of the wires of all gates in the block.
+     */
+    void applyFusedBlock_(StateVector<fp_t> &column_sv,
+                          const vector<GateOperation> &gate_ops,
+                          const vector<vector<size_t>> &wires,
+                          const vector<bool> &inverse,
+                          const vector<vector<fp_t>> &params, size_t begin,
+                          size_t end, const vector<size_t> &block_wires) {
+        if (end - begin == 1) {
+            applyOperation(gate_ops[begin], wires[begin], inverse[begin],
+                           params[begin]);
+            return;
+        }
+
+        const size_t dim = Util::exp2(block_wires.size());
+        // Columns of the fused matrix, stored contiguously
+        vector<CFP_t> columns(dim * dim, 0);
+        for (size_t j = 0; j < dim; j++) {
+            columns[j * dim + j] = 1;
+        }
+        column_sv.setLength(dim);
+
+        for (size_t op = begin; op < end; op++) {
+            const vector<size_t> local_wires =
+                getLocalWires_(block_wires, wires[op]);
+            for (size_t j = 0; j < dim; j++) {
+                column_sv.setData(columns.data() + j * dim);
+                column_sv.applyOperation(gate_ops[op], local_wires,
+                                         inverse[op], params[op]);
+            }
+        }
+
+        vector<CFP_t> matrix(dim * dim);
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                matrix[row * dim + col] = columns[col * dim + row];
+            }
+        }
+        applyMatrix(matrix, block_wires, false);
+    }
+
+    //***********************************************************************//
+    //  Internal utility functions for cache blocking.
+    //***********************************************************************//
+
+    /**
+     * @brief Apply the gates with cache blocking.
+     *
+     * Every round either applies, as one group, all pending gates on
+     * low-order positions that can be moved ahead of the other pending gates
+     * (gates on disjoint wires commute), or exchanges wires so that the
+     * `cache_block_qubits_` wires needed next are on the low-order positions.
+     *
+     * @see `setCacheBlockQubits`.
+     */
+    void applyCacheBlocked_(const vector<GateOperation> &gate_ops,
+                            const vector<vector<size_t>> &wires,
+                            const vector<bool> &inverse,
+                            const vector<vector<fp_t>> &params) {
+        const size_t block_qubits = cache_block_qubits_;
+        const size_t first_local = num_qubits_ - block_qubits;
+        const size_t num_ops = gate_ops.size();
+        constexpr size_t no_use = std::numeric_limits<size_t>::max();
+
+        // Current position of every wire, and the wire at every position
+        vector<size_t> position(num_qubits_);
+        std::iota(position.begin(), position.end(), 0);
+        vector<size_t> wire_at{position};
+        auto exchange = [&](const vector<std::pair<size_t, size_t>> &pairs) {
+            if (pairs.empty()) {
+                return;
+            }
+            swapQubitPairs_(pairs);
+            for (const auto &[pos0, pos1] : pairs) {
+                std::swap(wire_at[pos0], wire_at[pos1]);
+                position[wire_at[pos0]] = pos0;
+                position[wire_at[pos1]] = pos1;
+            }
+        };
+        // Exchange the wires at the given high-order positions with those at
+        // the low-order positions marked as leaving. The leaving wires are
+        // first gathered on the highest low-order positions, so that the
+        // exchange moves contiguous runs of amplitudes.
+        auto relocate = [&](const vector<size_t> &high_positions,
+                            const vector<bool> &leaving) {
+            const size_t num_moves = high_positions.size();
+            vector<std::pair<size_t, size_t>> pairs;
+            size_t pos_in = first_local + num_moves;
+            for (size_t pos = first_local; pos < first_local + num_moves;
+                 pos++) {
+                if (leaving[pos]) {
+                    continue;
+                }
+                while (!leaving[pos_in]) {
+                    pos_in++;
+                }
+                pairs.emplace_back(pos, pos_in++);
+            }
+            exchange(pairs);
+            pairs.clear();
+            for (size_t k = 0; k < num_moves; k++) {
+                pairs.emplace_back(high_positions[k], first_local + k);
+            }
+            exchange(pairs);
+        };
+
+        vector<bool> applied(num_ops, false);
+        vector<bool> blocked(num_qubits_);
+        vector<size_t> group;
+        size_t first_pending = 0;
+        while (true) {
+            while (first_pending < num_ops && applied[first_pending]) {
+                first_pending++;
+            }
+            if (first_pending == num_ops) {
+                break;
+            }
+
+            // A pending gate can be moved into the group unless one of its
+            // wires is used by an earlier pending gate left out of it
+            group.clear();
+            std::fill(blocked.begin(), blocked.end(), false);
+            size_t num_blocked = 0;
+            for (size_t i = first_pending;
+                 i < num_ops && num_blocked < num_qubits_; i++) {
+                if (applied[i]) {
+                    continue;
+                }
+                bool movable = true;
+                for (const size_t wire : wires[i]) {
+                    movable = movable && !blocked[wire] &&
+                              position[wire] >= first_local;
+                }
+                if (movable) {
+                    group.push_back(i);
+                    applied[i] = true;
+                    continue;
+                }
+                for (const size_t wire : wires[i]) {
+                    num_blocked += blocked[wire] ? 0 : 1;
+                    blocked[wire] = true;
+                }
+            }
+            if (!group.empty()) {
+                applyCacheBlockGroup_(gate_ops, wires, inverse, params, group,
+                                      position, first_local);
+                continue;
+            }
+
+            const size_t op = first_pending;
+            if (wires[op].size() > block_qubits) {
+                vector<size_t> op_positions(wires[op].size());
+                for (size_t k = 0; k < wires[op].size(); k++) {
+                    op_positions[k] = position[wires[op][k]];
+                }
+                applyOperation(gate_ops[op], op_positions, inverse[op],
+                               params[op]);
+                applied[op] = true;
+                continue;
+            }
+
+            // Move the wires used soonest to the low-order positions,
+            // preferring those already there on ties
+            vector<size_t> next_use(num_qubits_, no_use);
+            for (size_t i = num_ops; i-- > first_pending;) {
+                if (!applied[i]) {
+                    for (const size_t wire : wires[i]) {
+                        next_use[wire] = i;
+                    }
+                }
+            }
+            vector<size_t> order(num_qubits_);
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(),
+                             [&](size_t wire0, size_t wire1) {
+                                 return std::make_pair(
+                                            next_use[wire0],
+                                            position[wire0] < first_local) <
+                                        std::make_pair(
+                                            next_use[wire1],
+                                            position[wire1] < first_local);
+                             });
+            vector<bool> wanted(num_qubits_, false);
+            for (size_t k = 0; k < block_qubits; k++) {
+                wanted[order[k]] = true;
+            }
+            vector<size_t> high_positions;
+            vector<bool> leaving(num_qubits_, false);
+            for (size_t pos = 0; pos < num_qubits_; pos++) {
+                if (pos < first_local && wanted[wire_at[pos]]) {
+                    high_positions.push_back(pos);
+                } else if (pos >= first_local && !wanted[wire_at[pos]]) {
+                    leaving[pos] = true;
+                }
+            }
+            relocate(high_positions, leaving);
+        }
+
+        // Restore the wire order, first moving every wire to the high- or
+        // low-order part containing its home position. Each remaining cycle
+        // of the permutation is the product of two reflections, made of
+        // disjoint exchanges within one part.
+        {
+            vector<size_t> high_positions;
+            vector<bool> leaving(num_qubits_, false);
+            for (size_t pos = 0; pos < num_qubits_; pos++) {
+                if (pos < first_local && wire_at[pos] >= first_local) {
+                    high_positions.push_back(pos);
+                } else if (pos >= first_local && wire_at[pos] < first_local) {
+                    leaving[pos] = true;
+                }
+            }
+            relocate(high_positions, leaving);
+        }
+        vector<std::pair<size_t, size_t>> reflection0;
+        vector<std::pair<size_t, size_t>> reflection1;
+        vector<bool> visited(num_qubits_, false);
+        for (size_t start = 0; start < num_qubits_; start++) {
+            vector<size_t> cycle;
+            for (size_t pos = start; !visited[pos]; pos = wire_at[pos]) {
+                visited[pos] = true;
+                cycle.push_back(pos);
+            }
+            const size_t len = cycle.size();
+            for (size_t i = 1; i < len; i++) {
+                if (i < len - i) {
+                    reflection0.emplace_back(cycle[i], cycle[len - i]);
+                }
+            }
+            for (size_t i = 0; i < len; i++) {
+                const size_t partner = (len + 1 - i) % len;
+                if (i < partner) {
+                    reflection1.emplace_back(cycle[i], cycle[partner]);
+                }
+            }
+        }
+        exchange(reflection0);
+        exchange(reflection1);
+    }
+
+    /**
+     * @brief Exchange the qubits of every given pair of positions in a single
+     * pass over the statevector.
+     *
+     * @param pairs Disjoint pairs of positions.
+     */
+    void swapQubitPairs_(const vector<std::pair<size_t, size_t>> &pairs) {
+        vector<std::pair<size_t, size_t>> masks;
+        for (const auto &[pos0, pos1] : pairs) {
+            masks.emplace_back(static_cast<size_t>(1U)
+                                   << (num_qubits_ - pos0 - 1),
+                               static_cast<size_t>(1U)
+                                   << (num_qubits_ - pos1 - 1));
+        }
+        // Amplitudes below the lowest exchanged bit move together
+        size_t run_bits = num_qubits_;
+        for (const auto &[pos0, pos1] : pairs) {
+            run_bits = std::min({run_bits, num_qubits_ - pos0 - 1,
+                                 num_qubits_ - pos1 - 1});
+        }
+        const size_t run_length = Util::exp2(run_bits);
+        const size_t num_runs = length_ >> run_bits;
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(masks, run_bits, run_length, num_runs)
+#endif
+        for (size_t r = 0; r < num_runs; r++) {
+            const size_t i = r << run_bits;
+            size_t j = i;
+            for (const auto &[mask0, mask1] : masks) {
+                if (((i & mask0) == 0) != ((i & mask1) == 0)) {
+                    j ^= mask0 | mask1;
+                }
+            }
+            if (i < j) {
+                std::swap_ranges(arr_ + i, arr_ + i + run_length, arr_ + j);
+            }
+        }
+    }
+
+    /**
+     * @brief Apply a group of gates acting on low-order positions only, one
+     * cache block at a time.
+     *
+     * @param gate_ops Gates of all operations.
+     * @param group Indices of the gates of the group.
+     * @param position Current position of every wire.
+     * @param first_local First position within a block.
+     */
+    void applyCacheBlockGroup_(const vector<GateOperation> &gate_ops,
+                               const vector<vector<size_t>> &wires,
+                               const vector<bool> &inverse,
+                               const vector<vector<fp_t>> &params,
+                               const vector<size_t> &group,
+                               const vector<size_t> &position,
+                               size_t first_local) {
+        if (group.empty()) {
+            return;
+        }
+        // Wires of the gates within a block
+        vector<vector<size_t>> block_wires(group.size());
+        for (size_t g = 0; g < group.size(); g++) {
+            for (const size_t wire : wires[group[g]]) {
+                block_wires[g].push_back(position[wire] - first_local);
+            }
+        }
+
+        const size_t block_size = Util::exp2(num_qubits_ - first_local);
+        const size_t num_blocks = length_ / block_size;
+        [[maybe_unused]] const bool parallel = useParallel_();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads_) if (parallel) default(none) \
+    shared(gate_ops, inverse, params, group, block_wires, block_size,          \
+           num_blocks)
+#endif
+        for (size_t b = 0; b < num_blocks; b++) {
+            StateVector<fp_t> block_sv(arr_ + b * block_size, block_size);
+            block_sv.num_threads_ = 1;
+            block_sv.simd_isa_ = simd_isa_;
+            for (size_t g = 0; g < group.size(); g++) {
+                block_sv.applyOperation(gate_ops[group[g]], block_wires[g],
+                                        inverse[group[g]], params[group[g]]);
+            }
+        }
+    }
+
+    //***********************************************************************//
+    //  Internal utility functions for opName dispatch use only.
+    //***********************************************************************//
+    inline void applyPauliX_(const vector<size_t> &wires, bool inverse,
+                             const vector<fp_t> &params) {
+        static_cast<void>(params);
+        applyPauliX(wires, inverse);
+    }
+    inline void applyPauliY_(const vector<size_t> &wires, bool inverse,
+                             const vector<fp_t> &params) {
+        static_cast<void>(params);
+        applyPauliY(wires, inverse);
+    }
+    inline void applyPauliZ_(const vector<size_t> &wires, bool inverse,
+                             const vector<fp_t> &params) {
+        static_cast<void>(params);
+        applyPauliZ(wires, inverse);
+    }
+    inline void applyHadamard_(const vector<size_t> &wires, bool inverse,
+                               const vector<fp_t> &params) {
+        static_cast<void>(params);
+        applyHadamard(wires, inverse);
+    }
+    inline void applyS_(const vector<size_t> &wires, bool inverse,
+                        const vector<fp_t> &params) {
+        static_cast<void>(params);
+        applyS(wires, inverse);
+    }
+    inline void applyT_(const vector<size_t> &wires, bool inverse,
+                        const vector<fp_t> &params) {
+        static_cast<void>(params);
+        applyT(wires, inverse);
+    }
+    inline void applyRX_(const vector<size_t> &wires, bool inverse,
+                         const vector<fp_t> &params) {
+        applyRX(wires, inverse, params[0]);
+    }
+    inline void applyRY_(const vector<size_t> &wires, bool inverse,
+                         const vector<fp_t> &params) {
+        applyRY(wires, inverse, params[0]);
+    }
+    inline void applyRZ_(const vector<size_t> &wires, bool inverse,
                          const vector<fp_t> &params) {
-        applyRZ(indices, externalIndices, inverse, params[0]);
+        applyRZ(wires, inverse, params[0]);
     }
-    inline void applyPhaseShift_(const vector<size_t> &indices,
-                                 const vector<size_t> &externalIndices,
-                                 bool inverse, const vector<fp_t> &params) {
-        applyPhaseShift(indices, externalIndices, inverse, params[0]);
+    inline void applyPhaseShift_(const vector<size_t> &wires, bool inverse,
+                                 const vector<fp_t> &params) {
+        applyPhaseShift(wires, inverse, params[0]);
     }
     inline void
-    applyControlledPhaseShift_(const vector<size_t> &indices,
-                               const vector<size_t> &externalIndices,
-                               bool inverse, const vector<fp_t> &params) {
-        applyControlledPhaseShift(indices, externalIndices, inverse, params[0]);
+    applyControlledPhaseShift_(const vector<size_t> &wires, bool inverse,
+                               const vector<fp_t> &params) {
+        applyControlledPhaseShift(wires, inverse, params[0]);
     }
-    inline void applyRot_(const vector<size_t> &indices,
-                          const vector<size_t> &externalIndices, bool inverse,
+    inline void applyRot_(const vector<size_t> &wires, bool inverse,
                           const vector<fp_t> &params) {
-        applyRot(indices, externalIndices, inverse, params[0], params[1],
-                 params[2]);
+        applyRot(wires, inverse, params[0], params[1], params[2]);
     }
-    inline void applyCNOT_(const vector<size_t> &indices,
-                           const vector<size_t> &externalIndices, bool inverse,
+    inline void applyCNOT_(const vector<size_t> &wires, bool inverse,
                            const vector<fp_t> &params) {
         static_cast<void>(params);
-        applyCNOT(indices, externalIndices, inverse);
+        applyCNOT(wires, inverse);
     }
-    inline void applySWAP_(const vector<size_t> &indices,
-                           const vector<size_t> &externalIndices, bool inverse,
+    inline void applySWAP_(const vector<size_t> &wires, bool inverse,
                            const vector<fp_t> &params) {
         static_cast<void>(params);
-        applySWAP(indices, externalIndices, inverse);
+        applySWAP(wires, inverse);
     }
-    inline void applyCZ_(const vector<size_t> &indices,
-                         const vector<size_t> &externalIndices, bool inverse,
+    inline void applyCZ_(const vector<size_t> &wires, bool inverse,
                          const vector<fp_t> &params) {
         static_cast<void>(params);
-        applyCZ(indices, externalIndices, inverse);
+        applyCZ(wires, inverse);
     }
-    inline void applyCRX_(const vector<size_t> &indices,
-                          const vector<size_t> &externalIndices, bool inverse,
+    inline void applyCRX_(const vector<size_t> &wires, bool inverse,
                           const vector<fp_t> &params) {
-        applyCRX(indices, externalIndices, inverse, params[0]);
+        applyCRX(wires, inverse, params[0]);
     }
-    inline void applyCRY_(const vector<size_t> &indices,
-                          const vector<size_t> &externalIndices, bool inverse,
+    inline void applyCRY_(const vector<size_t> &wires, bool inverse,
                           const vector<fp_t> &params) {
-        applyCRY(indices, externalIndices, inverse, params[0]);
+        applyCRY(wires, inverse, params[0]);
     }
-    inline void applyCRZ_(const vector<size_t> &indices,
-                          const vector<size_t> &externalIndices, bool inverse,
+    inline void applyCRZ_(const vector<size_t> &wires, bool inverse,
                           const vector<fp_t> &params) {
-        applyCRZ(indices, externalIndices, inverse, params[0]);
+        applyCRZ(wires, inverse, params[0]);
     }
-    inline void applyCRot_(const vector<size_t> &indices,
-                           const vector<size_t> &externalIndices, bool inverse,
+    inline void applyCRot_(const vector<size_t> &wires, bool inverse,
                            const vector<fp_t> &params) {
-        applyCRot(indices, externalIndices, inverse, params[0], params[1],
-                  params[2]);
+        applyCRot(wires, inverse, params[0], params[1], params[2]);
     }
-    inline void applyToffoli_(const vector<size_t> &indices,
-                              const vector<size_t> &externalIndices,
-                              bool inverse, const vector<fp_t> &params) {
+    inline void applyToffoli_(const vector<size_t> &wires, bool inverse,
+                              const vector<fp_t> &params) {
         static_cast<void>(params);
-        applyToffoli(indices, externalIndices, inverse);
+        applyToffoli(wires, inverse);
     }
-    inline void applyCSWAP_(const vector<size_t> &indices,
-                            const vector<size_t> &externalIndices, bool inverse,
+    inline void applyCSWAP_(const vector<size_t> &wires, bool inverse,
                             const vector<fp_t> &params) {
         static_cast<void>(params);
-        applyCSWAP(indices, externalIndices, inverse);
+        applyCSWAP(wires, inverse);
     }
 };
 /**
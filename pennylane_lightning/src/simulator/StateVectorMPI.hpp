@@ -0,0 +1,553 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a statevector distributed over the processes of an MPI
+ * communicator.
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include "Dispatcher.hpp"
+#include "Error.hpp"
+#include "StateVectorManaged.hpp"
+#include "Util.hpp"
+
+namespace Pennylane {
+
+namespace Util {
+
+/**
+ * @brief Get the MPI datatype matching a real or complex floating-point type.
+ *
+ * @tparam T `float`, `double`, or a `std::complex` of either.
+ * @return MPI_Datatype
+ */
+template <class T> auto getMPIDatatype() -> MPI_Datatype {
+    if constexpr (std::is_same_v<T, float>) {
+        return MPI_FLOAT;
+    } else if constexpr (std::is_same_v<T, double>) {
+        return MPI_DOUBLE;
+    } else if constexpr (std::is_same_v<T, std::complex<float>>) {
+        return MPI_C_FLOAT_COMPLEX;
+    } else {
+        static_assert(std::is_same_v<T, std::complex<double>>,
+                      "Unsupported MPI datatype.");
+        return MPI_C_DOUBLE_COMPLEX;
+    }
+}
+
+} // namespace Util
+
+/**
+ * @brief Statevector whose amplitudes are split over the processes of an MPI
+ * communicator.
+ *
+ * With \f$P = 2^g\f$ processes, the top \f$g\f$ qubits (wires `0` to `g-1`)
+ * are global: their bits are the rank of the process holding an amplitude.
+ * Each process stores the \f$2^{n-g}\f$ amplitudes of its rank as a
+ * `%StateVectorManaged` over the remaining local qubits, where wire `w`
+ * becomes local wire `w - g`.
+ *
+ * Gates acting on local wires only run on the local statevector with the
+ * existing kernels and need no communication. For a gate acting on a global
+ * wire, the global qubit is first swapped with a local qubit the gate does not
+ * use, the gate is applied locally, and the qubits are swapped back. Each swap
+ * exchanges half of the local amplitudes with one partner process, in chunks
+ * of `EXCHANGE_CHUNK_ELEMENTS`.
+ *
+ * All processes of the communicator must call the same methods in the same
+ * order with the same arguments.
+ *
+ * @tparam fp_t Floating-point precision.
+ */
+template <class fp_t = double> class StateVectorMPI {
+  public:
+    using CFP_t = std::complex<fp_t>;
+
+    /**
+     * @brief Number of amplitudes sent to the partner process per message.
+     */
+    static constexpr size_t EXCHANGE_CHUNK_ELEMENTS = 1U << 16U;
+
+    /**
+     * @brief Fewest local qubits per process, so that every supported gate
+     * can be made local.
+     */
+    static constexpr size_t MIN_LOCAL_QUBITS = 3;
+
+  private:
+    MPI_Comm comm_;
+    size_t rank_;
+    size_t num_qubits_;
+    size_t num_global_qubits_;
+    StateVectorManaged<fp_t> local_;
+
+    /**
+     * @brief Get the number of global qubits of a communicator, checking that
+     * its size is a power of two.
+     */
+    static auto getNumGlobalQubits_(MPI_Comm comm, size_t num_qubits)
+        -> size_t {
+        int size = 0;
+        MPI_Comm_size(comm, &size);
+        const auto num_processes = static_cast<size_t>(size);
+        PL_ABORT_IF_NOT((num_processes & (num_processes - 1)) == 0,
+                        "The number of MPI processes must be a power of two.");
+        const size_t num_global = Util::log2(num_processes);
+        PL_ABORT_IF(num_qubits < num_global + MIN_LOCAL_QUBITS,
+                    "Too few qubits for the number of MPI processes.");
+        return num_global;
+    }
+
+    static auto getRank_(MPI_Comm comm) -> size_t {
+        int rank = 0;
+        MPI_Comm_rank(comm, &rank);
+        return static_cast<size_t>(rank);
+    }
+
+    /**
+     * @brief Swap a global qubit with a local qubit.
+     *
+     * The amplitudes whose local bit differs from the rank bit of this
+     * process move to the partner process differing in that rank bit, which
+     * sends back the same number of amplitudes to the same positions.
+     *
+     * @param global_wire Wire of the global qubit.
+     * @param local_wire Local wire of the local qubit.
+     */
+    void swapGlobalLocal_(size_t global_wire, size_t local_wire) {
+        const size_t num_local = getNumLocalQubits();
+        const size_t rank_bit = num_global_qubits_ - 1 - global_wire;
+        const size_t local_bit = num_local - 1 - local_wire;
+        const auto partner =
+            static_cast<int>(rank_ ^ (static_cast<size_t>(1U) << rank_bit));
+        const size_t moved_value = ((rank_ >> rank_bit) & 1U) ^ 1U;
+
+        CFP_t *arr = local_.getData();
+        const size_t half = local_.getLength() / 2;
+        const size_t chunk = std::min(EXCHANGE_CHUNK_ELEMENTS, half);
+        const size_t run = static_cast<size_t>(1U) << local_bit;
+        const size_t low_mask = run - 1;
+        const MPI_Datatype datatype = Util::getMPIDatatype<CFP_t>();
+
+        // Index of the k-th amplitude with the local bit equal to moved_value
+        const auto moved_index = [=](size_t k) {
+            return ((k >> local_bit) << (local_bit + 1)) |
+                   (moved_value << local_bit) | (k & low_mask);
+        };
+
+        std::vector<CFP_t> buffer;
+        if (run < chunk) {
+            buffer.resize(chunk);
+        }
+        for (size_t begin = 0; begin < half; begin += chunk) {
+            if (run >= chunk) {
+                // The chunk lies within one contiguous run
+                MPI_Sendrecv_replace(arr + moved_index(begin),
+                                     static_cast<int>(chunk), datatype,
+                                     partner, 0, partner, 0, comm_,
+                                     MPI_STATUS_IGNORE);
+                continue;
+            }
+            for (size_t k = 0; k < chunk; k++) {
+                buffer[k] = arr[moved_index(begin + k)];
+            }
+            MPI_Sendrecv_replace(buffer.data(), static_cast<int>(chunk),
+                                 datatype, partner, 0, partner, 0, comm_,
+                                 MPI_STATUS_IGNORE);
+            for (size_t k = 0; k < chunk; k++) {
+                arr[moved_index(begin + k)] = buffer[k];
+            }
+        }
+    }
+
+    /**
+     * @brief Indicate whether all given wires are local.
+     */
+    [[nodiscard]] auto areLocal_(const std::vector<size_t> &wires) const
+        -> bool {
+        return std::all_of(wires.begin(), wires.end(), [this](size_t w) {
+            return w >= num_global_qubits_;
+        });
+    }
+
+  public:
+    /**
+     * @brief Create the distributed state \f$|0\cdots0\rangle\f$.
+     *
+     * @param num_qubits Number of qubits. At least `MIN_LOCAL_QUBITS` qubits
+     * must be local to each process.
+     * @param comm Communicator whose processes share the statevector. Its
+     * size must be a power of two.
+     */
+    explicit StateVectorMPI(size_t num_qubits, MPI_Comm comm = MPI_COMM_WORLD)
+        : comm_{comm}, rank_{getRank_(comm)}, num_qubits_{num_qubits},
+          num_global_qubits_{getNumGlobalQubits_(comm, num_qubits)},
+          local_(num_qubits - num_global_qubits_) {
+        if (rank_ != 0) {
+            local_.getDataVector()[0] = {0, 0};
+        }
+    }
+
+    /**
+     * @brief Distribute a statevector known to every process. Each process
+     * copies its own slice of the amplitudes.
+     *
+     * @param data Amplitudes of the full statevector.
+     * @param length Number of amplitudes, a power of two.
+     * @param comm Communicator whose processes share the statevector. Its
+     * size must be a power of two.
+     */
+    StateVectorMPI(const CFP_t *data, size_t length,
+                   MPI_Comm comm = MPI_COMM_WORLD)
+        : comm_{comm}, rank_{getRank_(comm)},
+          num_qubits_{Util::log2(length)},
+          num_global_qubits_{getNumGlobalQubits_(comm, num_qubits_)},
+          local_(data + (rank_ << (num_qubits_ - num_global_qubits_)),
+                 length >> num_global_qubits_) {
+        PL_ABORT_IF_NOT(Util::exp2(num_qubits_) == length,
+                        "The statevector length must be a power of two.");
+    }
+
+    /**
+     * @brief Get the number of qubits of the full statevector.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Get the number of global qubits, whose bits select the process.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getNumGlobalQubits() const -> size_t {
+        return num_global_qubits_;
+    }
+
+    /**
+     * @brief Get the number of qubits stored by each process.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getNumLocalQubits() const -> size_t {
+        return num_qubits_ - num_global_qubits_;
+    }
+
+    /**
+     * @brief Get the number of amplitudes of the full statevector.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getLength() const -> size_t {
+        return Util::exp2(num_qubits_);
+    }
+
+    /**
+     * @brief Get the index of the first local amplitude in the full
+     * statevector.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getLocalOffset() const -> size_t {
+        return rank_ << getNumLocalQubits();
+    }
+
+    /**
+     * @brief Get the rank of this process.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getRank() const -> size_t { return rank_; }
+
+    /**
+     * @brief Get the communicator of the statevector.
+     *
+     * @return MPI_Comm
+     */
+    [[nodiscard]] auto getComm() const -> MPI_Comm { return comm_; }
+
+    /**
+     * @brief Get the local part of the statevector. Its parallel settings
+     * control the threads used by each process.
+     *
+     * @return StateVectorManaged<fp_t>&
+     */
+    auto getLocal() -> StateVectorManaged<fp_t> & { return local_; }
+
+    /**
+     * @brief Get the local part of the statevector.
+     *
+     * @return const StateVectorManaged<fp_t>&
+     */
+    [[nodiscard]] auto getLocal() const -> const StateVectorManaged<fp_t> & {
+        return local_;
+    }
+
+    /**
+     * @brief Sum a value over all processes.
+     *
+     * @tparam U Real or complex floating-point type.
+     * @param value Contribution of this process.
+     * @return U Sum over the communicator, on every process.
+     */
+    template <class U> [[nodiscard]] auto allreduceSum(U value) const -> U {
+        U result{};
+        MPI_Allreduce(&value, &result, 1, Util::getMPIDatatype<U>(), MPI_SUM,
+                      comm_);
+        return result;
+    }
+
+    /**
+     * @brief Gather the full statevector on every process. This is meant for
+     * states small enough to fit on one node.
+     *
+     * @return std::vector<CFP_t>
+     */
+    [[nodiscard]] auto gatherData() const -> std::vector<CFP_t> {
+        std::vector<CFP_t> data(getLength());
+        const auto count = static_cast<int>(local_.getLength());
+        const MPI_Datatype datatype = Util::getMPIDatatype<CFP_t>();
+        MPI_Allgather(local_.getData(), count, datatype, data.data(), count,
+                      datatype, comm_);
+        return data;
+    }
+
+    /**
+     * @brief Copy the amplitudes of a statevector with the same distribution.
+     *
+     * @param other Statevector to copy from.
+     */
+    void updateData(const StateVectorMPI &other) {
+        local_.updateData(other.local_.getDataVector());
+    }
+
+    /**
+     * @brief Calculate \f$\langle\mathrm{this}|\mathrm{other}\rangle\f$.
+     *
+     * @param other Statevector with the same distribution.
+     * @return CFP_t Inner product, on every process.
+     */
+    [[nodiscard]] auto innerProduct(const StateVectorMPI &other) const
+        -> CFP_t {
+        PL_ABORT_IF_NOT(local_.getLength() == other.local_.getLength(),
+                        "The statevectors must have the same distribution.");
+        return allreduceSum(Util::innerProdC(
+            local_.getData(), other.local_.getData(), local_.getLength()));
+    }
+
+    /**
+     * @brief Run a function on the local statevector with the given wires
+     * made local.
+     *
+     * Every global wire is swapped with a free local wire, preferring the
+     * most significant ones whose amplitudes are exchanged contiguously. The
+     * swaps are undone afterwards, also if `func` throws.
+     *
+     * @param wires Wires of the full statevector.
+     * @param func Callable with arguments `(StateVectorManaged<fp_t> &local,
+     * const std::vector<size_t> &local_wires)`, where `local_wires` are the
+     * local wires now holding `wires`.
+     */
+    template <class Func>
+    void applyLocal(const std::vector<size_t> &wires, Func &&func) {
+        std::vector<bool> used(num_qubits_, false);
+        for (const size_t w : wires) {
+            PL_ABORT_IF_NOT(w < num_qubits_, "Wire index out of range.");
+            PL_ABORT_IF(used[w], "The wires of a gate must be distinct.");
+            used[w] = true;
+        }
+
+        std::vector<size_t> local_wires(wires.size());
+        std::vector<std::pair<size_t, size_t>> swaps;
+        size_t next_free = num_global_qubits_;
+        for (size_t i = 0; i < wires.size(); i++) {
+            if (wires[i] >= num_global_qubits_) {
+                local_wires[i] = wires[i] - num_global_qubits_;
+                continue;
+            }
+            while (next_free < num_qubits_ && used[next_free]) {
+                next_free++;
+            }
+            PL_ABORT_IF(next_free == num_qubits_,
+                        "Too few local qubits to apply the gate.");
+            used[next_free] = true;
+            local_wires[i] = next_free - num_global_qubits_;
+            swaps.emplace_back(wires[i], local_wires[i]);
+        }
+
+        for (const auto &[global_wire, local_wire] : swaps) {
+            swapGlobalLocal_(global_wire, local_wire);
+        }
+        try {
+            func(local_, local_wires);
+        } catch (...) {
+            for (auto it = swaps.rbegin(); it != swaps.rend(); ++it) {
+                swapGlobalLocal_(it->first, it->second);
+            }
+            throw;
+        }
+        for (auto it = swaps.rbegin(); it != swaps.rend(); ++it) {
+            swapGlobalLocal_(it->first, it->second);
+        }
+    }
+
+    /**
+     * @brief Apply a single gate to the statevector.
+     *
+     * @param gate_op Gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(GateOperation gate_op, const std::vector<size_t> &wires,
+                        bool inverse = false,
+                        const std::vector<fp_t> &params = {}) {
+        applyLocal(wires, [&](StateVectorManaged<fp_t> &local,
+                              const std::vector<size_t> &local_wires) {
+            local.applyOperation(gate_op, local_wires, inverse, params);
+        });
+    }
+
+    /**
+     * @brief Apply a single gate to the statevector.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(const std::string &opName,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<fp_t> &params = {}) {
+        applyOperation(Util::lookupGateOperation(opName), wires, inverse,
+                       params);
+    }
+
+    /**
+     * @brief Apply a single gate given by its matrix to the statevector.
+     *
+     * @param matrix Arbitrary unitary gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Unused.
+     */
+    void applyOperation(const std::vector<CFP_t> &matrix,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<fp_t> &params = {}) {
+        applyLocal(wires, [&](StateVectorManaged<fp_t> &local,
+                              const std::vector<size_t> &local_wires) {
+            local.applyOperation(matrix, local_wires, inverse, params);
+        });
+    }
+
+    /**
+     * @brief Apply a matrix to the statevector.
+     *
+     * @param matrix Row-major matrix of dimension \f$2^k\f$ for `k` wires.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicates whether to apply the adjoint of the matrix.
+     */
+    void applyMatrix(const std::vector<CFP_t> &matrix,
+                     const std::vector<size_t> &wires, bool inverse = false) {
+        applyLocal(wires, [&](StateVectorManaged<fp_t> &local,
+                              const std::vector<size_t> &local_wires) {
+            local.applyMatrix(matrix, local_wires, inverse);
+        });
+    }
+
+    /**
+     * @brief Apply multiple gates to the statevector.
+     *
+     * Consecutive gates acting on local wires only are passed together to
+     * `StateVector::applyOperations` of the local statevector, so that they
+     * are fused there as in the single-process case.
+     *
+     * @param ops Vector of gate names to be applied in order.
+     * @param wires Vector of wires on which to apply index-matched gate name.
+     * @param inverse Indicates whether gate at matched index is to be inverted.
+     * @param params Parameter data for index matched gates.
+     * @param max_fused_wires Maximum number of wires of a fused gate, see
+     * `StateVector::applyOperations`.
+     */
+    void applyOperations(const std::vector<std::string> &ops,
+                         const std::vector<std::vector<size_t>> &wires,
+                         const std::vector<bool> &inverse,
+                         const std::vector<std::vector<fp_t>> &params,
+                         size_t max_fused_wires = 0) {
+        const size_t num_operations = ops.size();
+        PL_ABORT_IF_NOT(num_operations == wires.size() &&
+                            num_operations == inverse.size() &&
+                            num_operations == params.size(),
+                        "Invalid arguments: number of operations, wires, "
+                        "inverses, and parameters must all be equal");
+
+        std::vector<std::string> run_ops;
+        std::vector<std::vector<size_t>> run_wires;
+        std::vector<bool> run_inverse;
+        std::vector<std::vector<fp_t>> run_params;
+        const auto flush = [&]() {
+            if (!run_ops.empty()) {
+                local_.applyOperations(run_ops, run_wires, run_inverse,
+                                       run_params, max_fused_wires);
+                run_ops.clear();
+                run_wires.clear();
+                run_inverse.clear();
+                run_params.clear();
+            }
+        };
+
+        for (size_t i = 0; i < num_operations; i++) {
+            if (!areLocal_(wires[i])) {
+                flush();
+                applyOperation(ops[i], wires[i], inverse[i], params[i]);
+                continue;
+            }
+            std::vector<size_t> local_wires(wires[i]);
+            for (auto &w : local_wires) {
+                w -= num_global_qubits_;
+            }
+            run_ops.push_back(ops[i]);
+            run_wires.push_back(std::move(local_wires));
+            run_inverse.push_back(inverse[i]);
+            run_params.push_back(params[i]);
+        }
+        flush();
+    }
+
+    /**
+     * @brief Apply multiple non-parametric gates to the statevector.
+     *
+     * @param ops Vector of gate names to be applied in order.
+     * @param wires Vector of wires on which to apply index-matched gate name.
+     * @param inverse Indicates whether gate at matched index is to be inverted.
+     */
+    void applyOperations(const std::vector<std::string> &ops,
+                         const std::vector<std::vector<size_t>> &wires,
+                         const std::vector<bool> &inverse) {
+        applyOperations(ops, wires, inverse,
+                        std::vector<std::vector<fp_t>>(ops.size()));
+    }
+};
+
+} // namespace Pennylane
@@ -10,6 +10,11 @@
 // limitations under the License.
 #pragma once
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "Memory.hpp"
 #include "StateVector.hpp"
 
 namespace Pennylane {
@@ -18,60 +23,126 @@ namespace Pennylane {
  * @brief Managed memory version of StateVector class. Memory ownership resides
  * within class.
  *
- * @tparam fp_t
+ * The storage is a `std::vector` using the given allocator policy. With a
+ * first-touch allocator such as `%Util::AlignedAllocator`, the data is left
+ * untouched on allocation and written by the same OpenMP threads and static
+ * schedule as the gate kernels, so that its pages are placed on the NUMA node
+ * of the threads working on them.
+ *
+ * @tparam fp_t Floating-point precision.
+ * @tparam Allocator Allocator of the amplitudes.
  */
-template <class fp_t = double>
+template <class fp_t = double,
+          class Allocator = std::allocator<std::complex<fp_t>>>
 class StateVectorManaged : public StateVector<fp_t> {
   private:
     using CFP_t = std::complex<fp_t>;
 
-    std::vector<CFP_t> data_;
+    std::vector<CFP_t, Allocator> data_;
+
+    /**
+     * @brief Write every amplitude, either from `src` or with zeros, from the
+     * threads of the gate kernels.
+     *
+     * @param src Data to copy, or nullptr to zero the state.
+     */
+    void fillData_(const CFP_t *src) {
+        CFP_t *dst = data_.data();
+        const size_t length = data_.size();
+        [[maybe_unused]] const bool parallel =
+            this->getNumThreads() > 1 &&
+            length >= this->getParallelThreshold();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(this->getNumThreads()) if (parallel)     \
+    schedule(static) default(none) shared(src, dst, length)
+#endif
+        for (size_t i = 0; i < length; i++) {
+            dst[i] = (src == nullptr) ? CFP_t{0, 0} : src[i];
+        }
+    }
+
+    /**
+     * @brief Allocate the storage of `length` amplitudes. First-touch
+     * allocators leave it untouched for `initData_`, the others initialize it
+     * sequentially from `src`, or with zeros if `src` is nullptr.
+     */
+    static auto allocateData_(const CFP_t *src, size_t length)
+        -> std::vector<CFP_t, Allocator> {
+        if constexpr (Util::is_first_touch_allocator_v<Allocator>) {
+            return std::vector<CFP_t, Allocator>(length);
+        } else {
+            if (src == nullptr) {
+                return std::vector<CFP_t, Allocator>(length, CFP_t{0, 0});
+            }
+            return std::vector<CFP_t, Allocator>(src, src + length);
+        }
+    }
+
+    /**
+     * @brief Complete the initialization started by `allocateData_`.
+     *
+     * @param src Data to copy, or nullptr to zero the state.
+     */
+    void initData_(const CFP_t *src) {
+        if constexpr (Util::is_first_touch_allocator_v<Allocator>) {
+            fillData_(src);
+        }
+        StateVector<fp_t>::setData(data_.data());
+    }
 
   public:
     StateVectorManaged() : StateVector<fp_t>() {}
     StateVectorManaged(size_t num_qubits)
         : StateVector<fp_t>(nullptr,
                             static_cast<size_t>(Util::exp2(num_qubits))),
-          data_(static_cast<size_t>(Util::exp2(num_qubits)), CFP_t{0, 0}) {
-        StateVector<fp_t>::setData(data_.data());
+          data_(allocateData_(nullptr,
+                              static_cast<size_t>(Util::exp2(num_qubits)))) {
+        initData_(nullptr);
         data_[0] = {1, 0};
     }
+    /**
+     * @brief Copy the data of a statevector. The copy inherits its parallel,
+     * cache blocking and wire reordering settings, the first also applying to
+     * the first touch of the data.
+     */
     StateVectorManaged(const StateVector<fp_t> &other)
-        : StateVector<fp_t>(nullptr, data_.size()),
-          data_{other.getData(), other.getData() + other.getLength()} {
-        StateVector<fp_t>::setData(data_.data());
+        : StateVector<fp_t>(nullptr, other.getLength()),
+          data_(allocateData_(other.getData(), other.getLength())) {
+        this->setNumThreads(other.getNumThreads());
+        this->setParallelThreshold(other.getParallelThreshold());
+        this->setCacheBlockQubits(other.getCacheBlockQubits());
+        this->setReorderQubits(other.getReorderQubits());
+        this->setReorderWires(other.getReorderWires());
+        initData_(other.getData());
     }
-    StateVectorManaged(const std::vector<CFP_t> &other_data)
-        : StateVector<fp_t>(nullptr, other_data.size()), data_{other_data} {
-        StateVector<fp_t>::setData(data_.data());
+    template <class OtherAllocator>
+    StateVectorManaged(const std::vector<CFP_t, OtherAllocator> &other_data)
+        : StateVector<fp_t>(nullptr, other_data.size()),
+          data_(allocateData_(other_data.data(), other_data.size())) {
+        initData_(other_data.data());
     }
     StateVectorManaged(const CFP_t *other_data, size_t other_size)
-        : StateVector<fp_t>(nullptr, other_size), data_{other_data,
-                                                        other_data +
-                                                            other_size} {
-        StateVector<fp_t>::setData(data_.data());
-    }
-    StateVectorManaged(const StateVectorManaged<fp_t> &other)
-        : StateVector<fp_t>(nullptr, other.getDataVector().size()),
-          data_{other.data_} {
-        StateVector<fp_t>::setData(data_.data());
+        : StateVector<fp_t>(nullptr, other_size),
+          data_(allocateData_(other_data, other_size)) {
+        initData_(other_data);
     }
+    StateVectorManaged(const StateVectorManaged &other)
+        : StateVectorManaged(static_cast<const StateVector<fp_t> &>(other)) {}
 
-    auto operator=(const StateVectorManaged<fp_t> &other)
-        -> StateVectorManaged & {
+    auto operator=(const StateVectorManaged &other) -> StateVectorManaged & {
         if (this != &other) {
             if (data_.size() != other.getLength()) {
                 data_.resize(other.getLength());
                 StateVector<fp_t>::setData(data_.data());
                 StateVector<fp_t>::setLength(other.getLength());
             }
-            std::copy(other.data_.data(),
-                      other.data_.data() + other.getLength(), data_.data());
+            fillData_(other.data_.data());
         }
         return *this;
     }
-    auto getDataVector() -> std::vector<CFP_t> & { return data_; }
-    [[nodiscard]] auto getDataVector() const -> const std::vector<CFP_t> & {
+    auto getDataVector() -> std::vector<CFP_t, Allocator> & { return data_; }
+    [[nodiscard]] auto getDataVector() const
+        -> const std::vector<CFP_t, Allocator> & {
         return data_;
     }
 
@@ -90,10 +161,30 @@ class StateVectorManaged : public StateVector<fp_t> {
                                                    Util::log2(data_.size()));
         return externalIndices;
     }
-    void updateData(const std::vector<CFP_t> &new_data) {
-        PL_ABORT_IF_NOT(data_.size() == new_data.size(),
+    template <class OtherAllocator>
+    void updateData(const std::vector<CFP_t, OtherAllocator> &new_data) {
+        updateData(new_data.data(), new_data.size());
+    }
+    /**
+     * @brief Overwrite the amplitudes in place, keeping the storage and hence
+     * every pointer to it valid.
+     *
+     * @param new_data Amplitudes to copy.
+     * @param new_size Number of amplitudes, equal to the current length.
+     */
+    void updateData(const CFP_t *new_data, size_t new_size) {
+        PL_ABORT_IF_NOT(data_.size() == new_size,
                         "New data must be the same size as old data.")
-        std::copy(new_data.begin(), new_data.end(), data_.begin());
+        PL_INSTRUMENT_SCOPE("StateVectorManaged::updateData",
+                            2 * new_size * sizeof(CFP_t));
+        fillData_(new_data);
+    }
+    /**
+     * @brief Reset the statevector to \f$|0\cdots 0\rangle\f$ in place.
+     */
+    void resetState() {
+        fillData_(nullptr);
+        data_[0] = {1, 0};
     }
 };
 
@@ -0,0 +1,235 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a statevector stored in a memory-mapped file, for states larger
+ * than the main memory.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Error.hpp"
+#include "StateVector.hpp"
+#include "Util.hpp"
+
+namespace Pennylane {
+
+/**
+ * @brief Statevector whose amplitudes live in a file mapped into memory, so
+ * that its size is bounded by the disk rather than the main memory.
+ *
+ * The operating system pages the amplitudes in and out of the mapping as the
+ * kernels touch them. To keep the traffic to the disk at a few passes per
+ * batch of gates, `applyOperations` is cache blocked with chunks of
+ * `2^chunk_qubits` amplitudes (see `%StateVector::setCacheBlockQubits`): each
+ * group of gates on the low-order qubits is applied chunk by chunk, so that
+ * every chunk is read and written back once per group, and higher-order
+ * qubits are brought into the chunks by exchange passes over the file. The
+ * mapping is advised for sequential access, so that the kernel reads ahead
+ * of the chunk being processed and evicts the chunks already done first.
+ *
+ * Gates applied one at a time, observables and the adjoint method still work
+ * on the mapped data, at the cost of one pass over the file per gate.
+ *
+ * @tparam fp_t Floating-point precision.
+ */
+template <class fp_t = double>
+class StateVectorMapped : public StateVector<fp_t> {
+  public:
+    using CFP_t = std::complex<fp_t>;
+
+    /**
+     * @brief Default number of qubits of a chunk, 16 MiB of
+     * `complex<double>`.
+     */
+    static constexpr size_t DEFAULT_CHUNK_QUBITS = 20;
+
+    /**
+     * @brief First bytes of a checkpoint file, followed by the size of `fp_t`
+     * and the number of qubits as 64-bit integers, then the amplitudes.
+     */
+    static constexpr std::array<char, 8> CHECKPOINT_MAGIC{'P', 'L', 'S', 'V',
+                                                          'C', 'K', 'P', '1'};
+
+  private:
+    std::string path_;
+    int fd_{-1};
+    size_t num_bytes_;
+
+    /**
+     * @brief Create the file of `num_bytes` zero bytes and map it.
+     */
+    auto mapFile_() -> CFP_t * {
+        fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+        PL_ABORT_IF(fd_ < 0, "Failed to create the file of the mapped "
+                             "statevector.");
+        if (::ftruncate(fd_, static_cast<off_t>(num_bytes_)) != 0) {
+            ::close(fd_);
+            PL_ABORT("Failed to resize the file of the mapped statevector.");
+        }
+        void *data = ::mmap(nullptr, num_bytes_, PROT_READ | PROT_WRITE,
+                            MAP_SHARED, fd_, 0);
+        if (data == MAP_FAILED) {
+            ::close(fd_);
+            PL_ABORT("Failed to map the file of the mapped statevector.");
+        }
+        ::madvise(data, num_bytes_, MADV_SEQUENTIAL);
+        return static_cast<CFP_t *>(data);
+    }
+
+    /**
+     * @brief Get the number of bytes transferred at once by the checkpoints.
+     */
+    [[nodiscard]] auto getChunkBytes_() const -> size_t {
+        const size_t chunk_qubits = this->getCacheBlockQubits();
+        return (chunk_qubits == 0 || chunk_qubits >= this->getNumQubits())
+                   ? num_bytes_
+                   : Util::exp2(chunk_qubits) * sizeof(CFP_t);
+    }
+
+  public:
+    /**
+     * @brief Create a statevector in the state \f$|0\rangle\f$, stored in a
+     * new file. An existing file at `path` is overwritten.
+     *
+     * @param path Path of the file backing the amplitudes, preferably on a
+     * local SSD.
+     * @param num_qubits Number of qubits.
+     * @param chunk_qubits Number of qubits of the chunks streamed by
+     * `applyOperations`, chosen so that a chunk per thread fits in the main
+     * memory.
+     */
+    StateVectorMapped(std::string path, size_t num_qubits,
+                      size_t chunk_qubits = DEFAULT_CHUNK_QUBITS)
+        : StateVector<fp_t>(nullptr,
+                            static_cast<size_t>(Util::exp2(num_qubits))),
+          path_{std::move(path)}, num_bytes_{this->getLength() *
+                                             sizeof(CFP_t)} {
+        StateVector<fp_t>::setData(mapFile_());
+        this->getData()[0] = {1, 0};
+        this->setCacheBlockQubits(chunk_qubits);
+    }
+
+    StateVectorMapped(const StateVectorMapped &) = delete;
+    StateVectorMapped(StateVectorMapped &&) = delete;
+    auto operator=(const StateVectorMapped &) -> StateVectorMapped & = delete;
+    auto operator=(StateVectorMapped &&) -> StateVectorMapped & = delete;
+
+    /**
+     * @brief Unmap and close the file, which is kept on disk.
+     */
+    ~StateVectorMapped() {
+        ::munmap(this->getData(), num_bytes_);
+        ::close(fd_);
+    }
+
+    /**
+     * @brief Get the path of the file backing the amplitudes.
+     *
+     * @return const std::string&
+     */
+    [[nodiscard]] auto getPath() const -> const std::string & { return path_; }
+
+    /**
+     * @brief Write the modified amplitudes back to the file, returning once
+     * they are on disk.
+     */
+    void sync() {
+        PL_ABORT_IF(::msync(this->getData(), num_bytes_, MS_SYNC) != 0,
+                    "Failed to write the mapped statevector to disk.");
+    }
+
+    /**
+     * @brief Save the state to a checkpoint file, chunk by chunk.
+     *
+     * The checkpoint is written to `path` with a temporary suffix and renamed
+     * once complete, so that an interrupted checkpoint leaves the previous one
+     * at `path` intact.
+     *
+     * @param path Path of the checkpoint file.
+     */
+    void checkpoint(const std::string &path) const {
+        const std::string tmp_path = path + ".tmp";
+        {
+            std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+            PL_ABORT_IF_NOT(file, "Failed to create the checkpoint file.");
+            const std::array<uint64_t, 2> header{
+                sizeof(fp_t), static_cast<uint64_t>(this->getNumQubits())};
+            file.write(CHECKPOINT_MAGIC.data(), CHECKPOINT_MAGIC.size());
+            file.write(reinterpret_cast<const char *>(header.data()),
+                       sizeof(header));
+
+            const auto *data = reinterpret_cast<const char *>(this->getData());
+            const size_t chunk_bytes = getChunkBytes_();
+            for (size_t offset = 0; offset < num_bytes_ && file;
+                 offset += chunk_bytes) {
+                file.write(data + offset, static_cast<std::streamsize>(
+                                              std::min(chunk_bytes,
+                                                       num_bytes_ - offset)));
+            }
+            file.flush();
+            PL_ABORT_IF_NOT(file, "Failed to write the checkpoint file.");
+        }
+        PL_ABORT_IF(std::rename(tmp_path.c_str(), path.c_str()) != 0,
+                    "Failed to replace the checkpoint file.");
+    }
+
+    /**
+     * @brief Load the state saved by `checkpoint`, chunk by chunk.
+     *
+     * The header is checked before any amplitude is overwritten. A checkpoint
+     * file truncated after the header leaves the state partially restored.
+     *
+     * @param path Path of the checkpoint file, saved from a statevector of
+     * the same precision and number of qubits.
+     */
+    void restore(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+        PL_ABORT_IF_NOT(file, "Failed to open the checkpoint file.");
+        std::array<char, CHECKPOINT_MAGIC.size()> magic{};
+        std::array<uint64_t, 2> header{};
+        file.read(magic.data(), magic.size());
+        file.read(reinterpret_cast<char *>(header.data()), sizeof(header));
+        PL_ABORT_IF_NOT(file && magic == CHECKPOINT_MAGIC,
+                        "Invalid checkpoint file.");
+        PL_ABORT_IF_NOT(header[0] == sizeof(fp_t),
+                        "The checkpoint was saved with another precision.");
+        PL_ABORT_IF_NOT(header[1] == this->getNumQubits(),
+                        "The checkpoint was saved with another number of "
+                        "qubits.");
+
+        auto *data = reinterpret_cast<char *>(this->getData());
+        const size_t chunk_bytes = getChunkBytes_();
+        for (size_t offset = 0; offset < num_bytes_ && file;
+             offset += chunk_bytes) {
+            file.read(data + offset,
+                      static_cast<std::streamsize>(
+                          std::min(chunk_bytes, num_bytes_ - offset)));
+        }
+        PL_ABORT_IF_NOT(file, "The checkpoint file is truncated.");
+    }
+};
+
+} // namespace Pennylane
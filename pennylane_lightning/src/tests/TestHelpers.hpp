@@ -62,3 +62,31 @@ void scaleVector(std::vector<std::complex<Data_t>> &data,
         data.begin(), data.end(), data.begin(),
         [scalar](const std::complex<Data_t> &c) { return c * scalar; });
 }
+
+/**
+ * @brief Utility function to compare complex statevector data up to an
+ * absolute tolerance. Unlike `isApproxEqual`, this is robust to amplitudes
+ * close to zero.
+ *
+ * @tparam Data_t Floating point data-type.
+ * @param data1 StateVector data 1.
+ * @param data2 StateVector data 2.
+ * @param margin Maximum absolute difference of each amplitude.
+ * @return true Data are approximately equal.
+ * @return false Data are not approximately equal.
+ */
+template <class Data_t>
+inline bool isApproxEqualAbs(
+    const std::vector<Data_t> &data1, const std::vector<Data_t> &data2,
+    const typename Data_t::value_type margin =
+        std::numeric_limits<typename Data_t::value_type>::epsilon() * 100) {
+    if (data1.size() != data2.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < data1.size(); i++) {
+        if (std::abs(data1[i] - data2[i]) > margin) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -5,6 +5,7 @@
 #include <complex>
 #include <iostream>
 #include <limits>
+#include <numeric>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -360,3 +361,518 @@ TEST_CASE("AdjointJacobian::adjointJacobian Mixed Ops, Obs and TParams",
         CHECK(expected[2] == Approx(jacobian[0][2]));
     }
 }
+TEST_CASE("AdjointJacobian::adjointJacobian Observables in chunks",
+          "[AdjointJacobian]") {
+    AdjointJacobian<double> adj;
+    const size_t num_qubits = 3;
+    const std::vector<size_t> t_params{0, 1, 2, 3};
+
+    std::vector<std::complex<double>> cdata(Util::exp2(num_qubits));
+    cdata[0] = ONE<double>();
+    StateVector<double> psi(cdata.data(), cdata.size());
+
+    const std::vector<ObsDatum<double>> obs{
+        {{"PauliZ"}, {{}}, {{0}}},
+        {{"PauliX"}, {{}}, {{1}}},
+        {{"PauliZ", "PauliZ"}, {{}, {}}, {{1}, {2}}},
+        {{"PauliY"}, {{}}, {{2}}},
+        {{"PauliX", "PauliZ"}, {{}, {}}, {{0}, {2}}}};
+    const auto ops = adj.createOpsData(
+        {"RX", "RY", "CNOT", "RZ", "CRY", "Hadamard"},
+        {{0.4}, {-1.1}, {}, {0.7}, {0.25}, {}},
+        {{0}, {1}, {0, 1}, {2}, {1, 2}, {0}},
+        {false, false, false, false, false, false});
+
+    std::vector<std::vector<double>> expected(
+        obs.size(), std::vector<double>(t_params.size(), 0));
+    adj.adjointJacobian(psi.getData(), psi.getLength(), expected, obs, ops,
+                        t_params, true);
+
+    for (size_t max_obs_states : {1, 2, 5, 7}) {
+        std::vector<std::vector<double>> jacobian(
+            obs.size(), std::vector<double>(t_params.size(), 0));
+        adj.adjointJacobian(psi.getData(), psi.getLength(), jacobian, obs,
+                            ops, t_params, true, max_obs_states);
+        CAPTURE(max_obs_states);
+        for (size_t o = 0; o < obs.size(); o++) {
+            for (size_t p = 0; p < t_params.size(); p++) {
+                CHECK(jacobian[o][p] == Approx(expected[o][p]).margin(1e-12));
+            }
+        }
+    }
+
+    SECTION("Memory budget") {
+        const size_t state_bytes = 16 * Util::exp2(num_qubits);
+        CHECK(AdjointJacobian<double>::getMaxObsStates(num_qubits, 0) == 1);
+        CHECK(AdjointJacobian<double>::getMaxObsStates(
+                  num_qubits, 3 * state_bytes) == 1);
+        CHECK(AdjointJacobian<double>::getMaxObsStates(
+                  num_qubits, 6 * state_bytes + 1) == 4);
+    }
+}
+
+TEST_CASE("AdjointJacobian::adjointJacobianCheckpointed",
+          "[AdjointJacobian]") {
+    AdjointJacobian<double> adj;
+    const size_t num_qubits = 3;
+    // Non-trainable parametric operations lie within and between segments
+    const std::vector<size_t> t_params{0, 2, 3, 4, 6, 7};
+
+    std::vector<std::complex<double>> cdata(Util::exp2(num_qubits));
+    cdata[0] = ONE<double>();
+    StateVectorManaged<double> psi(cdata);
+
+    const std::vector<ObsDatum<double>> obs{
+        {{"PauliZ"}, {{}}, {{0}}},
+        {{"PauliX", "PauliZ"}, {{}, {}}, {{1}, {2}}},
+        {{"PauliY"}, {{}}, {{2}}}};
+    const auto ops = adj.createOpsData(
+        {"BasisState", "RX", "RY", "CNOT", "CRZ", "PhaseShift", "Hadamard",
+         "RX", "ControlledPhaseShift", "RZ", "CRX", "CNOT"},
+        {{1, 0, 0}, {0.4}, {-1.1}, {}, {0.7}, {0.25}, {}, {1.3}, {-0.6},
+         {0.9}, {-0.2}, {}},
+        {{0, 1, 2}, {0}, {1}, {0, 1}, {1, 2}, {2}, {0}, {1}, {0, 2}, {1},
+         {2, 0}, {1, 2}},
+        {false, false, false, false, true, false, false, false, false, true,
+         false, false});
+
+    std::vector<std::vector<double>> expected(
+        obs.size(), std::vector<double>(t_params.size(), 0));
+    adj.adjointJacobian(psi.getData(), psi.getLength(), expected, obs, ops,
+                        t_params, true);
+
+    StateVectorManaged<double> applied(psi);
+    for (size_t op_idx = 0; op_idx < ops.getSize(); op_idx++) {
+        if (!applyStatePreparation(applied, ops, op_idx)) {
+            applied.applyOperation(ops.getOpsName()[op_idx],
+                                   ops.getOpsWires()[op_idx],
+                                   ops.getOpsInverses()[op_idx],
+                                   ops.getOpsParams()[op_idx]);
+        }
+    }
+
+    for (const size_t num_segments : {0, 1, 2, 4, 6, 20}) {
+        for (const bool apply_operations : {true, false}) {
+            CAPTURE(num_segments, apply_operations);
+            std::vector<std::vector<double>> jacobian(
+                obs.size(), std::vector<double>(t_params.size(), 0));
+            const auto &initial = apply_operations ? psi : applied;
+            adj.adjointJacobianCheckpointed(
+                initial.getData(), initial.getLength(), jacobian, obs, ops,
+                t_params, apply_operations, num_segments);
+            for (size_t o = 0; o < obs.size(); o++) {
+                for (size_t p = 0; p < t_params.size(); p++) {
+                    CHECK(jacobian[o][p] ==
+                          Approx(expected[o][p]).margin(1e-12));
+                }
+            }
+        }
+    }
+
+    SECTION("Memory budget") {
+        const size_t state_bytes = 16 * Util::exp2(num_qubits);
+        const size_t max_threads = Util::getMaxNumThreads();
+        using Adj = AdjointJacobian<double>;
+        CHECK(Adj::getMaxCheckpointSegments(num_qubits, 1, 0) == 1);
+        CHECK(Adj::getMaxCheckpointSegments(num_qubits, 1,
+                                            6 * state_bytes) == 1);
+        CHECK(Adj::getMaxCheckpointSegments(num_qubits, 2,
+                                            16 * state_bytes + 1) ==
+              std::min<size_t>(3, max_threads));
+        CHECK(Adj::getMaxCheckpointSegments(num_qubits, 1, 1UL << 40U) ==
+              max_threads);
+    }
+}
+
+TEST_CASE("AdjointJacobian::adjointJacobian Native state preparation",
+          "[AdjointJacobian]") {
+    AdjointJacobian<double> adj;
+    const size_t num_qubits = 3;
+    const std::vector<size_t> t_params{0, 1, 2};
+    const std::vector<ObsDatum<double>> obs{
+        {{"PauliZ"}, {{}}, {{0}}},
+        {{"PauliX", "PauliZ"}, {{}, {}}, {{1}, {2}}}};
+
+    const std::vector<std::string> gate_names{"RX", "CRY", "RZ", "CNOT"};
+    const std::vector<std::vector<double>> gate_params{
+        {0.4}, {-1.1}, {0.7}, {}};
+    const std::vector<std::vector<size_t>> gate_wires{
+        {0}, {0, 1}, {2}, {1, 2}};
+    const auto jacobian_from = [&](const StateVectorManaged<double> &psi,
+                                   const OpsData<double> &ops) {
+        std::vector<std::vector<double>> jac(
+            obs.size(), std::vector<double>(t_params.size(), 0));
+        adj.adjointJacobian(psi.getData(), psi.getLength(), jac, obs, ops,
+                            t_params, true);
+        return jac;
+    };
+    const auto with_prep = [&](const std::string &name,
+                               const std::vector<double> &params,
+                               const std::vector<size_t> &wires,
+                               const std::vector<std::complex<double>> &mat) {
+        std::vector<std::string> names{name};
+        std::vector<std::vector<double>> all_params{params};
+        std::vector<std::vector<size_t>> all_wires{wires};
+        std::vector<std::vector<std::complex<double>>> mats{mat};
+        names.insert(names.end(), gate_names.begin(), gate_names.end());
+        all_params.insert(all_params.end(), gate_params.begin(),
+                          gate_params.end());
+        all_wires.insert(all_wires.end(), gate_wires.begin(),
+                         gate_wires.end());
+        mats.resize(names.size());
+        return OpsData<double>(names, all_params, all_wires,
+                               std::vector<bool>(names.size(), false), mats);
+    };
+    const OpsData<double> gates(gate_names, gate_params, gate_wires,
+                                std::vector<bool>(gate_names.size(), false));
+
+    SECTION("BasisState") {
+        const auto ops = with_prep("BasisState", {1, 0}, {2, 0}, {});
+        CHECK(ops.getNumParOps() == 3);
+        StateVectorManaged<double> prepared(num_qubits);
+        prepared.applyOperation("PauliX", {2});
+        const auto expected = jacobian_from(prepared, gates);
+        // The operations are applied to an arbitrary initial state
+        StateVectorManaged<double> psi(num_qubits);
+        psi.applyOperation("Hadamard", {1});
+        const auto jacobian = jacobian_from(psi, ops);
+        for (size_t o = 0; o < obs.size(); o++) {
+            for (size_t p = 0; p < t_params.size(); p++) {
+                CHECK(jacobian[o][p] == Approx(expected[o][p]).margin(1e-12));
+            }
+        }
+    }
+    SECTION("QubitStateVector") {
+        const double inv_sqrt2 = 1 / std::sqrt(2.0);
+        const auto ops =
+            with_prep("QubitStateVector", {}, {1, 2},
+                      {{0, inv_sqrt2}, {0, 0}, {0, 0}, {inv_sqrt2, 0}});
+        CHECK(ops.getNumParOps() == 3);
+        std::vector<std::complex<double>> prepared_data(
+            Util::exp2(num_qubits));
+        prepared_data[0] = {0, inv_sqrt2};
+        prepared_data[3] = {inv_sqrt2, 0};
+        const StateVectorManaged<double> prepared(prepared_data);
+        const auto expected = jacobian_from(prepared, gates);
+        const auto jacobian =
+            jacobian_from(StateVectorManaged<double>(num_qubits), ops);
+        for (size_t o = 0; o < obs.size(); o++) {
+            for (size_t p = 0; p < t_params.size(); p++) {
+                CHECK(jacobian[o][p] == Approx(expected[o][p]).margin(1e-12));
+            }
+        }
+    }
+}
+
+TEST_CASE("AdjointJacobian::adjointJacobian Native Rot and CRot",
+          "[AdjointJacobian]") {
+    AdjointJacobian<double> adj;
+    const size_t num_qubits = 3;
+    const std::vector<ObsDatum<double>> obs{
+        {{"PauliZ"}, {{}}, {{0}}},
+        {{"PauliX", "PauliZ"}, {{}, {}}, {{1}, {2}}},
+        {{"PauliY"}, {{}}, {{2}}}};
+
+    StateVectorManaged<double> psi(num_qubits);
+    for (size_t wire = 0; wire < num_qubits; wire++) {
+        psi.applyOperation("Hadamard", {wire});
+    }
+
+    // The adjoint gates apply the inverted factors in reverse order
+    const auto ops = adj.createOpsData(
+        {"RX", "Rot", "CNOT", "CRot", "Rot", "CRY"},
+        {{0.3}, {0.4, -1.2, 0.8}, {}, {-0.5, 0.9, 1.7}, {1.1, 0.2, -0.6},
+         {0.45}},
+        {{0}, {1}, {1, 2}, {2, 0}, {0}, {1, 2}},
+        {false, false, false, true, true, false});
+    const auto decomposed = adj.createOpsData(
+        {"RX", "RZ", "RY", "RZ", "CNOT", "CRZ", "CRY", "CRZ", "RZ", "RY",
+         "RZ", "CRY"},
+        {{0.3}, {0.4}, {-1.2}, {0.8}, {}, {1.7}, {0.9}, {-0.5}, {-0.6},
+         {0.2}, {1.1}, {0.45}},
+        {{0}, {1}, {1}, {1}, {1, 2}, {2, 0}, {2, 0}, {2, 0}, {0}, {0}, {0},
+         {1, 2}},
+        {false, false, false, false, false, true, true, true, true, true,
+         true, false});
+    // Parameter of the decomposition matching each gate parameter
+    const std::vector<size_t> decomposed_param{0, 1, 2, 3, 6, 5,
+                                               4, 9, 8, 7, 10};
+    CHECK(ops.getNumParOps() == 5);
+    CHECK(ops.getNumParams() == 11);
+
+    std::vector<size_t> all_params(decomposed_param.size());
+    std::iota(all_params.begin(), all_params.end(), 0);
+    std::vector<std::vector<double>> expected(
+        obs.size(), std::vector<double>(all_params.size(), 0));
+    adj.adjointJacobian(psi.getData(), psi.getLength(), expected, obs,
+                        decomposed, all_params, true);
+
+    // Single trainable parameters of a gate and parameters of the same gate
+    // that cannot be chained
+    for (const auto &t_params : std::vector<std::vector<size_t>>{
+             all_params, {0, 2, 3, 4, 6, 8, 9, 10}, {2, 5, 7, 9}}) {
+        CAPTURE(t_params);
+        const auto check_jacobian =
+            [&](const std::vector<std::vector<double>> &jacobian) {
+                for (size_t o = 0; o < obs.size(); o++) {
+                    for (size_t p = 0; p < t_params.size(); p++) {
+                        CAPTURE(o, p);
+                        CHECK(jacobian[o][p] ==
+                              Approx(expected[o][decomposed_param[t_params[p]]])
+                                  .margin(1e-12));
+                    }
+                }
+            };
+        std::vector<std::vector<double>> jacobian(
+            obs.size(), std::vector<double>(t_params.size(), 0));
+        adj.adjointJacobian(psi.getData(), psi.getLength(), jacobian, obs, ops,
+                            t_params, true);
+        check_jacobian(jacobian);
+        for (const size_t num_segments : {1, 3}) {
+            CAPTURE(num_segments);
+            std::vector<std::vector<double>> checkpointed(
+                obs.size(), std::vector<double>(t_params.size(), 0));
+            adj.adjointJacobianCheckpointed(psi.getData(), psi.getLength(),
+                                            checkpointed, obs, ops, t_params,
+                                            true, num_segments);
+            check_jacobian(checkpointed);
+        }
+    }
+}
+
+TEST_CASE("AdjointJacobian::registerGenerator", "[AdjointJacobian]") {
+    AdjointJacobian<double> adj;
+    const size_t num_qubits = 2;
+    const std::vector<ObsDatum<double>> obs{
+        {{"PauliZ"}, {{}}, {{0}}},
+        {{"PauliY", "PauliX"}, {{}, {}}, {{0}, {1}}}};
+    const std::vector<size_t> t_params{0, 1};
+
+    // IsingXX(phi) = exp(-i phi / 2 X \otimes X), given as a matrix
+    const double phi = 0.7;
+    const std::complex<double> c{std::cos(phi / 2), 0};
+    const std::complex<double> s{0, -std::sin(phi / 2)};
+    const std::vector<std::complex<double>> ising_xx{
+        c, {0, 0}, {0, 0}, s, {0, 0}, c, s, {0, 0},
+        {0, 0}, s, c, {0, 0}, s, {0, 0}, {0, 0}, c};
+    const std::vector<std::complex<double>> x_x{
+        {0, 0}, {0, 0}, {0, 0}, {1, 0}, {0, 0}, {0, 0}, {1, 0}, {0, 0},
+        {0, 0}, {1, 0}, {0, 0}, {0, 0}, {1, 0}, {0, 0}, {0, 0}, {0, 0}};
+
+    StateVectorManaged<double> psi(num_qubits);
+    psi.applyOperation("Hadamard", {0});
+    psi.applyOperation("RY", {1}, false, {0.3});
+
+    for (const bool inverse : {false, true}) {
+        CAPTURE(inverse);
+        const auto ops = adj.createOpsData(
+            {"IsingXX", "RY"}, {{phi}, {-0.4}}, {{0, 1}, {1}},
+            {inverse, false}, {ising_xx, {}});
+        const auto decomposed = adj.createOpsData(
+            {"CNOT", "RX", "CNOT", "RY"}, {{}, {phi}, {}, {-0.4}},
+            {{0, 1}, {0}, {0, 1}, {1}}, {false, inverse, false, false});
+
+        std::vector<std::vector<double>> expected(
+            obs.size(), std::vector<double>(t_params.size(), 0));
+        adj.adjointJacobian(psi.getData(), psi.getLength(), expected, obs,
+                            decomposed, t_params, true);
+
+        std::vector<std::vector<double>> jacobian(
+            obs.size(), std::vector<double>(t_params.size(), 0));
+        if (!adj.hasGenerator("IsingXX")) {
+            CHECK_THROWS_AS(adj.adjointJacobian(psi.getData(),
+                                                psi.getLength(), jacobian, obs,
+                                                ops, t_params, true),
+                            Util::LightningException);
+            adj.registerGenerator("IsingXX", x_x, -0.5);
+        }
+        adj.adjointJacobian(psi.getData(), psi.getLength(), jacobian, obs, ops,
+                            t_params, true);
+        for (size_t o = 0; o < obs.size(); o++) {
+            for (size_t p = 0; p < t_params.size(); p++) {
+                CHECK(jacobian[o][p] == Approx(expected[o][p]).margin(1e-12));
+            }
+        }
+    }
+
+    CHECK(adj.hasGenerator("CRot"));
+    CHECK_THROWS_AS(adj.registerGenerator("IsingXX", {{1, 0}, {0, 0}}, 1),
+                    Util::LightningException);
+    CHECK_THROWS_AS(adj.registerGenerator("Rot", x_x, 1),
+                    Util::LightningException);
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointVJP", "[AdjointJacobian]", float,
+                   double) {
+    AdjointJacobian<TestType> adj;
+    const size_t num_qubits = 3;
+    const std::vector<ObsDatum<TestType>> obs{
+        {{"PauliZ"}, {{}}, {{0}}},
+        {{"PauliX", "PauliY"}, {{}, {}}, {{1}, {2}}},
+        {{"PauliZ"}, {{}}, {{2}}}};
+    const auto ops = adj.createOpsData(
+        {"RX", "CNOT", "Rot", "CRY", "RZ"},
+        {{0.4}, {}, {0.3, -0.9, 1.4}, {0.7}, {-0.2}},
+        {{0}, {0, 1}, {1}, {1, 2}, {2}}, {false, false, true, false, false});
+    const std::vector<size_t> t_params{0, 2, 3, 4, 5};
+    const std::vector<TestType> dy{0.5, -1.5, 0};
+
+    StateVectorManaged<TestType> psi(num_qubits);
+    for (size_t wire = 0; wire < num_qubits; wire++) {
+        psi.applyOperation("Hadamard", {wire});
+    }
+
+    std::vector<std::vector<TestType>> jacobian(
+        obs.size(), std::vector<TestType>(t_params.size(), 0));
+    adj.adjointJacobian(psi.getData(), psi.getLength(), jacobian, obs, ops,
+                        t_params, true);
+
+    std::vector<TestType> vjp(t_params.size(), 0);
+    adj.adjointVJP(psi.getData(), psi.getLength(), vjp, dy, obs, ops, t_params,
+                   true);
+    REQUIRE(vjp.size() == t_params.size());
+    for (size_t p = 0; p < t_params.size(); p++) {
+        TestType expected = 0;
+        for (size_t o = 0; o < obs.size(); o++) {
+            expected += dy[o] * jacobian[o][p];
+        }
+        CAPTURE(p);
+        CHECK(vjp[p] == Approx(expected).margin(1e-5));
+    }
+
+    std::vector<TestType> wrong_dy{1, 1};
+    CHECK_THROWS_AS(adj.adjointVJP(psi.getData(), psi.getLength(), vjp,
+                                   wrong_dy, obs, ops, t_params, true),
+                    Util::LightningException);
+}
+
+TEST_CASE("OpsData::updateParams", "[AdjointJacobian]") {
+    AdjointJacobian<double> adj;
+    const size_t num_qubits = 2;
+    const std::vector<ObsDatum<double>> obs{{{"PauliZ"}, {{}}, {{0}}},
+                                            {{"PauliY"}, {{}}, {{1}}}};
+    const std::vector<size_t> t_params{0, 1, 2, 3};
+
+    // IsingXX given as a matrix, with its parameter
+    const auto ising_xx = [](double phi) {
+        const std::complex<double> c{std::cos(phi / 2), 0};
+        const std::complex<double> s{0, -std::sin(phi / 2)};
+        return std::vector<std::complex<double>>{
+            c, {0, 0}, {0, 0}, s, {0, 0}, c, s, {0, 0},
+            {0, 0}, s, c, {0, 0}, s, {0, 0}, {0, 0}, c};
+    };
+    adj.registerGenerator(
+        "IsingXX",
+        std::vector<std::complex<double>>{{0, 0}, {0, 0}, {0, 0}, {1, 0},
+                                          {0, 0}, {0, 0}, {1, 0}, {0, 0},
+                                          {0, 0}, {1, 0}, {0, 0}, {0, 0},
+                                          {1, 0}, {0, 0}, {0, 0}, {0, 0}},
+        -0.5);
+
+    const auto create_ops = [&](double a, double b, double c, double d) {
+        return adj.createOpsData({"BasisState", "RX", "CNOT", "IsingXX", "Rot"},
+                                 {{1, 0}, {a}, {}, {b}, {c, d, 0.3}},
+                                 {{0, 1}, {0}, {0, 1}, {0, 1}, {1}},
+                                 {false, false, false, false, false},
+                                 {{}, {}, {}, ising_xx(b), {}});
+    };
+    auto ops = create_ops(0.1, 0.2, 0.3, 0.4);
+    CHECK(ops.getOpsGates()[1] == GateOperation::RX);
+    CHECK(ops.getOpsGates()[3] == GateOperation::NumGates);
+    CHECK(ops.getNumParams() == 5);
+
+    ops.updateParams({-0.7, 1.1, 0.5, -0.2, 0.3},
+                     {{}, {}, {}, ising_xx(1.1), {}});
+    const auto expected_ops = create_ops(-0.7, 1.1, 0.5, -0.2);
+    CHECK(ops.getOpsParams() == expected_ops.getOpsParams());
+    CHECK(ops.getOpsParams()[0] == std::vector<double>{1, 0});
+
+    const StateVectorManaged<double> psi(num_qubits);
+    std::vector<std::vector<double>> jacobian(
+        obs.size(), std::vector<double>(t_params.size(), 0));
+    std::vector<std::vector<double>> expected(
+        obs.size(), std::vector<double>(t_params.size(), 0));
+    adj.adjointJacobian(psi.getData(), psi.getLength(), jacobian, obs, ops,
+                        t_params, true);
+    adj.adjointJacobian(psi.getData(), psi.getLength(), expected, obs,
+                        expected_ops, t_params, true);
+    for (size_t o = 0; o < obs.size(); o++) {
+        for (size_t p = 0; p < t_params.size(); p++) {
+            CHECK(jacobian[o][p] == Approx(expected[o][p]).margin(1e-12));
+        }
+    }
+
+    CHECK_THROWS_AS(ops.updateParams({0.1, 0.2}), Util::LightningException);
+    CHECK_THROWS_AS(ops.updateParams({0.1, 0.2, 0.3, 0.4, 0.5}, {{}, {}}),
+                    Util::LightningException);
+    CHECK_THROWS_AS(ops.updateParams({0.1, 0.2, 0.3, 0.4, 0.5},
+                                     {{}, {}, {}, {{1, 0}}, {}}),
+                    Util::LightningException);
+}
+
+TEST_CASE("AdjointJacobian::adjointJacobian Hermitian and sparse observables",
+          "[AdjointJacobian]") {
+    AdjointJacobian<double> adj;
+    const size_t num_qubits = 3;
+    const size_t dim = Util::exp2(num_qubits);
+    using cdouble = std::complex<double>;
+
+    // Dense Hermitian matrix over all qubits and its CSR form
+    std::vector<cdouble> dense(dim * dim);
+    for (size_t i = 0; i < dim; i++) {
+        dense[i * dim + i] = {0.25 * i - 0.5, 0};
+        for (size_t j = i + 1; j < dim; j++) {
+            if ((i + 2 * j) % 3 == 0) {
+                dense[i * dim + j] = {0.1 * j, 0.3 - 0.2 * i};
+                dense[j * dim + i] = std::conj(dense[i * dim + j]);
+            }
+        }
+    }
+    std::vector<cdouble> data;
+    std::vector<size_t> indices;
+    std::vector<size_t> indptr{0};
+    for (size_t i = 0; i < dim; i++) {
+        for (size_t j = 0; j < dim; j++) {
+            if (dense[i * dim + j] != cdouble{0, 0}) {
+                data.push_back(dense[i * dim + j]);
+                indices.push_back(j);
+            }
+        }
+        indptr.push_back(data.size());
+    }
+    const auto sparse = std::make_shared<const SparseHamiltonian<double>>(
+        data, indices, indptr);
+    // X on wire 1 and Z on wire 2 as a Hermitian matrix
+    const std::vector<cdouble> x_z{{0, 0},  {0, 0}, {1, 0}, {0, 0},
+                                   {0, 0},  {0, 0}, {0, 0}, {-1, 0},
+                                   {1, 0},  {0, 0}, {0, 0}, {0, 0},
+                                   {0, 0}, {-1, 0}, {0, 0}, {0, 0}};
+
+    const std::vector<ObsDatum<double>> obs{
+        {{"Hermitian"}, {dense}, {{0, 1, 2}}},
+        {{"SparseHamiltonian"}, {sparse}, {{0, 1, 2}}},
+        {{"Hermitian"}, {x_z}, {{1, 2}}},
+        {{"PauliX", "PauliZ"}, {{}, {}}, {{1}, {2}}}};
+
+    StateVectorManaged<double> psi(num_qubits);
+    const auto ops = adj.createOpsData(
+        {"RX", "RY", "CNOT", "RZ", "CRY", "RX"},
+        {{0.3}, {-0.7}, {}, {1.1}, {0.45}, {0.9}},
+        {{0}, {1}, {0, 2}, {2}, {1, 2}, {1}},
+        {false, false, false, false, true, false});
+    std::vector<size_t> t_params{0, 1, 2, 3, 4};
+    std::vector<std::vector<double>> jacobian(
+        obs.size(), std::vector<double>(t_params.size(), 0));
+    adj.adjointJacobian(psi.getData(), psi.getLength(), jacobian, obs, ops,
+                        t_params, true);
+
+    // Sparse and dense forms of the same matrix, and a Hermitian matrix and
+    // the same Pauli word, have the same gradients
+    for (size_t p = 0; p < t_params.size(); p++) {
+        CAPTURE(p);
+        CHECK(jacobian[1][p] == Approx(jacobian[0][p]).margin(1e-12));
+        CHECK(jacobian[2][p] == Approx(jacobian[3][p]).margin(1e-12));
+    }
+    CHECK(std::any_of(jacobian[0].begin(), jacobian[0].end(),
+                      [](double g) { return std::abs(g) > 1e-3; }));
+}
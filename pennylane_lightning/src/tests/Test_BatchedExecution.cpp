@@ -0,0 +1,148 @@
+#include <complex>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "AdjointDiff.hpp"
+#include "BatchedExecution.hpp"
+#include "Gates.hpp"
+#include "StateVectorManaged.hpp"
+#include "Util.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+TEMPLATE_TEST_CASE("BatchedExecutor::BatchedExecutor", "[BatchedExecutor]",
+                   float, double) {
+    SECTION("BatchedExecutor") {
+        REQUIRE(std::is_constructible<BatchedExecutor<>>::value);
+    }
+    SECTION("BatchedExecutor<TestType> {}") {
+        REQUIRE(std::is_constructible<BatchedExecutor<TestType>>::value);
+    }
+}
+
+TEMPLATE_TEST_CASE("BatchedExecutor::executeStates", "[BatchedExecutor]",
+                   float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 3;
+    BatchedExecutor<TestType> executor;
+
+    // The Hadamard on wire 1 is given as a matrix and takes no batch values
+    const OpsData<TestType> ops{
+        {"RX", "CNOT", "QubitUnitary", "CRot", "RZ"},
+        {{0.1}, {}, {}, {0.2, 0.3, 0.4}, {0.5}},
+        {{0}, {0, 1}, {1}, {1, 2}, {2}},
+        {false, false, false, false, true},
+        {{}, {}, Gates::getHadamard<TestType>(), {}, {}}};
+    const std::vector<std::vector<TestType>> param_batch{
+        {0.312, -1.27, 0.85, 0.66, -0.2},
+        {2.1, 0.0, -0.9, 1.4, 0.7},
+        {-0.4, 0.3, 0.2, 0.1, 3.0}};
+
+    REQUIRE(BatchedExecutor<TestType>::getNumBatchParams(ops) == 5);
+
+    StateVectorManaged<TestType> init_sv(num_qubits);
+    init_sv.applyOperation("Hadamard", {2}, false);
+    const auto states = executor.executeStates(
+        init_sv.getData(), init_sv.getLength(), ops, param_batch);
+
+    REQUIRE(states.size() == param_batch.size());
+    for (size_t b = 0; b < param_batch.size(); b++) {
+        const auto &p = param_batch[b];
+        StateVectorManaged<TestType> sv{init_sv};
+        sv.applyOperation("RX", {0}, false, {p[0]});
+        sv.applyOperation("CNOT", {0, 1}, false);
+        sv.applyOperation("Hadamard", {1}, false);
+        sv.applyOperation("CRot", {1, 2}, false, {p[1], p[2], p[3]});
+        sv.applyOperation("RZ", {2}, true, {p[4]});
+
+        CAPTURE(b);
+        CHECK(isApproxEqualAbs(states[b], sv.getDataVector()));
+        CHECK(states[b] != std::vector<cp_t>(init_sv.getDataVector()));
+    }
+
+    SECTION("Empty batch") {
+        REQUIRE(executor
+                    .executeStates(init_sv.getData(), init_sv.getLength(), ops,
+                                   {})
+                    .empty());
+    }
+
+    SECTION("Invalid parameter set") {
+        REQUIRE_THROWS_AS(executor.executeStates(init_sv.getData(),
+                                                 init_sv.getLength(), ops,
+                                                 {{0.1, 0.2}}),
+                          Util::LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("BatchedExecutor::executeExpval", "[BatchedExecutor]",
+                   float, double) {
+    const size_t num_qubits = 2;
+    BatchedExecutor<TestType> executor;
+
+    const OpsData<TestType> ops{{"RX", "RY", "CNOT"},
+                                {{0.0}, {0.0}, {}},
+                                {{0}, {1}, {0, 1}},
+                                {false, false, false}};
+    const std::vector<ObsDatum<TestType>> observables{
+        {{"PauliZ"}, {{}}, {{0}}},
+        {{"PauliZ"}, {{}}, {{1}}},
+        {{"PauliZ", "PauliX"}, {{}, {}}, {{0}, {1}}}};
+
+    std::vector<std::vector<TestType>> param_batch;
+    for (size_t b = 0; b < 16; b++) {
+        param_batch.push_back({static_cast<TestType>(0.4 * b - 3.0),
+                               static_cast<TestType>(1.1 - 0.3 * b)});
+    }
+
+    StateVectorManaged<TestType> init_sv(num_qubits);
+    const auto expvals = executor.executeExpval(
+        init_sv.getData(), init_sv.getLength(), observables, ops, param_batch);
+
+    REQUIRE(expvals.size() == param_batch.size());
+    for (size_t b = 0; b < param_batch.size(); b++) {
+        const TestType x = param_batch[b][0];
+        const TestType y = param_batch[b][1];
+        CAPTURE(b);
+        REQUIRE(expvals[b].size() == observables.size());
+        // CNOT maps Z1 to Z0 Z1 and leaves Z0 and X1 unchanged
+        CHECK(expvals[b][0] == Approx(std::cos(x)).margin(1e-5));
+        CHECK(expvals[b][1] == Approx(std::cos(x) * std::cos(y)).margin(1e-5));
+        CHECK(expvals[b][2] == Approx(std::cos(x) * std::sin(y)).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("BatchedExecutor with state preparation",
+                   "[BatchedExecutor]", float, double) {
+    const size_t num_qubits = 2;
+    BatchedExecutor<TestType> executor;
+
+    // BasisState |10> then RX on wire 1: only the RX angle is batched
+    const OpsData<TestType> ops{{"BasisState", "RX"},
+                                {{1, 0}, {0.0}},
+                                {{0, 1}, {1}},
+                                {false, false},
+                                {{}, {}}};
+    REQUIRE(BatchedExecutor<TestType>::getNumBatchParams(ops) == 1);
+
+    const std::vector<std::vector<TestType>> param_batch{{0.3}, {-1.2}};
+    // The state preparation overwrites the initial state
+    StateVectorManaged<TestType> init_sv(num_qubits);
+    init_sv.applyOperation("Hadamard", {0});
+    const auto states = executor.executeStates(
+        init_sv.getData(), init_sv.getLength(), ops, param_batch);
+
+    REQUIRE(states.size() == param_batch.size());
+    for (size_t b = 0; b < param_batch.size(); b++) {
+        const TestType half = param_batch[b][0] / 2;
+        const std::vector<std::complex<TestType>> expected{
+            {0, 0}, {0, 0}, {std::cos(half), 0}, {0, -std::sin(half)}};
+        CAPTURE(b);
+        CHECK(isApproxEqualAbs(states[b], expected,
+                               static_cast<TestType>(1e-6)));
+    }
+}
@@ -0,0 +1,250 @@
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "Observables.hpp"
+#include "StateVectorManaged.hpp"
+#include "Util.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+namespace {
+/**
+ * @brief Normalized statevector with all amplitudes distinct and non-zero.
+ */
+template <class T>
+auto createTestState(size_t num_qubits) -> StateVectorManaged<T> {
+    std::vector<std::complex<T>> data(Util::exp2(num_qubits));
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = {static_cast<T>(std::cos(0.7 * i + 0.1)),
+                   static_cast<T>(std::sin(0.3 * i - 0.4))};
+    }
+    const T norm = std::sqrt(std::real(Util::innerProdC(data, data)));
+    for (auto &d : data) {
+        d /= norm;
+    }
+    return {data};
+}
+
+/**
+ * @brief Apply the factors of a Pauli word as gates.
+ */
+template <class T>
+void applyPauliGates(StateVectorManaged<T> &sv,
+                     const std::vector<std::string> &paulis,
+                     const std::vector<size_t> &wires) {
+    for (size_t i = 0; i < paulis.size(); i++) {
+        if (paulis[i] != "Identity") {
+            sv.applyOperation(paulis[i], {wires[i]}, false);
+        }
+    }
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("Observables::PauliWord", "[Observables]", float,
+                   double) {
+    const size_t num_qubits = 4;
+
+    SECTION("Bit masks") {
+        const PauliWord word({"PauliX", "PauliY", "Identity", "PauliZ"},
+                             {0, 1, 2, 3}, num_qubits);
+        CHECK(word.getXMask() == 0b1100);
+        CHECK(word.getZMask() == 0b0101);
+        CHECK(word.getNumY() == 1);
+    }
+    SECTION("Invalid words") {
+        using Util::LightningException;
+        CHECK_THROWS_AS(PauliWord({"PauliX"}, {0, 1}, num_qubits),
+                        LightningException);
+        CHECK_THROWS_AS(PauliWord({"PauliX"}, {4}, num_qubits),
+                        LightningException);
+        CHECK_THROWS_AS(PauliWord({"PauliX", "PauliZ"}, {1, 1}, num_qubits),
+                        LightningException);
+        CHECK_THROWS_AS(PauliWord({"Hadamard"}, {0}, num_qubits),
+                        LightningException);
+        CHECK_THROWS_AS(Hamiltonian<TestType>({1, 2}, {PauliWord({}, {}, 1)}),
+                        LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("Observables::expval and var", "[Observables]", float,
+                   double) {
+    const size_t num_qubits = 5;
+    const auto sv = createTestState<TestType>(num_qubits);
+
+    // Pauli factors and wires of each term
+    const std::vector<std::pair<std::vector<std::string>, std::vector<size_t>>>
+        terms{{{"Identity"}, {2}},
+              {{"PauliZ"}, {0}},
+              {{"PauliX"}, {3}},
+              {{"PauliY"}, {4}},
+              {{"PauliZ", "PauliZ"}, {1, 4}},
+              {{"PauliX", "PauliZ"}, {3, 0}},
+              {{"PauliY", "PauliZ"}, {2, 3}},
+              {{"PauliY", "PauliY"}, {0, 4}},
+              {{"PauliX", "PauliY", "PauliZ"}, {1, 2, 0}},
+              {{"PauliY", "PauliY", "PauliY"}, {1, 3, 4}},
+              {{"PauliX", "PauliX", "PauliZ"}, {4, 2, 3}}};
+    const std::vector<TestType> coeffs{0.4,  -1.2, 0.7, 0.35, 2.0, -0.6,
+                                       0.25, 1.1,  0.9, -0.3, 0.15};
+
+    std::vector<PauliWord> words;
+    std::vector<StateVectorManaged<TestType>> p_psi;
+    for (const auto &[paulis, wires] : terms) {
+        words.emplace_back(paulis, wires, num_qubits);
+        p_psi.emplace_back(sv);
+        applyPauliGates(p_psi.back(), paulis, wires);
+    }
+
+    SECTION("Pauli words") {
+        for (size_t t = 0; t < terms.size(); t++) {
+            const TestType expected = std::real(
+                Util::innerProdC(sv.getDataVector(), p_psi[t].getDataVector()));
+            CAPTURE(t);
+            CHECK(expval(sv, words[t]) == Approx(expected).margin(1e-5));
+            CHECK(var(sv, words[t]) ==
+                  Approx(1 - expected * expected).margin(1e-5));
+        }
+    }
+
+    SECTION("Hamiltonian") {
+        std::vector<std::complex<TestType>> h_psi(sv.getLength());
+        for (size_t t = 0; t < terms.size(); t++) {
+            for (size_t j = 0; j < h_psi.size(); j++) {
+                h_psi[j] += coeffs[t] * p_psi[t].getDataVector()[j];
+            }
+        }
+        const TestType mean =
+            std::real(Util::innerProdC(sv.getDataVector(), h_psi));
+        const TestType mean_sq = std::real(Util::innerProdC(h_psi, h_psi));
+
+        const Hamiltonian<TestType> ham{coeffs, words};
+        CHECK(expval(sv, ham) == Approx(mean).margin(1e-5));
+        CHECK(var(sv, ham) == Approx(mean_sq - mean * mean).margin(1e-4));
+    }
+
+    SECTION("Parallel reductions") {
+        auto sv_parallel{sv};
+        sv_parallel.setNumThreads(4);
+        sv_parallel.setParallelThreshold(1);
+        const Hamiltonian<TestType> ham{coeffs, words};
+        CHECK(expval(sv_parallel, ham) == Approx(expval(sv, ham)).margin(1e-5));
+        CHECK(var(sv_parallel, ham) == Approx(var(sv, ham)).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("Observables::SparseHamiltonian", "[Observables]", float,
+                   double) {
+    const size_t num_qubits = 4;
+    const size_t dim = Util::exp2(num_qubits);
+    auto sv = createTestState<TestType>(num_qubits);
+
+    // Hermitian matrix with a varying number of entries per row
+    std::vector<std::complex<TestType>> dense(dim * dim);
+    for (size_t i = 0; i < dim; i++) {
+        dense[i * dim + i] = {static_cast<TestType>(0.1 * i), 0};
+        for (size_t j = i + 1; j < dim; j += 1 + (i % 3)) {
+            if ((i * j) % 5 == 1) {
+                dense[i * dim + j] = {static_cast<TestType>(0.3 + 0.01 * j),
+                                      static_cast<TestType>(-0.2 * i)};
+                dense[j * dim + i] = std::conj(dense[i * dim + j]);
+            }
+        }
+    }
+    std::vector<std::complex<TestType>> data;
+    std::vector<size_t> indices;
+    std::vector<size_t> indptr{0};
+    for (size_t i = 0; i < dim; i++) {
+        for (size_t j = 0; j < dim; j++) {
+            if (dense[i * dim + j] != std::complex<TestType>{0, 0}) {
+                data.push_back(dense[i * dim + j]);
+                indices.push_back(j);
+            }
+        }
+        indptr.push_back(data.size());
+    }
+    const SparseHamiltonian<TestType> ham{data, indices, indptr};
+    CHECK(ham.getNumQubits() == num_qubits);
+
+    const auto h_psi = Util::matrixVecProd(
+        dense, std::vector<std::complex<TestType>>{sv.getDataVector().begin(),
+                                                  sv.getDataVector().end()},
+        dim, dim);
+    const TestType mean =
+        std::real(Util::innerProdC(sv.getDataVector(), h_psi));
+    const TestType mean_sq = std::real(Util::innerProdC(h_psi, h_psi));
+
+    SECTION("applySparseHamiltonian") {
+        std::vector<std::complex<TestType>> out(dim);
+        applySparseHamiltonian(sv, ham, out.data());
+        CHECK(isApproxEqual(out, h_psi, 1e-4));
+    }
+    SECTION("expval and var") {
+        CHECK(expval(sv, ham) == Approx(mean).margin(1e-5));
+        CHECK(var(sv, ham) == Approx(mean_sq - mean * mean).margin(1e-4));
+    }
+    SECTION("Parallel rows") {
+        sv.setNumThreads(4);
+        sv.setParallelThreshold(1);
+        std::vector<std::complex<TestType>> out(dim);
+        applySparseHamiltonian(sv, ham, out.data());
+        CHECK(isApproxEqual(out, h_psi, 1e-4));
+        CHECK(expval(sv, ham) == Approx(mean).margin(1e-5));
+        CHECK(var(sv, ham) == Approx(mean_sq - mean * mean).margin(1e-4));
+    }
+    SECTION("Invalid CSR arrays") {
+        using Util::LightningException;
+        using vec_c = std::vector<std::complex<TestType>>;
+        CHECK_THROWS_AS(SparseHamiltonian<TestType>(vec_c{}, {}, {0}),
+                        LightningException);
+        CHECK_THROWS_AS(
+            SparseHamiltonian<TestType>(vec_c(1), {0}, {0, 1, 1, 1}),
+            LightningException);
+        CHECK_THROWS_AS(SparseHamiltonian<TestType>(vec_c(2), {0}, {0, 1, 2}),
+                        LightningException);
+        CHECK_THROWS_AS(
+            SparseHamiltonian<TestType>(vec_c(2), {0, 1}, {0, 2, 1}),
+            LightningException);
+        CHECK_THROWS_AS(SparseHamiltonian<TestType>(vec_c(1), {2}, {0, 1, 1}),
+                        LightningException);
+        CHECK_THROWS_AS(expval(createTestState<TestType>(1 + num_qubits), ham),
+                        LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("Observables::expval of a dense matrix", "[Observables]",
+                   float, double) {
+    const size_t num_qubits = 5;
+    auto sv = createTestState<TestType>(num_qubits);
+
+    for (const auto &wires :
+         {std::vector<size_t>{3}, std::vector<size_t>{4, 1},
+          std::vector<size_t>{0, 2, 3}}) {
+        const size_t dim = Util::exp2(wires.size());
+        std::vector<std::complex<TestType>> matrix(dim * dim);
+        for (size_t i = 0; i < dim; i++) {
+            matrix[i * dim + i] = {static_cast<TestType>(1.0 - 0.3 * i), 0};
+            for (size_t j = i + 1; j < dim; j++) {
+                matrix[i * dim + j] = {static_cast<TestType>(0.2 * j),
+                                       static_cast<TestType>(0.1 * i - 0.4)};
+                matrix[j * dim + i] = std::conj(matrix[i * dim + j]);
+            }
+        }
+        auto m_psi{sv};
+        m_psi.applyMatrix(matrix, wires, false);
+        const TestType expected = std::real(
+            Util::innerProdC(sv.getDataVector(), m_psi.getDataVector()));
+
+        CAPTURE(wires);
+        CHECK(expval(sv, matrix, wires) == Approx(expected).margin(1e-5));
+        sv.setNumThreads(4);
+        sv.setParallelThreshold(1);
+        CHECK(expval(sv, matrix, wires) == Approx(expected).margin(1e-5));
+        sv.setNumThreads(1);
+    }
+}
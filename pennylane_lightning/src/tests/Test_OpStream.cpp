@@ -0,0 +1,149 @@
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "Gates.hpp"
+#include "OpStream.hpp"
+#include "StateVectorManaged.hpp"
+#include "Util.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+
+namespace {
+auto code(GateOperation gate_op) -> uint8_t {
+    return static_cast<uint8_t>(gate_op);
+}
+
+/// RX, CNOT, Hadamard as matrix, CRot, inverse RZ, SWAP as matrix, Toffoli
+template <class T> auto createOpStream() -> OpStream<T> {
+    return {{code(GateOperation::RX), code(GateOperation::CNOT),
+             OpStream<T>::MATRIX_OP, code(GateOperation::CRot),
+             code(GateOperation::RZ), OpStream<T>::MATRIX_OP,
+             code(GateOperation::Toffoli)},
+            {false, false, false, false, true, true, false},
+            {0, 0, 1, 1, 1, 2, 3, 0, 1, 1, 2, 3},
+            {0.312, 0.2, -0.3, 0.4, 0.5},
+            {Gates::getHadamard<T>(), Gates::getSWAP<T>()}};
+}
+
+template <class T> void applyReference(StateVectorManaged<T> &sv) {
+    sv.applyOperation("RX", {0}, false, {0.312});
+    sv.applyOperation("CNOT", {0, 1}, false);
+    sv.applyOperation("Hadamard", {1}, false);
+    sv.applyOperation("CRot", {1, 2}, false, {0.2, -0.3, 0.4});
+    sv.applyOperation("RZ", {3}, true, {0.5});
+    sv.applyOperation("SWAP", {0, 1}, true);
+    sv.applyOperation("Toffoli", {1, 2, 3}, false);
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("OpStream::apply", "[OpStream]", float, double) {
+    const size_t num_qubits = 4;
+    const auto stream = createOpStream<TestType>();
+    REQUIRE(stream.getNumOperations() == 7);
+
+    StateVectorManaged<TestType> expected(num_qubits);
+    expected.applyOperation("Hadamard", {3}, false);
+    applyReference(expected);
+
+    SECTION("Without fusion") {
+        StateVectorManaged<TestType> sv(num_qubits);
+        sv.applyOperation("Hadamard", {3}, false);
+        stream.apply(sv);
+        CHECK(isApproxEqual(sv.getDataVector(), expected.getDataVector()));
+    }
+    SECTION("With fusion") {
+        StateVectorManaged<TestType> sv(num_qubits);
+        sv.applyOperation("Hadamard", {3}, false);
+        stream.apply(sv, 3);
+        CHECK(isApproxEqual(sv.getDataVector(), expected.getDataVector()));
+    }
+    SECTION("Statevector too small") {
+        StateVectorManaged<TestType> sv(3);
+        REQUIRE_THROWS_AS(stream.apply(sv), Util::LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("OpStream::OpStream invalid streams", "[OpStream]", float,
+                   double) {
+    const auto rx = code(GateOperation::RX);
+    const auto matrix_op = OpStream<TestType>::MATRIX_OP;
+
+    SECTION("Invalid code") {
+        REQUIRE_THROWS_AS(OpStream<TestType>({static_cast<uint8_t>(
+                                                 matrix_op + 1)},
+                                             {false}, {}, {}, {}),
+                          Util::LightningException);
+    }
+    SECTION("Missing inverse flags") {
+        REQUIRE_THROWS_AS(OpStream<TestType>({rx}, {}, {0}, {0.1}, {}),
+                          Util::LightningException);
+    }
+    SECTION("Missing and extra wires") {
+        REQUIRE_THROWS_AS(OpStream<TestType>({rx}, {false}, {}, {0.1}, {}),
+                          Util::LightningException);
+        REQUIRE_THROWS_AS(OpStream<TestType>({rx}, {false}, {0, 1}, {0.1}, {}),
+                          Util::LightningException);
+    }
+    SECTION("Missing and extra parameters") {
+        REQUIRE_THROWS_AS(OpStream<TestType>({rx}, {false}, {0}, {}, {}),
+                          Util::LightningException);
+        REQUIRE_THROWS_AS(
+            OpStream<TestType>({rx}, {false}, {0}, {0.1, 0.2}, {}),
+            Util::LightningException);
+    }
+    SECTION("Missing and extra matrices") {
+        REQUIRE_THROWS_AS(OpStream<TestType>({matrix_op}, {false}, {0}, {}, {}),
+                          Util::LightningException);
+        REQUIRE_THROWS_AS(
+            OpStream<TestType>({rx}, {false}, {0}, {0.1},
+                               {Gates::getHadamard<TestType>()}),
+            Util::LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("OpStreamWorker::submit", "[OpStream]", float, double) {
+    const size_t num_qubits = 4;
+    auto stream =
+        std::make_shared<const OpStream<TestType>>(createOpStream<TestType>());
+
+    StateVectorManaged<TestType> expected(num_qubits);
+    applyReference(expected);
+    applyReference(expected);
+
+    SECTION("Consecutive streams") {
+        StateVectorManaged<TestType> sv(num_qubits);
+        OpStreamWorker<TestType> worker;
+        auto first = worker.submit(stream, sv);
+        auto second = worker.submit(stream, sv, 2);
+        first.get();
+        second.get();
+        CHECK(isApproxEqual(sv.getDataVector(), expected.getDataVector()));
+    }
+    SECTION("Queued streams are applied on destruction") {
+        StateVectorManaged<TestType> sv(num_qubits);
+        {
+            OpStreamWorker<TestType> worker;
+            worker.submit(stream, sv);
+            worker.submit(stream, sv, 2);
+        }
+        CHECK(isApproxEqual(sv.getDataVector(), expected.getDataVector()));
+    }
+    SECTION("Errors are rethrown") {
+        StateVectorManaged<TestType> small_sv(2);
+        StateVectorManaged<TestType> sv(num_qubits);
+        OpStreamWorker<TestType> worker;
+        auto failed = worker.submit(stream, small_sv);
+        auto first = worker.submit(stream, sv);
+        auto second = worker.submit(stream, sv);
+        REQUIRE_THROWS_AS(failed.get(), Util::LightningException);
+        first.get();
+        second.get();
+        CHECK(isApproxEqual(sv.getDataVector(), expected.getDataVector()));
+    }
+}
@@ -0,0 +1,75 @@
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "SIMDKernels.hpp"
+#include "StateVector.hpp"
+#include "Util.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+
+TEMPLATE_TEST_CASE("SIMD::isSupported", "[SIMDKernels]", float, double) {
+    CHECK(SIMD::isSupported(SIMD::ISA::None));
+    CHECK(SIMD::isSupported(SIMD::getBestISA()));
+
+    std::vector<std::complex<TestType>> data(Util::exp2(4));
+    StateVector<TestType> sv{data.data(), data.size()};
+    CHECK(sv.getKernelISA() == SIMD::getBestISA());
+    sv.setKernelISA(SIMD::ISA::None);
+    CHECK(sv.getKernelISA() == SIMD::ISA::None);
+
+    for (const auto isa : {SIMD::ISA::AVX2, SIMD::ISA::AVX512}) {
+        if (!SIMD::isSupported(isa)) {
+            CHECK_THROWS_AS(sv.setKernelISA(isa), Util::LightningException);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector SIMD single-qubit kernels", "[SIMDKernels]",
+                   float, double) {
+    using cp_t = std::complex<TestType>;
+    const std::vector<std::string> gates{"PauliX", "PauliY", "PauliZ",
+                                         "Hadamard", "S", "T", "RX", "RY",
+                                         "RZ", "PhaseShift", "Rot"};
+    const std::vector<TestType> params{0.312, -1.27, 0.85};
+
+    for (const auto isa : {SIMD::ISA::AVX2, SIMD::ISA::AVX512}) {
+        if (!SIMD::isSupported(isa)) {
+            continue;
+        }
+        for (size_t num_qubits = 4; num_qubits < 7; num_qubits++) {
+            std::vector<cp_t> init_state(Util::exp2(num_qubits));
+            for (size_t i = 0; i < init_state.size(); i++) {
+                init_state[i] = cp_t{static_cast<TestType>(std::cos(0.7 * i)),
+                                     static_cast<TestType>(std::sin(0.3 * i))};
+            }
+            for (const auto &gate : gates) {
+                for (size_t wire = 0; wire < num_qubits; wire++) {
+                    for (const bool inverse : {false, true}) {
+                        std::vector<cp_t> expected{init_state};
+                        std::vector<cp_t> result{init_state};
+                        StateVector<TestType> sv_scalar{expected.data(),
+                                                        expected.size()};
+                        StateVector<TestType> sv_simd{result.data(),
+                                                      result.size()};
+                        sv_scalar.setKernelISA(SIMD::ISA::None);
+                        sv_simd.setKernelISA(isa);
+                        sv_simd.setParallelThreshold(0);
+
+                        sv_scalar.applyOperation(gate, {wire}, inverse,
+                                                 params);
+                        sv_simd.applyOperation(gate, {wire}, inverse, params);
+
+                        CAPTURE(static_cast<int>(isa), num_qubits, gate,
+                                wire, inverse);
+                        CHECK(isApproxEqualAbs(result, expected));
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#include <complex>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "Sampler.hpp"
+#include "StateVectorManaged.hpp"
+#include "Util.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+TEMPLATE_TEST_CASE("Sampler::sample", "[Sampler]", float, double) {
+    const size_t num_qubits = 3;
+
+    SECTION("Basis state") {
+        StateVectorManaged<TestType> sv(num_qubits);
+        sv.applyOperation("PauliX", {0}, false);
+        sv.applyOperation("PauliX", {2}, false);
+        const Sampler<TestType> sampler(sv);
+        REQUIRE(sampler.getNumQubits() == num_qubits);
+        for (const size_t s : sampler.sample(1000, 7)) {
+            CHECK(s == 0b101);
+        }
+    }
+
+    SECTION("Distribution") {
+        // Unnormalized amplitudes with distinct probabilities, one of them 0
+        const std::vector<std::complex<TestType>> data{
+            {0.1, 0.2}, {0.0, 0.0}, {0.5, 0.0}, {0.3, -0.3},
+            {0.0, 0.7}, {0.2, 0.1}, {0.4, 0.4}, {0.05, 0.0}};
+        const StateVectorManaged<TestType> sv(data);
+        const Sampler<TestType> sampler(sv);
+
+        const size_t num_samples = 400000;
+        const auto samples = sampler.sample(num_samples, 1234);
+        REQUIRE(samples.size() == num_samples);
+
+        std::vector<size_t> counts(data.size(), 0);
+        for (const size_t s : samples) {
+            REQUIRE(s < data.size());
+            counts[s]++;
+        }
+        const TestType norm = std::real(Util::innerProdC(data, data));
+        CHECK(counts[1] == 0);
+        for (size_t i = 0; i < data.size(); i++) {
+            const double expected = std::norm(data[i]) / norm;
+            CAPTURE(i);
+            CHECK(static_cast<double>(counts[i]) / num_samples ==
+                  Approx(expected).margin(5e-3));
+        }
+    }
+
+    SECTION("Reproducible for any number of threads") {
+        StateVectorManaged<TestType> sv(num_qubits);
+        sv.applyOperation("Hadamard", {0}, false);
+        sv.applyOperation("RY", {1}, false, {0.6});
+        sv.applyOperation("CNOT", {1, 2}, false);
+
+        const size_t num_samples = 3 * Sampler<TestType>::CHUNK_SIZE + 17;
+        sv.setNumThreads(1);
+        const auto serial = Sampler<TestType>(sv).sample(num_samples, 99);
+        sv.setNumThreads(4);
+        const Sampler<TestType> sampler(sv);
+        CHECK(sampler.sample(num_samples, 99) == serial);
+        // The table is reused across calls
+        CHECK(sampler.sample(num_samples, 99) == serial);
+        CHECK(sampler.sample(num_samples, 100) != serial);
+    }
+
+    SECTION("Zero state") {
+        const StateVectorManaged<TestType> sv(
+            std::vector<std::complex<TestType>>(4, {0, 0}));
+        CHECK_THROWS_AS(Sampler<TestType>(sv), Util::LightningException);
+    }
+}
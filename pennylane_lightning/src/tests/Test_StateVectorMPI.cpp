@@ -0,0 +1,257 @@
+#include <complex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "AdjointDiff.hpp"
+#include "AdjointDiffMPI.hpp"
+#include "Observables.hpp"
+#include "ObservablesMPI.hpp"
+#include "StateVectorMPI.hpp"
+#include "StateVectorManaged.hpp"
+#include "Util.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+namespace {
+/**
+ * @brief Normalized amplitudes, all distinct and non-zero.
+ */
+template <class T>
+auto createTestData(size_t num_qubits) -> std::vector<std::complex<T>> {
+    std::vector<std::complex<T>> data(Util::exp2(num_qubits));
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = {static_cast<T>(std::cos(0.7 * i + 0.1)),
+                   static_cast<T>(std::sin(0.3 * i - 0.4))};
+    }
+    const T norm = std::sqrt(std::real(Util::innerProdC(data, data)));
+    for (auto &d : data) {
+        d /= norm;
+    }
+    return data;
+}
+
+/**
+ * @brief Number of global qubits of a statevector over MPI_COMM_WORLD.
+ */
+auto getNumGlobalQubits() -> size_t {
+    int size = 0;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    return Util::log2(static_cast<size_t>(size));
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("StateVectorMPI::StateVectorMPI", "[StateVectorMPI]",
+                   float, double) {
+    const size_t num_global = getNumGlobalQubits();
+    const size_t num_qubits = num_global + 4;
+
+    SECTION("Zero state") {
+        const StateVectorMPI<TestType> sv(num_qubits);
+        CHECK(sv.getNumQubits() == num_qubits);
+        CHECK(sv.getNumGlobalQubits() == num_global);
+        CHECK(sv.getNumLocalQubits() == 4);
+        CHECK(sv.getLocal().getLength() == 16);
+        std::vector<std::complex<TestType>> expected(sv.getLength());
+        expected[0] = {1, 0};
+        CHECK(sv.gatherData() == expected);
+    }
+    SECTION("Distributed data") {
+        const auto data = createTestData<TestType>(num_qubits);
+        const StateVectorMPI<TestType> sv(data.data(), data.size());
+        CHECK(sv.getLocalOffset() == sv.getRank() * 16);
+        CHECK(sv.getLocal().getData()[0] == data[sv.getLocalOffset()]);
+        CHECK(sv.gatherData() == data);
+    }
+    SECTION("Too few local qubits") {
+        CHECK_THROWS_AS(StateVectorMPI<TestType>(num_global + 2),
+                        Util::LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorMPI::applyOperations", "[StateVectorMPI]",
+                   float, double) {
+    const size_t num_global = getNumGlobalQubits();
+    const auto margin = static_cast<TestType>(1e-5);
+
+    // The larger size exchanges amplitudes in several chunks
+    for (const size_t num_local : {size_t{4}, size_t{18}}) {
+        const size_t n = num_global + num_local;
+        const auto data = createTestData<TestType>(n);
+        CAPTURE(n);
+
+        const std::vector<std::string> ops{
+            "Hadamard", "RY",   "CNOT", "CRZ",   "Toffoli", "CSWAP",
+            "Rot",      "SWAP", "T",    "CRot",  "PauliY",  "S",
+            "RX",       "CZ",   "CRY",  "Toffoli"};
+        const std::vector<std::vector<size_t>> wires{
+            {0},       {1},          {0, 1},     {n - 1, 0},
+            {0, 1, 2}, {1, n - 2, 0}, {1},       {0, n - 1},
+            {n - 1},   {0, 2},       {1},        {0},
+            {n - 2},   {2, 1},       {n - 1, 0}, {0, n - 3, n - 1}};
+        const std::vector<bool> inverses{false, true,  false, false,
+                                         false, false, true,  false,
+                                         true,  false, false, true,
+                                         false, false, true,  false};
+        const std::vector<std::vector<TestType>> params{
+            {},    {0.4}, {}, {0.7}, {}, {}, {0.1, -0.5, 1.2}, {}, {},
+            {0.3, 0.2, -0.9}, {}, {}, {-1.1}, {}, {0.25}, {}};
+
+        StateVectorManaged<TestType> expected(data);
+        expected.applyOperations(ops, wires, inverses, params);
+
+        SECTION("Batched operations, n = " + std::to_string(n)) {
+            StateVectorMPI<TestType> sv(data.data(), data.size());
+            sv.applyOperations(ops, wires, inverses, params);
+            CHECK(isApproxEqualAbs(sv.gatherData(), expected.getDataVector(),
+                                   margin));
+        }
+        SECTION("Single operations, n = " + std::to_string(n)) {
+            StateVectorMPI<TestType> sv(data.data(), data.size());
+            for (size_t i = 0; i < ops.size(); i++) {
+                sv.applyOperation(ops[i], wires[i], inverses[i], params[i]);
+            }
+            CHECK(isApproxEqualAbs(sv.gatherData(), expected.getDataVector(),
+                                   margin));
+        }
+        SECTION("Matrices, n = " + std::to_string(n)) {
+            std::vector<std::complex<TestType>> matrix(64);
+            for (size_t i = 0; i < matrix.size(); i++) {
+                matrix[i] = {static_cast<TestType>(std::sin(1.3 * i)),
+                             static_cast<TestType>(std::cos(0.4 * i))};
+            }
+            const std::vector<std::complex<TestType>> matrix_2q(
+                matrix.begin(), matrix.begin() + 16);
+            StateVectorManaged<TestType> expected_matrix(data);
+            expected_matrix.applyMatrix(matrix_2q, {1, 0}, false);
+            expected_matrix.applyMatrix(matrix, {0, n - 1, 1}, true);
+
+            StateVectorMPI<TestType> sv(data.data(), data.size());
+            sv.applyMatrix(matrix_2q, {1, 0}, false);
+            sv.applyOperation(matrix, {0, n - 1, 1}, true);
+            CHECK(isApproxEqualAbs(sv.gatherData(),
+                                   expected_matrix.getDataVector(), margin));
+        }
+    }
+
+    SECTION("Invalid wires") {
+        StateVectorMPI<TestType> sv(num_global + 4);
+        using Util::LightningException;
+        CHECK_THROWS_AS(sv.applyOperation("CNOT", {0, 0}),
+                        LightningException);
+        CHECK_THROWS_AS(sv.applyOperation("PauliX", {num_global + 4}),
+                        LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorMPI::innerProduct", "[StateVectorMPI]", float,
+                   double) {
+    const size_t n = getNumGlobalQubits() + 4;
+    const auto data = createTestData<TestType>(n);
+    StateVectorManaged<TestType> expected(data);
+    expected.applyOperation("RX", {0}, false, {0.8});
+    expected.applyOperation("CNOT", {0, n - 1}, false);
+
+    const StateVectorMPI<TestType> sv0(data.data(), data.size());
+    StateVectorMPI<TestType> sv1(sv0);
+    sv1.applyOperation("RX", {0}, false, {0.8});
+    sv1.applyOperation("CNOT", {0, n - 1}, false);
+
+    const auto result = sv0.innerProduct(sv1);
+    const auto reference =
+        Util::innerProdC(data, expected.getDataVector());
+    CHECK(std::real(result) == Approx(std::real(reference)).margin(1e-5));
+    CHECK(std::imag(result) == Approx(std::imag(reference)).margin(1e-5));
+}
+
+TEMPLATE_TEST_CASE("Observables::expval and var on StateVectorMPI",
+                   "[StateVectorMPI]", float, double) {
+    const size_t num_global = getNumGlobalQubits();
+    // The sums over the larger state are not exact in single precision
+    const double margin = std::is_same_v<TestType, float> ? 1e-3 : 1e-7;
+
+    for (const size_t num_local : {size_t{4}, size_t{18}}) {
+        const size_t n = num_global + num_local;
+        const auto data = createTestData<TestType>(n);
+        const StateVectorManaged<TestType> expected(data);
+        const StateVectorMPI<TestType> sv(data.data(), data.size());
+        CAPTURE(n);
+
+        // Global and local flips, with the top local bit beyond one chunk
+        const std::vector<PauliWord> words{
+            {{"Identity"}, {1}, n},
+            {{"PauliZ"}, {0}, n},
+            {{"PauliX"}, {0}, n},
+            {{"PauliY"}, {1}, n},
+            {{"PauliX"}, {num_global}, n},
+            {{"PauliX"}, {n - 1}, n},
+            {{"PauliX", "PauliX"}, {0, n - 1}, n},
+            {{"PauliY", "PauliZ"}, {1, 2}, n},
+            {{"PauliY", "PauliX", "PauliZ"}, {0, 3, 1}, n},
+            {{"PauliX", "PauliY"}, {0, num_global + 1}, n}};
+        const std::vector<TestType> coeffs{0.4, -1.2, 0.7,  0.35, 2.0,
+                                           -0.6, 0.25, 1.1, 0.9,  -0.3};
+
+        for (size_t t = 0; t < words.size(); t++) {
+            CAPTURE(t);
+            CHECK(expval(sv, words[t]) ==
+                  Approx(expval(expected, words[t])).margin(margin));
+            CHECK(var(sv, words[t]) ==
+                  Approx(var(expected, words[t])).margin(margin));
+        }
+        const Hamiltonian<TestType> ham{coeffs, words};
+        CHECK(expval(sv, ham) ==
+              Approx(expval(expected, ham)).margin(10 * margin));
+        CHECK(var(sv, ham) == Approx(var(expected, ham)).margin(10 * margin));
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobianMPI::adjointJacobian", "[StateVectorMPI]",
+                   float, double) {
+    const size_t n = getNumGlobalQubits() + 3;
+    const auto data = createTestData<TestType>(n);
+
+    AdjointJacobianMPI<TestType> adj;
+    const auto ops = adj.createOpsData(
+        {"RX", "RY", "CNOT", "CRZ", "PhaseShift", "ControlledPhaseShift", "RZ",
+         "CRY", "CRX"},
+        {{0.3}, {-0.7}, {}, {0.9}, {1.4}, {-0.2}, {0.6}, {1.1}, {-0.4}},
+        {{0}, {1}, {0, 2}, {1, 0}, {2}, {0, n - 1}, {n - 1}, {2, 1}, {0, 1}},
+        {false, false, false, true, false, false, true, false, false});
+    const std::vector<size_t> trainable{0, 1, 2, 4, 5, 7};
+
+    const std::vector<std::complex<TestType>> hermitian{
+        {1, 0}, {0, 0.5}, {0.2, 0}, {0, 0},   {0, -0.5}, {-1, 0},
+        {0, 0}, {0.3, 0}, {0.2, 0}, {0, 0},   {0.5, 0},  {0, 1},
+        {0, 0}, {0.3, 0}, {0, -1},  {0.1, 0}};
+    const std::vector<ObsDatum<TestType>> observables{
+        ObsDatum<TestType>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<TestType>({"PauliX", "PauliZ"}, {{}, {}}, {{1}, {n - 1}}),
+        ObsDatum<TestType>({"Hermitian"}, {hermitian}, {{0, 2}})};
+
+    std::vector<std::vector<TestType>> expected(
+        observables.size(), std::vector<TestType>(trainable.size(), 0));
+    AdjointJacobian<TestType>().adjointJacobian(data.data(), data.size(),
+                                                expected, observables, ops,
+                                                trainable, true);
+
+    for (const size_t max_obs_states : {size_t{0}, size_t{1}}) {
+        CAPTURE(max_obs_states);
+        const StateVectorMPI<TestType> psi(data.data(), data.size());
+        std::vector<std::vector<TestType>> jacobian(
+            observables.size(), std::vector<TestType>(trainable.size(), 0));
+        adj.adjointJacobian(psi, jacobian, observables, ops, trainable, true,
+                            max_obs_states);
+        for (size_t o = 0; o < observables.size(); o++) {
+            for (size_t p = 0; p < trainable.size(); p++) {
+                CAPTURE(o, p);
+                CHECK(jacobian[o][p] == Approx(expected[o][p]).margin(1e-5));
+            }
+        }
+    }
+}
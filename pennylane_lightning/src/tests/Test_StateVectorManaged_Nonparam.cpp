@@ -51,6 +51,112 @@ TEMPLATE_TEST_CASE("StateVectorManaged::StateVectorManaged",
     }
 }
 
+TEMPLATE_TEST_CASE("StateVectorManaged with allocator policies",
+                   "[StateVectorManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using AlignedSV =
+        StateVectorManaged<TestType, Util::AlignedAllocator<cp_t, 64>>;
+    using HugePageSV =
+        StateVectorManaged<TestType, Util::HugePageAllocator<cp_t>>;
+    STATIC_REQUIRE(Util::is_first_touch_allocator_v<
+                   Util::AlignedAllocator<cp_t, 64>>);
+    STATIC_REQUIRE(!Util::is_first_touch_allocator_v<std::allocator<cp_t>>);
+
+    const size_t num_qubits = 5;
+    StateVectorManaged<TestType> reference(num_qubits);
+    for (size_t w = 0; w < num_qubits; w++) {
+        reference.applyOperation("RX", {w}, false,
+                                 {static_cast<TestType>(0.3 * (w + 1))});
+    }
+    reference.applyOperation("CNOT", {0, 3}, false);
+    const auto matches_reference = [&reference](const auto &data) {
+        return isApproxEqualAbs(std::vector<cp_t>(data.begin(), data.end()),
+                                reference.getDataVector());
+    };
+
+    SECTION("Aligned storage") {
+        AlignedSV sv(num_qubits);
+        CHECK(reinterpret_cast<uintptr_t>(sv.getData()) % 64 == 0);
+        CHECK(sv.getDataVector()[0] == cp_t{1, 0});
+        for (size_t i = 1; i < sv.getLength(); i++) {
+            CHECK(sv.getDataVector()[i] == cp_t{0, 0});
+        }
+
+        for (size_t w = 0; w < num_qubits; w++) {
+            sv.applyOperation("RX", {w}, false,
+                              {static_cast<TestType>(0.3 * (w + 1))});
+        }
+        sv.applyOperation("CNOT", {0, 3}, false);
+        CHECK(matches_reference(sv.getDataVector()));
+    }
+
+    SECTION("Parallel first-touch copies") {
+        StateVector<TestType> view(reference.getData(), reference.getLength());
+        view.setNumThreads(4);
+        view.setParallelThreshold(1);
+        const AlignedSV from_view(view);
+        const AlignedSV from_vector(reference.getDataVector());
+        const AlignedSV copy(from_view);
+        CHECK(copy.getNumThreads() == 4);
+        CHECK(copy.getParallelThreshold() == 1);
+        for (const auto *sv : {&from_view, &from_vector, &copy}) {
+            CHECK(reinterpret_cast<uintptr_t>(sv->getData()) % 64 == 0);
+            CHECK(matches_reference(sv->getDataVector()));
+        }
+        const StateVectorManaged<TestType> back(copy.getDataVector());
+        CHECK(back.getDataVector() == reference.getDataVector());
+    }
+
+    SECTION("Huge pages") {
+        // Large enough for a huge page at either precision
+        const size_t num_large_qubits = 18;
+        HugePageSV sv(num_large_qubits);
+        CHECK(reinterpret_cast<uintptr_t>(sv.getData()) %
+                  Util::HUGE_PAGE_SIZE ==
+              0);
+        CHECK(sv.getDataVector()[0] == cp_t{1, 0});
+        CHECK(sv.getDataVector().back() == cp_t{0, 0});
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorManaged in-place updates",
+                   "[StateVectorManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using AlignedSV =
+        StateVectorManaged<TestType, Util::AlignedAllocator<cp_t, 64>>;
+    const size_t num_qubits = 4;
+    AlignedSV sv(num_qubits);
+    sv.setNumThreads(2);
+    sv.setParallelThreshold(1);
+    sv.applyOperations({"Hadamard", "RY", "CNOT"}, {{0}, {1}, {1, 3}},
+                       {false, false, false}, {{}, {0.4}, {}});
+    const cp_t *data = sv.getData();
+    const auto prepared = std::vector<cp_t>(sv.getDataVector().begin(),
+                                            sv.getDataVector().end());
+
+    SECTION("resetState") {
+        sv.resetState();
+        CHECK(sv.getData() == data);
+        std::vector<cp_t> expected(sv.getLength(), {0, 0});
+        expected[0] = {1, 0};
+        CHECK(std::equal(expected.begin(), expected.end(), sv.getData()));
+    }
+    SECTION("updateData and assignment keep the storage") {
+        AlignedSV other(num_qubits);
+        const cp_t *other_data = other.getData();
+        other = sv;
+        CHECK(other.getData() == other_data);
+        CHECK(std::equal(prepared.begin(), prepared.end(), other.getData()));
+
+        sv.resetState();
+        sv.updateData(prepared.data(), prepared.size());
+        CHECK(sv.getData() == data);
+        CHECK(std::equal(prepared.begin(), prepared.end(), sv.getData()));
+        CHECK_THROWS_AS(sv.updateData(prepared.data(), prepared.size() / 2),
+                        Util::LightningException);
+    }
+}
+
 namespace {} // namespace
 
 TEMPLATE_TEST_CASE("StateVectorManaged::applyHadamard",
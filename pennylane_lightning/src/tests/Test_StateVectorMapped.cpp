@@ -0,0 +1,142 @@
+#include <complex>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <catch2/catch.hpp>
+
+#include "StateVectorManaged.hpp"
+#include "StateVectorMapped.hpp"
+#include "Util.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+
+namespace {
+/// Path of a temporary file, removed when the test ends
+class TempPath {
+  public:
+    explicit TempPath(const std::string &name)
+        : path_{(std::filesystem::temp_directory_path() /
+                 ("pl_mapped_" + std::to_string(::getpid()) + "_" + name))
+                    .string()} {}
+    ~TempPath() { std::filesystem::remove(path_); }
+    TempPath(const TempPath &) = delete;
+    auto operator=(const TempPath &) -> TempPath & = delete;
+
+    [[nodiscard]] auto str() const -> const std::string & { return path_; }
+
+  private:
+    std::string path_;
+};
+
+template <class T>
+auto getDataVector(const StateVector<T> &sv) -> std::vector<std::complex<T>> {
+    return {sv.getData(), sv.getData() + sv.getLength()};
+}
+
+/// Gates on high- and low-order wires
+template <class T> void applyCircuit(StateVector<T> &sv) {
+    const size_t num_qubits = sv.getNumQubits();
+    std::vector<std::string> ops;
+    std::vector<std::vector<size_t>> wires;
+    std::vector<std::vector<T>> params;
+    for (size_t wire = 0; wire < num_qubits; wire++) {
+        ops.emplace_back("RY");
+        wires.push_back({wire});
+        params.push_back({static_cast<T>(0.3 * wire + 0.1)});
+    }
+    for (size_t wire = 0; wire + 1 < num_qubits; wire++) {
+        ops.emplace_back((wire % 2 == 0) ? "CNOT" : "CRX");
+        wires.push_back({wire, num_qubits - 1 - wire});
+        params.push_back({static_cast<T>(0.2 * wire)});
+    }
+    ops.insert(ops.end(), {"Toffoli", "RZ", "CZ"});
+    wires.insert(wires.end(), {{0, 4, 5}, {2}, {5, 0}});
+    params.insert(params.end(), {{}, {0.9}, {}});
+    sv.applyOperations(ops, wires, std::vector<bool>(ops.size(), false),
+                       params);
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("StateVectorMapped::applyOperations",
+                   "[StateVectorMapped]", float, double) {
+    const size_t num_qubits = 6;
+    const std::string type_name = (sizeof(TestType) == 4) ? "f" : "d";
+    StateVectorManaged<TestType> expected(num_qubits);
+    applyCircuit<TestType>(expected);
+
+    for (const size_t chunk_qubits : {0, 2, 4}) {
+        const TempPath path("sv_" + type_name);
+        StateVectorMapped<TestType> sv(path.str(), num_qubits, chunk_qubits);
+        REQUIRE(sv.getPath() == path.str());
+        REQUIRE(sv.getCacheBlockQubits() == chunk_qubits);
+        REQUIRE(sv.getData()[0] == std::complex<TestType>{1, 0});
+
+        applyCircuit<TestType>(sv);
+        sv.sync();
+
+        // The file holds the amplitudes once synchronized
+        std::vector<std::complex<TestType>> file_data(sv.getLength());
+        std::ifstream file(path.str(), std::ios::binary);
+        file.read(reinterpret_cast<char *>(file_data.data()),
+                  static_cast<std::streamsize>(file_data.size() *
+                                               sizeof(file_data[0])));
+        REQUIRE(file);
+
+        CAPTURE(chunk_qubits);
+        CHECK(isApproxEqualAbs(getDataVector(sv), expected.getDataVector(),
+                               static_cast<TestType>(1e-5)));
+        CHECK(file_data == getDataVector(sv));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorMapped::checkpoint", "[StateVectorMapped]",
+                   float, double) {
+    const size_t num_qubits = 6;
+    const std::string type_name = (sizeof(TestType) == 4) ? "f" : "d";
+    const TempPath path("sv_" + type_name);
+    const TempPath restored_path("restored_" + type_name);
+    const TempPath checkpoint_path("checkpoint_" + type_name);
+
+    StateVectorMapped<TestType> sv(path.str(), num_qubits, 3);
+    applyCircuit<TestType>(sv);
+    sv.checkpoint(checkpoint_path.str());
+    REQUIRE_FALSE(std::filesystem::exists(checkpoint_path.str() + ".tmp"));
+
+    SECTION("Restore") {
+        StateVectorMapped<TestType> restored(restored_path.str(), num_qubits,
+                                             2);
+        restored.restore(checkpoint_path.str());
+        CHECK(getDataVector(restored) == getDataVector(sv));
+    }
+    SECTION("Overwrite the checkpoint") {
+        applyCircuit<TestType>(sv);
+        sv.checkpoint(checkpoint_path.str());
+        StateVectorMapped<TestType> restored(restored_path.str(), num_qubits);
+        restored.restore(checkpoint_path.str());
+        CHECK(getDataVector(restored) == getDataVector(sv));
+    }
+    SECTION("Mismatched statevector") {
+        StateVectorMapped<TestType> other_qubits(restored_path.str(),
+                                                 num_qubits - 1);
+        REQUIRE_THROWS_AS(other_qubits.restore(checkpoint_path.str()),
+                          Util::LightningException);
+    }
+    SECTION("Invalid files") {
+        StateVectorMapped<TestType> restored(restored_path.str(), num_qubits);
+        REQUIRE_THROWS_AS(restored.restore(checkpoint_path.str() + ".missing"),
+                          Util::LightningException);
+        REQUIRE_THROWS_AS(restored.restore(path.str()),
+                          Util::LightningException);
+
+        std::filesystem::resize_file(checkpoint_path.str(), 100);
+        REQUIRE_THROWS_AS(restored.restore(checkpoint_path.str()),
+                          Util::LightningException);
+    }
+}
@@ -857,4 +857,290 @@ TEMPLATE_TEST_CASE("StateVector::applyCSWAP", "[StateVector_Nonparam]", float,
             CHECK(svdat012.cdata == expected);
         }
     }
-}
\ No newline at end of file
+}
+TEMPLATE_TEST_CASE("StateVector::applyControlledMatrix",
+                   "[StateVector_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 5;
+    const size_t length = Util::exp2(num_qubits);
+    std::vector<cp_t> init_state(length);
+    for (size_t i = 0; i < length; i++) {
+        init_state[i] = {static_cast<TestType>(0.1 * i - 1),
+                         static_cast<TestType>(0.05 * i * i)};
+    }
+
+    for (const auto &[controls, targets] :
+         std::vector<std::pair<std::vector<size_t>, std::vector<size_t>>>{
+             {{}, {2}},
+             {{3}, {1}},
+             {{0, 3}, {1}},
+             {{4}, {2, 0}},
+             {{1, 3, 4}, {0, 2}}}) {
+        const size_t dim = Util::exp2(targets.size());
+        std::vector<cp_t> matrix(dim * dim);
+        for (size_t i = 0; i < matrix.size(); i++) {
+            matrix[i] = {static_cast<TestType>(0.3 * i - 0.7),
+                         static_cast<TestType>(1.0 / (i + 1))};
+        }
+
+        // Dense matrix of the controlled operation over controls and targets
+        std::vector<size_t> wires(controls);
+        wires.insert(wires.end(), targets.begin(), targets.end());
+        const size_t full_dim = Util::exp2(wires.size());
+        const size_t offset = full_dim - dim;
+        std::vector<cp_t> dense(full_dim * full_dim);
+        for (size_t i = 0; i < offset; i++) {
+            dense[i * full_dim + i] = Util::ONE<TestType>();
+        }
+        for (size_t i = 0; i < dim; i++) {
+            for (size_t j = 0; j < dim; j++) {
+                dense[(offset + i) * full_dim + offset + j] =
+                    matrix[i * dim + j];
+            }
+        }
+
+        for (const bool inverse : {false, true}) {
+            CAPTURE(controls, targets, inverse);
+            auto expected{init_state};
+            StateVector<TestType>(expected.data(), length)
+                .applyMatrix(dense, wires, inverse);
+
+            auto data{init_state};
+            StateVector<TestType> sv(data.data(), length);
+            sv.applyControlledMatrix(matrix, controls, targets, inverse);
+            CHECK(isApproxEqual(data, expected));
+
+            data = init_state;
+            sv.setNumThreads(4);
+            sv.setParallelThreshold(1);
+            sv.applyControlledMatrix(matrix, controls, targets, inverse);
+            CHECK(isApproxEqual(data, expected));
+        }
+    }
+
+    SECTION("Invalid wires") {
+        auto data{init_state};
+        StateVector<TestType> sv(data.data(), length);
+        const std::vector<cp_t> matrix(4);
+        CHECK_THROWS_AS(sv.applyControlledMatrix(matrix, {1}, {1}, false),
+                        Util::LightningException);
+        CHECK_THROWS_AS(sv.applyControlledMatrix(matrix, {0}, {1, 2}, false),
+                        Util::LightningException);
+        CHECK_THROWS_AS(
+            sv.applyControlledMatrix(std::vector<cp_t>(64), {0}, {1, 2, 3},
+                                     false),
+            Util::LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::projectOntoControls",
+                   "[StateVector_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 4;
+    const size_t length = Util::exp2(num_qubits);
+    std::vector<cp_t> init_state(length);
+    for (size_t i = 0; i < length; i++) {
+        init_state[i] = {static_cast<TestType>(i + 1), 0};
+    }
+
+    for (const auto &controls : std::vector<std::vector<size_t>>{
+             {}, {3}, {0}, {2, 1}, {0, 3}, {0, 1, 2, 3}}) {
+        CAPTURE(controls);
+        size_t mask = 0;
+        for (const size_t wire : controls) {
+            mask |= static_cast<size_t>(1U) << (num_qubits - wire - 1);
+        }
+        auto data{init_state};
+        StateVector<TestType> sv(data.data(), length);
+        sv.projectOntoControls(controls);
+        for (size_t i = 0; i < length; i++) {
+            CAPTURE(i);
+            CHECK(data[i] ==
+                  ((i & mask) == mask ? init_state[i] : cp_t{0, 0}));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::probs", "[StateVector_Nonparam]", float,
+                   double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 5;
+
+    std::vector<cp_t> init_state(Util::exp2(num_qubits));
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = cp_t{static_cast<TestType>(std::cos(0.7 * i)),
+                             static_cast<TestType>(std::sin(0.3 * i))};
+    }
+    SVData<TestType> svdat{num_qubits, init_state};
+
+    const std::vector<std::vector<size_t>> wire_sets{
+        {},     {0},       {4},          {2, 0},          {1, 3},
+        {4, 1}, {3, 0, 2}, {0, 1, 2, 3}, {4, 3, 2, 1, 0}, {0, 1, 2, 3, 4}};
+
+    for (const size_t num_threads : {1, 3}) {
+        svdat.sv.setNumThreads(num_threads);
+        svdat.sv.setParallelThreshold(1);
+        for (const auto &wires : wire_sets) {
+            // Reference marginal from the bits of every basis state
+            std::vector<TestType> expected(Util::exp2(wires.size()), 0);
+            for (size_t i = 0; i < init_state.size(); i++) {
+                size_t outcome = 0;
+                for (const size_t wire : wires) {
+                    outcome = (outcome << 1U) |
+                              ((i >> (num_qubits - 1 - wire)) & 1U);
+                }
+                expected[outcome] += std::norm(init_state[i]);
+            }
+
+            CAPTURE(num_threads, wires);
+            const auto probs = svdat.sv.probs(wires);
+            REQUIRE(probs.size() == expected.size());
+            for (size_t m = 0; m < probs.size(); m++) {
+                CHECK(probs[m] == Approx(expected[m]).epsilon(1e-5));
+            }
+        }
+    }
+
+    SECTION("Invalid wires") {
+        CHECK_THROWS_AS(svdat.sv.probs({5}), Util::LightningException);
+        CHECK_THROWS_AS(svdat.sv.probs({1, 2, 1}), Util::LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector state preparation", "[StateVector_Nonparam]",
+                   float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 4;
+    std::vector<cp_t> data(Util::exp2(num_qubits), {0.5, 0.25});
+    StateVector<TestType> sv(data.data(), data.size());
+    sv.setNumThreads(2);
+    sv.setParallelThreshold(1);
+
+    SECTION("setBasisState") {
+        sv.setBasisState(9);
+        std::vector<cp_t> expected(data.size(), {0, 0});
+        expected[9] = {1, 0};
+        CHECK(data == expected);
+
+        // Bits 1, 0, 1 on wires 3, 0, 2: index 0b0011
+        sv.setBasisState({1, 0, 1}, {3, 0, 2});
+        expected[9] = {0, 0};
+        expected[3] = {1, 0};
+        CHECK(data == expected);
+
+        using Util::LightningException;
+        CHECK_THROWS_AS(sv.setBasisState(16), LightningException);
+        CHECK_THROWS_AS(sv.setBasisState({1, 2}, {0, 1}), LightningException);
+        CHECK_THROWS_AS(sv.setBasisState({1}, {0, 1}), LightningException);
+        CHECK_THROWS_AS(sv.setBasisState({1, 0}, {1, 1}), LightningException);
+    }
+
+    SECTION("setStateVector") {
+        std::vector<cp_t> state(8);
+        for (size_t i = 0; i < state.size(); i++) {
+            state[i] = {static_cast<TestType>(i + 1),
+                        -static_cast<TestType>(i)};
+        }
+        // Each subsystem amplitude moves to the index with its bits on the
+        // given wires and wire 1 in |0>
+        const std::vector<size_t> wires{2, 0, 3};
+        sv.setStateVector(state, wires);
+        std::vector<cp_t> expected(data.size(), {0, 0});
+        for (size_t i = 0; i < state.size(); i++) {
+            size_t index = 0;
+            for (size_t w = 0; w < wires.size(); w++) {
+                const size_t bit = (i >> (wires.size() - 1 - w)) & 1U;
+                index |= bit << (num_qubits - 1 - wires[w]);
+            }
+            expected[index] = state[i];
+        }
+        CHECK(data == expected);
+
+        // A full register state is copied in order
+        std::vector<cp_t> full(data.size());
+        for (size_t i = 0; i < full.size(); i++) {
+            full[i] = {static_cast<TestType>(i), 1};
+        }
+        sv.setStateVector(full, {0, 1, 2, 3});
+        CHECK(data == full);
+
+        using Util::LightningException;
+        CHECK_THROWS_AS(sv.setStateVector(state, {0, 1}), LightningException);
+        CHECK_THROWS_AS(sv.setStateVector(state, {0, 4, 1}),
+                        LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::applyMatrixWithOverlaps",
+                   "[StateVector_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 4;
+    const size_t length = Util::exp2(num_qubits);
+    std::vector<cp_t> psi(length);
+    std::vector<cp_t> phi(length);
+    for (size_t i = 0; i < length; i++) {
+        psi[i] = {static_cast<TestType>(0.1 * i - 0.5),
+                  static_cast<TestType>(0.02 * i * i)};
+        phi[i] = {static_cast<TestType>(0.3 - 0.05 * i),
+                  static_cast<TestType>(0.1 * (i % 3))};
+    }
+
+    for (const auto &wires : std::vector<std::vector<size_t>>{
+             {1}, {3}, {2, 0}, {0, 3, 1}}) {
+        const size_t dim = Util::exp2(wires.size());
+        std::vector<cp_t> matrix(dim * dim);
+        std::vector<std::vector<cp_t>> generators(2,
+                                                  std::vector<cp_t>(dim * dim));
+        for (size_t i = 0; i < matrix.size(); i++) {
+            matrix[i] = {static_cast<TestType>(0.3 * i - 0.7),
+                         static_cast<TestType>(1.0 / (i + 1))};
+            generators[0][i] = {static_cast<TestType>(0.2 * (i % 5)),
+                                static_cast<TestType>(-0.1 * i)};
+            generators[1][i] = {static_cast<TestType>(1.0 / (i + 2)), 0};
+        }
+
+        for (size_t num_threads : {1, 4}) {
+            std::vector<cp_t> psi_fused(psi);
+            std::vector<cp_t> phi_data(phi);
+            StateVector<TestType> sv(psi_fused.data(), length);
+            StateVector<TestType> other(phi_data.data(), length);
+            sv.setNumThreads(num_threads);
+            sv.setParallelThreshold(1);
+            const auto overlaps =
+                sv.applyMatrixWithOverlaps(matrix, wires, other, generators);
+
+            REQUIRE(overlaps.size() == generators.size());
+            for (size_t g = 0; g < generators.size(); g++) {
+                std::vector<cp_t> g_phi(phi);
+                StateVector<TestType>(g_phi.data(), length)
+                    .applyMatrix(generators[g], wires, false);
+                const cp_t expected = Util::innerProdC(psi, g_phi);
+                CAPTURE(wires, num_threads, g);
+                CHECK(std::real(overlaps[g]) ==
+                      Approx(std::real(expected)).epsilon(1e-4));
+                CHECK(std::imag(overlaps[g]) ==
+                      Approx(std::imag(expected)).epsilon(1e-4));
+            }
+
+            std::vector<cp_t> expected_psi(psi);
+            StateVector<TestType>(expected_psi.data(), length)
+                .applyMatrix(matrix, wires, false);
+            CHECK(isApproxEqual(psi_fused, expected_psi));
+        }
+    }
+
+    SECTION("Invalid arguments") {
+        std::vector<cp_t> psi_data(psi);
+        std::vector<cp_t> short_data(length / 2);
+        StateVector<TestType> sv(psi_data.data(), length);
+        StateVector<TestType> other(short_data.data(), length / 2);
+        const auto hadamard = Gates::getHadamard<TestType>();
+        CHECK_THROWS_AS(sv.applyMatrixWithOverlaps(hadamard, {0}, other, {}),
+                        LightningException);
+        CHECK_THROWS_AS(sv.applyMatrixWithOverlaps(hadamard, {0, 1}, sv, {}),
+                        LightningException);
+        CHECK_THROWS_AS(sv.applyMatrixWithOverlaps(hadamard, {0}, sv,
+                                                   {Gates::getCNOT<TestType>()}),
+                        LightningException);
+    }
+}
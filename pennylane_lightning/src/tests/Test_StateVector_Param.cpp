@@ -1,7 +1,10 @@
 #include <algorithm>
 #include <complex>
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -689,3 +692,571 @@ TEMPLATE_TEST_CASE("StateVector::applyMatrix multiple wires",
         CHECK(isApproxEqual(svdat.cdata, svdat_expected.cdata));
     }
 }
+
+TEMPLATE_TEST_CASE("StateVector::setNumThreads", "[StateVector_Param]", float,
+                   double) {
+    const size_t num_qubits = 4;
+    const std::vector<std::string> ops{"Hadamard", "RX",  "CRY", "CNOT",
+                                       "Rot",      "CRZ", "Toffoli"};
+    const std::vector<std::vector<size_t>> wires{{0},    {1},    {1, 3}, {2, 0},
+                                                 {3},    {0, 2}, {3, 1, 2}};
+    const std::vector<bool> inverses{false, false, true, false,
+                                     true,  false, false};
+    const std::vector<std::vector<TestType>> params{
+        {}, {0.3}, {-0.7}, {}, {0.1, 0.2, 0.3}, {1.1}, {}};
+    const auto matrix =
+        Gates::getRot<TestType>(static_cast<TestType>(0.4),
+                                static_cast<TestType>(-0.2),
+                                static_cast<TestType>(1.3));
+
+    SECTION("Thread count and threshold setters") {
+        SVData<TestType> svdat{num_qubits};
+        CHECK(svdat.sv.getNumThreads() >= 1);
+        CHECK(svdat.sv.getParallelThreshold() ==
+              StateVector<TestType>::DEFAULT_PARALLEL_THRESHOLD);
+
+        svdat.sv.setNumThreads(3);
+        svdat.sv.setParallelThreshold(8);
+        CHECK(svdat.sv.getNumThreads() == 3);
+        CHECK(svdat.sv.getParallelThreshold() == 8);
+        CHECK_THROWS_AS(svdat.sv.setNumThreads(0), Util::LightningException);
+    }
+    SECTION("Multithreaded kernels match serial kernels") {
+        SVData<TestType> svdat_serial{num_qubits};
+        SVData<TestType> svdat_parallel{num_qubits};
+        svdat_serial.sv.setNumThreads(1);
+        svdat_parallel.sv.setNumThreads(4);
+        svdat_parallel.sv.setParallelThreshold(0);
+
+        for (auto *sv : {&svdat_serial.sv, &svdat_parallel.sv}) {
+            sv->applyOperations(ops, wires, inverses, params);
+            sv->applyOperation(matrix, {2}, false);
+            sv->applyOperation(matrix, {1}, true);
+        }
+        CHECK(isApproxEqual(svdat_parallel.cdata, svdat_serial.cdata));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::applyOperation wire-based kernels",
+                   "[StateVector_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using IndexKernel =
+        std::function<void(StateVector<TestType> &, const vector<size_t> &,
+                           const vector<size_t> &, bool)>;
+    const size_t num_qubits = 4;
+    const TestType p0 = 0.312;
+    const TestType p1 = -1.27;
+    const TestType p2 = 0.85;
+
+    std::vector<cp_t> init_state(Util::exp2(num_qubits));
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = cp_t{static_cast<TestType>(std::cos(0.7 * i)),
+                             static_cast<TestType>(std::sin(0.3 * i))};
+    }
+
+    // Gate name, number of wires, parameters and reference index-based kernel
+    const std::vector<std::tuple<std::string, size_t, std::vector<TestType>,
+                                 IndexKernel>>
+        gates{{"PauliX", 1, {},
+               [](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyPauliX(i, e, inv);
+               }},
+              {"PauliY", 1, {},
+               [](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyPauliY(i, e, inv);
+               }},
+              {"PauliZ", 1, {},
+               [](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyPauliZ(i, e, inv);
+               }},
+              {"Hadamard", 1, {},
+               [](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyHadamard(i, e, inv);
+               }},
+              {"S", 1, {},
+               [](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyS(i, e, inv);
+               }},
+              {"T", 1, {},
+               [](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyT(i, e, inv);
+               }},
+              {"RX", 1, {p0},
+               [&](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyRX(i, e, inv, p0);
+               }},
+              {"RY", 1, {p0},
+               [&](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyRY(i, e, inv, p0);
+               }},
+              {"RZ", 1, {p0},
+               [&](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyRZ(i, e, inv, p0);
+               }},
+              {"PhaseShift", 1, {p0},
+               [&](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyPhaseShift(i, e, inv, p0);
+               }},
+              {"Rot", 1, {p0, p1, p2},
+               [&](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyRot(i, e, inv, p0, p1, p2);
+               }},
+              {"CNOT", 2, {},
+               [](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyCNOT(i, e, inv);
+               }},
+              {"SWAP", 2, {},
+               [](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applySWAP(i, e, inv);
+               }},
+              {"CZ", 2, {},
+               [](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyCZ(i, e, inv);
+               }},
+              {"ControlledPhaseShift", 2, {p0},
+               [&](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyControlledPhaseShift(i, e, inv, p0);
+               }},
+              {"CRX", 2, {p0},
+               [&](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyCRX(i, e, inv, p0);
+               }},
+              {"CRY", 2, {p0},
+               [&](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyCRY(i, e, inv, p0);
+               }},
+              {"CRZ", 2, {p0},
+               [&](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyCRZ(i, e, inv, p0);
+               }},
+              {"CRot", 2, {p0, p1, p2},
+               [&](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyCRot(i, e, inv, p0, p1, p2);
+               }},
+              {"Toffoli", 3, {},
+               [](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyToffoli(i, e, inv);
+               }},
+              {"CSWAP", 3, {},
+               [](auto &sv, auto &i, auto &e, bool inv) {
+                   sv.applyCSWAP(i, e, inv);
+               }}};
+
+    const std::vector<std::vector<size_t>> wire_sets{
+        {0},    {1},    {2},    {3},       {0, 1},    {1, 0},   {0, 3},
+        {3, 1}, {2, 3}, {3, 0}, {0, 1, 2}, {2, 0, 3}, {3, 2, 1}, {1, 3, 0}};
+
+    for (const auto &[name, num_wires, params, index_kernel] : gates) {
+        for (const auto &wires : wire_sets) {
+            if (wires.size() != num_wires) {
+                continue;
+            }
+            for (const bool inverse : {false, true}) {
+                SVData<TestType> svdat_ref{num_qubits, init_state};
+                SVData<TestType> svdat{num_qubits, init_state};
+                index_kernel(svdat_ref.sv, svdat_ref.getInternalIndices(wires),
+                             svdat_ref.getExternalIndices(wires), inverse);
+                svdat.sv.applyOperation(name, wires, inverse, params);
+
+                CAPTURE(name, wires, inverse);
+                CHECK(isApproxEqualAbs(svdat.cdata, svdat_ref.cdata));
+            }
+        }
+    }
+
+    SECTION("Arbitrary matrix") {
+        const auto tof = Gates::getToffoli<TestType>();
+        const auto rot = Gates::getRot<TestType>(p0, p1, p2);
+        for (const auto &wires : wire_sets) {
+            const auto &matrix = (wires.size() == 3) ? tof : rot;
+            if (wires.size() == 2) {
+                continue;
+            }
+            for (const bool inverse : {false, true}) {
+                SVData<TestType> svdat_ref{num_qubits, init_state};
+                SVData<TestType> svdat{num_qubits, init_state};
+                svdat_ref.sv.applyMatrix(matrix,
+                                         svdat_ref.getInternalIndices(wires),
+                                         svdat_ref.getExternalIndices(wires),
+                                         inverse);
+                svdat.sv.applyMatrix(matrix, wires, inverse);
+
+                CAPTURE(wires, inverse);
+                CHECK(isApproxEqualAbs(svdat.cdata, svdat_ref.cdata));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::applyOperations with gate fusion",
+                   "[StateVector_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 5;
+
+    std::vector<cp_t> init_state(Util::exp2(num_qubits));
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = cp_t{static_cast<TestType>(std::cos(0.7 * i)),
+                             static_cast<TestType>(std::sin(0.3 * i))};
+    }
+
+    const std::vector<std::string> ops{
+        "RX",   "RY",     "CNOT", "RZ",         "Hadamard", "CRot", "Toffoli",
+        "SWAP", "PauliY", "CZ",   "PhaseShift", "CSWAP",    "RY",   "CRY"};
+    const std::vector<std::vector<size_t>> wires{
+        {0},    {1}, {0, 1}, {2}, {3},       {2, 4}, {1, 3, 4},
+        {0, 4}, {2}, {3, 1}, {4}, {0, 2, 3}, {4},    {1, 2}};
+    const std::vector<std::vector<TestType>> params{
+        {0.312}, {-1.27}, {}, {0.85}, {},    {0.1, -0.4, 1.3}, {},
+        {},      {},      {}, {0.66}, {},    {2.1},            {-0.9}};
+
+    for (const bool inverse : {false, true}) {
+        const std::vector<bool> inverses(ops.size(), inverse);
+        SVData<TestType> svdat_ref{num_qubits, init_state};
+        svdat_ref.sv.applyOperations(ops, wires, inverses, params);
+
+        for (size_t max_fused_wires = 1; max_fused_wires <= num_qubits;
+             max_fused_wires++) {
+            SVData<TestType> svdat{num_qubits, init_state};
+            svdat.sv.applyOperations(ops, wires, inverses, params,
+                                     max_fused_wires);
+
+            CAPTURE(inverse, max_fused_wires);
+            CHECK(isApproxEqualAbs(svdat.cdata, svdat_ref.cdata));
+        }
+    }
+
+    SECTION("Invalid number of wires") {
+        SVData<TestType> svdat{num_qubits};
+        REQUIRE_THROWS(svdat.sv.applyOperations(
+            {"RX", "CNOT"}, {{0}, {1}}, {false, false}, {{0.3}, {}}, 2));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::applyOperation by GateOperation",
+                   "[StateVector_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 3;
+    const std::vector<TestType> params{0.312, -1.27, 0.85};
+    const std::vector<size_t> all_wires{2, 0, 1};
+
+    std::vector<cp_t> init_state(Util::exp2(num_qubits));
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = cp_t{static_cast<TestType>(std::cos(0.7 * i)),
+                             static_cast<TestType>(std::sin(0.3 * i))};
+    }
+
+    for (size_t op = 0; op < Util::NUM_GATE_OPERATIONS; op++) {
+        const auto gate_op = static_cast<GateOperation>(op);
+        const std::string name{Util::getGateName(gate_op)};
+        const std::vector<size_t> wires(
+            all_wires.begin(),
+            all_wires.begin() + Util::getGateNumWires(gate_op));
+        for (const bool inverse : {false, true}) {
+            SVData<TestType> svdat_name{num_qubits, init_state};
+            SVData<TestType> svdat_op{num_qubits, init_state};
+            svdat_name.sv.applyOperation(name, wires, inverse, params);
+            svdat_op.sv.applyOperation(gate_op, wires, inverse, params);
+            CAPTURE(name, inverse);
+            CHECK(svdat_op.cdata == svdat_name.cdata);
+        }
+    }
+
+    SECTION("Compile-time gate") {
+        SVData<TestType> svdat_name{num_qubits, init_state};
+        SVData<TestType> svdat_op{num_qubits, init_state};
+        svdat_name.sv.applyOperation("CRot", {1, 2}, false, params);
+        svdat_op.sv.template applyOperation<GateOperation::CRot>(
+            {1, 2}, false, params);
+        CHECK(svdat_op.cdata == svdat_name.cdata);
+        CHECK_THROWS_AS(svdat_op.sv.template applyOperation<GateOperation::RX>(
+                            {0, 1}, false, params),
+                        std::invalid_argument);
+    }
+
+    SECTION("Unknown gate") {
+        SVData<TestType> svdat{num_qubits, init_state};
+        CHECK_THROWS_AS(svdat.sv.applyOperation("NotAGate", {0}, false),
+                        Util::LightningException);
+        CHECK_THROWS_AS(svdat.sv.applyOperation(GateOperation::NumGates, {0}),
+                        Util::LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::applyMatrix dense wire-based path",
+                   "[StateVector_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 7;
+
+    std::vector<cp_t> init_state(Util::exp2(num_qubits));
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = cp_t{static_cast<TestType>(std::cos(0.7 * i)),
+                             static_cast<TestType>(std::sin(0.3 * i))};
+    }
+
+    const std::vector<std::vector<size_t>> wire_sets{
+        {1}, {3, 0}, {4, 1, 6}, {0, 5, 2, 3}, {6, 0, 4, 1, 3}};
+    for (const auto &wires : wire_sets) {
+        // Arbitrary dense matrix, applied with and without the adjoint
+        const size_t dim = Util::exp2(wires.size());
+        std::vector<cp_t> matrix(dim * dim);
+        for (size_t i = 0; i < matrix.size(); i++) {
+            matrix[i] = cp_t{static_cast<TestType>(std::sin(1.3 * i + 0.2)),
+                             static_cast<TestType>(std::cos(0.9 * i))} /
+                        static_cast<TestType>(dim);
+        }
+        for (const bool inverse : {false, true}) {
+            for (const size_t num_threads : {1, 3}) {
+                SVData<TestType> svdat{num_qubits, init_state};
+                SVData<TestType> svdat_expected{num_qubits, init_state};
+                svdat.sv.setNumThreads(num_threads);
+                svdat.sv.setParallelThreshold(1);
+
+                svdat.sv.applyMatrix(matrix, wires, inverse);
+                svdat_expected.sv.applyMatrix(
+                    matrix, svdat_expected.getInternalIndices(wires),
+                    svdat_expected.getExternalIndices(wires), inverse);
+
+                CAPTURE(wires, inverse, num_threads);
+                CHECK(isApproxEqualAbs(svdat.cdata, svdat_expected.cdata,
+                                       static_cast<TestType>(1e-5)));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::applyDiagonal", "[StateVector_Param]", float,
+                   double) {
+    using cp_t = std::complex<TestType>;
+    // More qubits than the block bits of the kernel
+    const size_t num_qubits = 12;
+
+    std::vector<cp_t> init_state(Util::exp2(num_qubits));
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = cp_t{static_cast<TestType>(std::cos(0.7 * i)),
+                             static_cast<TestType>(std::sin(0.3 * i))};
+    }
+
+    const std::vector<std::vector<size_t>> wire_sets{
+        {0}, {11}, {3, 10}, {11, 0, 5}, {2, 9, 4, 7, 0, 11}};
+    for (const auto &wires : wire_sets) {
+        std::vector<cp_t> diag(Util::exp2(wires.size()));
+        for (size_t i = 0; i < diag.size(); i++) {
+            diag[i] = std::exp(cp_t{0, static_cast<TestType>(0.4 * i + 0.1)});
+        }
+        for (const bool inverse : {false, true}) {
+            // Multiply every amplitude by the entry selected by its wire bits
+            std::vector<cp_t> expected{init_state};
+            for (size_t i = 0; i < expected.size(); i++) {
+                size_t entry = 0;
+                for (const size_t wire : wires) {
+                    const size_t bit = (i >> (num_qubits - wire - 1)) & 1U;
+                    entry = (entry << 1U) | bit;
+                }
+                expected[i] *= inverse ? std::conj(diag[entry]) : diag[entry];
+            }
+
+            for (const size_t num_threads : {1, 3}) {
+                SVData<TestType> svdat{num_qubits, init_state};
+                svdat.sv.setNumThreads(num_threads);
+                svdat.sv.setParallelThreshold(1);
+                svdat.sv.applyDiagonal(diag, wires, inverse);
+
+                CAPTURE(wires, inverse, num_threads);
+                CHECK(isApproxEqualAbs(svdat.cdata, expected,
+                                       static_cast<TestType>(1e-5)));
+            }
+
+            if (wires.size() <= 3) {
+                // Diagonal matrices given to applyMatrix take the same path
+                const size_t dim = diag.size();
+                std::vector<cp_t> matrix(dim * dim, 0);
+                for (size_t i = 0; i < dim; i++) {
+                    matrix[i * dim + i] = diag[i];
+                }
+                SVData<TestType> svdat{num_qubits, init_state};
+                svdat.sv.applyMatrix(matrix, wires, inverse);
+                CHECK(isApproxEqualAbs(svdat.cdata, expected,
+                                       static_cast<TestType>(1e-5)));
+            }
+        }
+    }
+
+    SECTION("Invalid diagonal size") {
+        SVData<TestType> svdat{num_qubits};
+        CHECK_THROWS_AS(svdat.sv.applyDiagonal(std::vector<cp_t>(2), {0, 1},
+                                               false),
+                        Util::LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::applyOperations with diagonal fusion",
+                   "[StateVector_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 5;
+
+    std::vector<cp_t> init_state(Util::exp2(num_qubits));
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = cp_t{static_cast<TestType>(std::cos(0.7 * i)),
+                             static_cast<TestType>(std::sin(0.3 * i))};
+    }
+
+    // Runs of diagonal gates on overlapping wires, separated by mixers
+    const std::vector<std::string> ops{
+        "CRZ", "ControlledPhaseShift", "RZ", "CZ", "PauliZ", "RX", "S", "T",
+        "RY",  "PhaseShift", "CRZ", "Hadamard", "RZ", "CZ", "T"};
+    const std::vector<std::vector<size_t>> wires{
+        {0, 1}, {2, 4}, {3}, {1, 3}, {0}, {2},    {4}, {4},
+        {1},    {0},    {3, 0}, {2}, {2}, {4, 1}, {3}};
+    const std::vector<std::vector<TestType>> params{
+        {0.3}, {-1.1}, {0.7}, {}, {}, {0.45}, {}, {},
+        {1.9}, {0.2},  {-0.6}, {}, {1.3}, {}, {}};
+
+    for (const bool inverse : {false, true}) {
+        const std::vector<bool> inverses(ops.size(), inverse);
+        SVData<TestType> svdat_ref{num_qubits, init_state};
+        for (size_t i = 0; i < ops.size(); i++) {
+            svdat_ref.sv.applyOperation(ops[i], wires[i], inverse, params[i]);
+        }
+
+        for (const size_t max_fused_wires : {0, 2}) {
+            SVData<TestType> svdat{num_qubits, init_state};
+            svdat.sv.applyOperations(ops, wires, inverses, params,
+                                     max_fused_wires);
+
+            CAPTURE(inverse, max_fused_wires);
+            CHECK(isApproxEqualAbs(svdat.cdata, svdat_ref.cdata,
+                                   static_cast<TestType>(1e-5)));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::applyOperations with cache blocking",
+                   "[StateVector_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 8;
+
+    std::vector<cp_t> init_state(Util::exp2(num_qubits));
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = cp_t{static_cast<TestType>(std::cos(0.7 * i)),
+                             static_cast<TestType>(std::sin(0.3 * i))};
+    }
+
+    // Gates on high- and low-order wires, repeated over two layers
+    std::vector<std::string> ops;
+    std::vector<std::vector<size_t>> wires;
+    std::vector<std::vector<TestType>> params;
+    for (size_t layer = 0; layer < 2; layer++) {
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            ops.emplace_back("RY");
+            wires.push_back({wire});
+            params.push_back({static_cast<TestType>(0.3 * wire + layer)});
+        }
+        for (size_t wire = 0; wire + 1 < num_qubits; wire++) {
+            ops.emplace_back((wire % 2 == 0) ? "CNOT" : "CRX");
+            wires.push_back({wire, num_qubits - 1 - wire});
+            params.push_back({static_cast<TestType>(0.2 * wire)});
+        }
+        ops.insert(ops.end(), {"Toffoli", "CSWAP", "RZ", "CZ"});
+        wires.insert(wires.end(), {{0, 4, 7}, {6, 1, 3}, {2}, {5, 0}});
+        params.insert(params.end(), {{}, {}, {0.9}, {}});
+    }
+
+    for (const bool inverse : {false, true}) {
+        const std::vector<bool> inverses(ops.size(), inverse);
+        SVData<TestType> svdat_ref{num_qubits, init_state};
+        svdat_ref.sv.applyOperations(ops, wires, inverses, params);
+
+        for (const size_t block_qubits : {1, 2, 3, 5, 7}) {
+            for (const size_t num_threads : {1, 3}) {
+                SVData<TestType> svdat{num_qubits, init_state};
+                svdat.sv.setNumThreads(num_threads);
+                svdat.sv.setParallelThreshold(1);
+                svdat.sv.setCacheBlockQubits(block_qubits);
+                REQUIRE(svdat.sv.getCacheBlockQubits() == block_qubits);
+                svdat.sv.applyOperations(ops, wires, inverses, params);
+
+                CAPTURE(inverse, block_qubits, num_threads);
+                CHECK(isApproxEqualAbs(svdat.cdata, svdat_ref.cdata,
+                                       static_cast<TestType>(1e-5)));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::applyOperations with wire reordering",
+                   "[StateVector_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 6;
+
+    std::vector<cp_t> init_state(Util::exp2(num_qubits));
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = cp_t{static_cast<TestType>(std::cos(0.7 * i)),
+                             static_cast<TestType>(std::sin(0.3 * i))};
+    }
+
+    // Most gates act on the high-order wires 0 and 1
+    std::vector<std::string> ops;
+    std::vector<std::vector<size_t>> wires;
+    std::vector<std::vector<TestType>> params;
+    for (size_t layer = 0; layer < 6; layer++) {
+        ops.insert(ops.end(), {"RX", "CRY", "Hadamard", "CNOT", "RZ"});
+        wires.insert(wires.end(), {{0}, {1, 0}, {1}, {0, 5}, {layer % 6}});
+        params.insert(params.end(),
+                      {{static_cast<TestType>(0.3 * layer)},
+                       {static_cast<TestType>(0.5 - 0.2 * layer)},
+                       {},
+                       {},
+                       {static_cast<TestType>(0.7)}});
+    }
+    ops.insert(ops.end(), {"Toffoli", "CSWAP", "RY"});
+    wires.insert(wires.end(), {{0, 4, 2}, {3, 1, 5}, {4}});
+    params.insert(params.end(), {{}, {}, {1.1}});
+
+    // Applies the operations with the given settings and compares the result
+    // with the operations applied in wire order
+    const auto check = [&](auto &&configure) {
+        for (const bool inverse : {false, true}) {
+            const std::vector<bool> inverses(ops.size(), inverse);
+            SVData<TestType> svdat_ref{num_qubits, init_state};
+            svdat_ref.sv.applyOperations(ops, wires, inverses, params);
+
+            for (const size_t max_fused_wires : {0, 3}) {
+                SVData<TestType> svdat{num_qubits, init_state};
+                configure(svdat.sv);
+                svdat.sv.applyOperations(ops, wires, inverses, params,
+                                         max_fused_wires);
+
+                CAPTURE(inverse, max_fused_wires);
+                CHECK(isApproxEqualAbs(svdat.cdata, svdat_ref.cdata,
+                                       static_cast<TestType>(1e-5)));
+            }
+        }
+    };
+
+    SECTION("Automatic") {
+        for (const size_t reorder_qubits : {1, 2, 4, 6}) {
+            CAPTURE(reorder_qubits);
+            check([reorder_qubits](StateVector<TestType> &sv) {
+                sv.setReorderQubits(reorder_qubits);
+                REQUIRE(sv.getReorderQubits() == reorder_qubits);
+            });
+        }
+    }
+    SECTION("Given wires") {
+        for (const auto &reorder_wires :
+             std::vector<std::vector<size_t>>{{0}, {1, 0}, {2, 0, 5}}) {
+            CAPTURE(reorder_wires);
+            check([&reorder_wires](StateVector<TestType> &sv) {
+                sv.setReorderWires(reorder_wires);
+                REQUIRE(sv.getReorderWires() == reorder_wires);
+            });
+        }
+    }
+    SECTION("Invalid wires") {
+        SVData<TestType> svdat{num_qubits};
+        REQUIRE_THROWS_AS(svdat.sv.setReorderWires({0, 6}),
+                          Util::LightningException);
+        REQUIRE_THROWS_AS(svdat.sv.setReorderWires({2, 2}),
+                          Util::LightningException);
+    }
+}
@@ -7,6 +7,8 @@
 
 #include <catch2/catch.hpp>
 
+#include "Dispatcher.hpp"
+#include "Instrumentation.hpp"
 #include "Util.hpp"
 
 #include "TestHelpers.hpp"
@@ -70,6 +72,23 @@ TEMPLATE_TEST_CASE("Utility math functions", "[Util]", float, double) {
             }
         }
     }
+    SECTION("fillTrailingOnes and fillLeadingOnes") {
+        CHECK(Util::fillTrailingOnes(0) == 0);
+        CHECK(Util::fillLeadingOnes(0) == ~static_cast<size_t>(0));
+        for (size_t pos = 1; pos < 16; pos++) {
+            CHECK(Util::fillTrailingOnes(pos) == Util::exp2(pos) - 1);
+            CHECK(Util::fillLeadingOnes(pos) == ~(Util::exp2(pos) - 1));
+        }
+    }
+    SECTION("popcount") {
+        CHECK(Util::popcount(0) == 0);
+        CHECK(Util::popcount(0b1011) == 3);
+        CHECK(Util::popcount(~static_cast<size_t>(0)) ==
+              CHAR_BIT * sizeof(size_t));
+        for (size_t pos = 0; pos < 16; pos++) {
+            CHECK(Util::popcount(Util::fillTrailingOnes(pos)) == pos);
+        }
+    }
     SECTION("dimSize") {
         using namespace Catch::Matchers;
         for (size_t i = 0; i < 64; i++) {
@@ -142,6 +161,41 @@ TEMPLATE_TEST_CASE("Utility math functions", "[Util]", float, double) {
             CHECK(isApproxEqual(result, expected_result, 1e-5));
         }
     }
+    SECTION("Single-precision accumulation") {
+        static_assert(std::is_same_v<Util::accumulator_t<float>, double>);
+        static_assert(std::is_same_v<Util::accumulator_t<double>, double>);
+
+        // The small terms are each below half an ulp of the leading one in
+        // single precision; both the serial and the OpenMP paths are covered
+        for (const size_t length : {size_t{1} << 16U, size_t{1} << 21U}) {
+            const std::complex<float> small{1e-4F, -2e-4F};
+            std::vector<std::complex<float>> data1(length, small);
+            std::vector<std::complex<float>> data2(length, {0, 1e-4F});
+            data1[0] = data2[0] = {1, 0};
+
+            const std::complex<double> small_d(small);
+            const double expected_norm =
+                1 + static_cast<double>(length - 1) * std::norm(small_d);
+            const std::complex<double> expected_prod =
+                1.0 + static_cast<double>(length - 1) * std::conj(small_d) *
+                          std::complex<double>(0, 1e-4F);
+            CAPTURE(length);
+
+            const std::complex<float> norm = Util::innerProdC(data1, data1);
+            CHECK(std::real(norm) == Approx(expected_norm).epsilon(1e-6));
+            CHECK(std::imag(norm) == Approx(0).margin(1e-6));
+
+            const std::complex<float> prod = Util::innerProdC(data1, data2);
+            CHECK(std::real(prod) ==
+                  Approx(std::real(expected_prod)).epsilon(1e-6));
+            CHECK(std::imag(prod) ==
+                  Approx(std::imag(expected_prod)).epsilon(1e-6));
+
+            const std::complex<float> prod_u = Util::innerProd(data1, data2);
+            CHECK(std::imag(prod_u) ==
+                  Approx(std::imag(expected_prod)).epsilon(1e-6));
+        }
+    }
     SECTION("matrixVecProd") {
         SECTION("Simple Iterative") {
             for (size_t m = 2; m < 8; m++) {
@@ -340,3 +394,40 @@ TEMPLATE_TEST_CASE("Utility math functions", "[Util]", float, double) {
         }
     }
 }
+
+TEST_CASE("Util::lookupGateOperation", "[Util]") {
+    STATIC_REQUIRE(Util::findGateOperation("CRot") == GateOperation::CRot);
+    STATIC_REQUIRE(Util::getGateNumWires(GateOperation::Toffoli) == 3);
+    STATIC_REQUIRE(Util::findGateOperation("Unknown") ==
+                   GateOperation::NumGates);
+    STATIC_REQUIRE(Util::isDiagonalGate(GateOperation::CRZ));
+    STATIC_REQUIRE(!Util::isDiagonalGate(GateOperation::CRX));
+
+    for (size_t op = 0; op < Util::NUM_GATE_OPERATIONS; op++) {
+        const auto gate_op = static_cast<GateOperation>(op);
+        CHECK(Util::lookupGateOperation(Util::getGateName(gate_op)) ==
+              gate_op);
+    }
+    CHECK_THROWS_AS(Util::lookupGateOperation("Unknown"),
+                    Util::LightningException);
+}
+
+TEST_CASE("Util::Instrumentation", "[Util]") {
+    auto &instrumentation = Util::Instrumentation::getInstance();
+    instrumentation.reset();
+
+    instrumentation.record("RX", 100, 64);
+    instrumentation.record("RX", 50, 64);
+    { const Util::ScopedTimer timer("applyMatrix", 32); }
+
+    const auto records = instrumentation.getRecords();
+    REQUIRE(records.size() == 2);
+    CHECK(records.at("RX").calls == 2);
+    CHECK(records.at("RX").nanoseconds == 150);
+    CHECK(records.at("RX").bytes == 128);
+    CHECK(records.at("applyMatrix").calls == 1);
+    CHECK(records.at("applyMatrix").bytes == 32);
+
+    instrumentation.reset();
+    CHECK(instrumentation.getRecords().empty());
+}
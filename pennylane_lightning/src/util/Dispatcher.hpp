@@ -0,0 +1,198 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines the compile-time identifiers of the gates supported by name, with
+ * their properties and the lookup from gate names.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "Error.hpp"
+
+namespace Pennylane {
+
+/**
+ * @brief Gates that can be applied to a statevector by identifier. The names
+ * match the PennyLane operation names.
+ */
+enum class GateOperation : uint8_t {
+    PauliX,
+    PauliY,
+    PauliZ,
+    Hadamard,
+    S,
+    T,
+    RX,
+    RY,
+    RZ,
+    PhaseShift,
+    Rot,
+    CNOT,
+    SWAP,
+    CZ,
+    ControlledPhaseShift,
+    CRX,
+    CRY,
+    CRZ,
+    CRot,
+    CSWAP,
+    Toffoli,
+    /// Number of gate operations; not a gate
+    NumGates
+};
+
+namespace Util {
+
+/**
+ * @brief Number of gate operations.
+ */
+constexpr size_t NUM_GATE_OPERATIONS =
+    static_cast<size_t>(GateOperation::NumGates);
+
+/**
+ * @brief Name and number of wires of each gate operation, in enumeration
+ * order.
+ */
+constexpr std::array<std::pair<std::string_view, size_t>, NUM_GATE_OPERATIONS>
+    GATE_PROPERTIES{{{"PauliX", 1},
+                     {"PauliY", 1},
+                     {"PauliZ", 1},
+                     {"Hadamard", 1},
+                     {"S", 1},
+                     {"T", 1},
+                     {"RX", 1},
+                     {"RY", 1},
+                     {"RZ", 1},
+                     {"PhaseShift", 1},
+                     {"Rot", 1},
+                     {"CNOT", 2},
+                     {"SWAP", 2},
+                     {"CZ", 2},
+                     {"ControlledPhaseShift", 2},
+                     {"CRX", 2},
+                     {"CRY", 2},
+                     {"CRZ", 2},
+                     {"CRot", 2},
+                     {"CSWAP", 3},
+                     {"Toffoli", 3}}};
+
+/**
+ * @brief Get the name of a gate operation.
+ *
+ * @param gate_op Gate operation.
+ * @return std::string_view
+ */
+constexpr auto getGateName(GateOperation gate_op) -> std::string_view {
+    return GATE_PROPERTIES[static_cast<size_t>(gate_op)].first;
+}
+
+/**
+ * @brief Get the number of wires a gate operation acts on.
+ *
+ * @param gate_op Gate operation.
+ * @return size_t
+ */
+constexpr auto getGateNumWires(GateOperation gate_op) -> size_t {
+    return GATE_PROPERTIES[static_cast<size_t>(gate_op)].second;
+}
+
+/**
+ * @brief Get the number of parameters of a gate operation.
+ *
+ * @param gate_op Gate operation.
+ * @return size_t
+ */
+constexpr auto getGateNumParams(GateOperation gate_op) -> size_t {
+    switch (gate_op) {
+    case GateOperation::RX:
+    case GateOperation::RY:
+    case GateOperation::RZ:
+    case GateOperation::PhaseShift:
+    case GateOperation::ControlledPhaseShift:
+    case GateOperation::CRX:
+    case GateOperation::CRY:
+    case GateOperation::CRZ:
+        return 1;
+    case GateOperation::Rot:
+    case GateOperation::CRot:
+        return 3;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Indicate whether a gate operation is diagonal in the computational
+ * basis for all parameters.
+ *
+ * @param gate_op Gate operation.
+ * @return bool
+ */
+constexpr auto isDiagonalGate(GateOperation gate_op) -> bool {
+    switch (gate_op) {
+    case GateOperation::PauliZ:
+    case GateOperation::S:
+    case GateOperation::T:
+    case GateOperation::RZ:
+    case GateOperation::PhaseShift:
+    case GateOperation::CZ:
+    case GateOperation::ControlledPhaseShift:
+    case GateOperation::CRZ:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Find the gate operation with the given name, if any.
+ *
+ * @param name Gate name.
+ * @return GateOperation The gate operation, or `GateOperation::NumGates` if
+ * the name is unknown.
+ */
+constexpr auto findGateOperation(std::string_view name) -> GateOperation {
+    for (size_t op = 0; op < NUM_GATE_OPERATIONS; op++) {
+        if (GATE_PROPERTIES[op].first == name) {
+            return static_cast<GateOperation>(op);
+        }
+    }
+    return GateOperation::NumGates;
+}
+
+/**
+ * @brief Get the gate operation with the given name.
+ *
+ * @param name Gate name.
+ * @return GateOperation
+ */
+inline auto lookupGateOperation(std::string_view name) -> GateOperation {
+    const GateOperation gate_op = findGateOperation(name);
+    if (gate_op == GateOperation::NumGates) {
+        const std::string message =
+            "Unsupported gate operation: " + std::string(name);
+        PL_ABORT(message.c_str());
+    }
+    return gate_op;
+}
+
+} // namespace Util
+} // namespace Pennylane
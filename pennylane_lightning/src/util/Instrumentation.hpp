@@ -0,0 +1,173 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines opt-in timing counters for the hot paths of the simulator.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+/// @cond DEV
+#define PL_INSTRUMENT_CONCAT_(a, b) a##b
+#define PL_INSTRUMENT_CONCAT(a, b) PL_INSTRUMENT_CONCAT_(a, b)
+/// @endcond
+
+#if defined(_ENABLE_INSTRUMENTATION)
+/**
+ * @brief Macro that times the rest of the enclosing scope and records it,
+ * with the given number of bytes touched, under the given name. Expands to
+ * nothing, without evaluating its arguments, unless the library is built with
+ * `ENABLE_INSTRUMENTATION`.
+ *
+ * @param name Name of the instrumented operation, convertible to
+ * `std::string_view`.
+ * @param bytes Number of bytes read and written by the operation.
+ */
+#define PL_INSTRUMENT_SCOPE(name, bytes)                                       \
+    const Pennylane::Util::ScopedTimer PL_INSTRUMENT_CONCAT(                   \
+        pl_scoped_timer_, __LINE__)((name), (bytes))
+#else
+#define PL_INSTRUMENT_SCOPE(name, bytes) static_cast<void>(0)
+#endif
+
+namespace Pennylane::Util {
+
+/**
+ * @brief Indicates whether the library records instrumentation counters.
+ */
+#if defined(_ENABLE_INSTRUMENTATION)
+constexpr bool INSTRUMENTATION_ENABLED = true;
+#else
+constexpr bool INSTRUMENTATION_ENABLED = false;
+#endif
+
+/**
+ * @brief Counters of one instrumented operation.
+ */
+struct InstrumentationRecord {
+    /// Number of calls
+    size_t calls = 0;
+    /// Cumulative wall time of the calls in nanoseconds
+    uint64_t nanoseconds = 0;
+    /// Cumulative number of bytes read and written by the calls
+    uint64_t bytes = 0;
+};
+
+/**
+ * @brief Process-wide registry of the instrumentation counters, keyed by
+ * operation name. Recording is thread-safe.
+ */
+class Instrumentation {
+  private:
+    mutable std::mutex mutex_;
+    std::map<std::string, InstrumentationRecord, std::less<>> records_;
+
+    Instrumentation() = default;
+
+  public:
+    Instrumentation(const Instrumentation &) = delete;
+    Instrumentation &operator=(const Instrumentation &) = delete;
+
+    /**
+     * @brief Get the registry.
+     *
+     * @return Instrumentation&
+     */
+    static auto getInstance() -> Instrumentation & {
+        static Instrumentation instance;
+        return instance;
+    }
+
+    /**
+     * @brief Add one call to the counters of an operation.
+     *
+     * @param name Name of the operation.
+     * @param nanoseconds Wall time of the call.
+     * @param bytes Number of bytes read and written by the call.
+     */
+    void record(std::string_view name, uint64_t nanoseconds, uint64_t bytes) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        auto it = records_.find(name);
+        if (it == records_.end()) {
+            it = records_.emplace(std::string(name), InstrumentationRecord{})
+                     .first;
+        }
+        it->second.calls++;
+        it->second.nanoseconds += nanoseconds;
+        it->second.bytes += bytes;
+    }
+
+    /**
+     * @brief Get a copy of the counters of every recorded operation.
+     *
+     * @return std::map<std::string, InstrumentationRecord>
+     */
+    [[nodiscard]] auto getRecords() const
+        -> std::map<std::string, InstrumentationRecord, std::less<>> {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return records_;
+    }
+
+    /**
+     * @brief Clear all counters.
+     */
+    void reset() {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        records_.clear();
+    }
+};
+
+/**
+ * @brief Records the lifetime of the object as one call of an operation.
+ */
+class ScopedTimer {
+  private:
+    std::string_view name_;
+    uint64_t bytes_;
+    std::chrono::steady_clock::time_point start_;
+
+  public:
+    /**
+     * @brief Start timing a call.
+     *
+     * @param name Name of the operation. Must outlive the timer.
+     * @param bytes Number of bytes read and written by the call.
+     */
+    ScopedTimer(std::string_view name, uint64_t bytes)
+        : name_{name}, bytes_{bytes}, start_{std::chrono::steady_clock::now()} {
+    }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    ~ScopedTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        Instrumentation::getInstance().record(
+            name_, static_cast<uint64_t>(
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           elapsed)
+                           .count()),
+            bytes_);
+    }
+};
+
+} // namespace Pennylane::Util
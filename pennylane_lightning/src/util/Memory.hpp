@@ -0,0 +1,184 @@
+// Copyright 2021 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines allocator policies for statevector storage.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace Pennylane::Util {
+
+/**
+ * @brief Size of a transparent huge page on common Linux systems.
+ */
+constexpr size_t HUGE_PAGE_SIZE = 2U * 1024U * 1024U;
+
+/**
+ * @brief Allocator returning aligned memory whose elements are not touched on
+ * value-initialization.
+ *
+ * Containers using this allocator leave trivially copyable elements
+ * uninitialized when resized or sized on construction, so that the owner can
+ * write them from the threads that later work on them (first-touch NUMA
+ * placement). `%StateVectorManaged` does this with OpenMP.
+ *
+ * @tparam T Element type.
+ * @tparam Alignment Alignment of every allocation in bytes. Must be a power of
+ * two.
+ * @tparam HugePages Align allocations of at least `HUGE_PAGE_SIZE` bytes to
+ * huge pages and ask the kernel to back them with transparent huge pages. This
+ * is a no-op outside Linux.
+ */
+template <class T, size_t Alignment = 64, bool HugePages = false>
+class AlignedAllocator {
+    static_assert((Alignment & (Alignment - 1)) == 0 &&
+                      Alignment >= alignof(T),
+                  "Alignment must be a power of two of at least alignof(T).");
+
+  public:
+    using value_type = T;
+
+    /**
+     * @brief Indicates that value-initialization leaves elements untouched.
+     */
+    static constexpr bool first_touch = true;
+
+    template <class U> struct rebind {
+        using other = AlignedAllocator<U, Alignment, HugePages>;
+    };
+
+    AlignedAllocator() noexcept = default;
+    template <class U>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    AlignedAllocator(
+        [[maybe_unused]] const AlignedAllocator<U, Alignment, HugePages>
+            &other) noexcept {}
+
+    /**
+     * @brief Allocate aligned memory for `size` elements.
+     */
+    [[nodiscard]] auto allocate(size_t size) -> T * {
+        if (size == 0) {
+            return nullptr;
+        }
+        size_t alignment = Alignment;
+        if constexpr (HugePages) {
+            if (size * sizeof(T) >= HUGE_PAGE_SIZE) {
+                alignment = HUGE_PAGE_SIZE;
+            }
+        }
+        // aligned_alloc requires the size to be a multiple of the alignment
+        const size_t bytes =
+            ((size * sizeof(T) + alignment - 1) / alignment) * alignment;
+#if defined(_MSC_VER)
+        void *ptr = _aligned_malloc(bytes, alignment);
+#else
+        void *ptr = std::aligned_alloc(alignment, bytes);
+#endif
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if constexpr (HugePages) {
+            if (alignment == HUGE_PAGE_SIZE) {
+                // Advisory only, so a failure is not an error
+                madvise(ptr, bytes, MADV_HUGEPAGE);
+            }
+        }
+#endif
+        return static_cast<T *>(ptr);
+    }
+
+    /**
+     * @brief Free memory obtained from `allocate`.
+     */
+    void deallocate(T *ptr, [[maybe_unused]] size_t size) noexcept {
+#if defined(_MSC_VER)
+        _aligned_free(ptr);
+#else
+        std::free(ptr); // NOLINT(cppcoreguidelines-no-malloc)
+#endif
+    }
+
+    /**
+     * @brief Value-initialize an element. Trivially copyable elements are
+     * left untouched.
+     */
+    template <class U> void construct(U *ptr) {
+        if constexpr (!(std::is_trivially_copyable_v<U> &&
+                        std::is_trivially_destructible_v<U>)) {
+            ::new (static_cast<void *>(ptr)) U();
+        }
+    }
+
+    /**
+     * @brief Construct an element from the given arguments.
+     */
+    template <class U, class... Args> void construct(U *ptr, Args &&...args) {
+        ::new (static_cast<void *>(ptr)) U(std::forward<Args>(args)...);
+    }
+
+    template <class U>
+    auto operator==(
+        [[maybe_unused]] const AlignedAllocator<U, Alignment, HugePages> &other)
+        const noexcept -> bool {
+        return true;
+    }
+    template <class U>
+    auto operator!=(
+        [[maybe_unused]] const AlignedAllocator<U, Alignment, HugePages> &other)
+        const noexcept -> bool {
+        return false;
+    }
+};
+
+/**
+ * @brief Aligned allocator backed by transparent huge pages where available.
+ */
+template <class T>
+using HugePageAllocator = AlignedAllocator<T, 64, true>;
+
+/// @cond DEV
+template <class Allocator, class = void>
+struct is_first_touch_allocator : std::false_type {};
+template <class Allocator>
+struct is_first_touch_allocator<Allocator,
+                                std::void_t<decltype(Allocator::first_touch)>>
+    : std::bool_constant<Allocator::first_touch> {};
+/// @endcond
+
+/**
+ * @brief Whether containers using the allocator leave value-initialized
+ * elements untouched.
+ */
+template <class Allocator>
+constexpr bool is_first_touch_allocator_v =
+    is_first_touch_allocator<Allocator>::value;
+
+} // namespace Pennylane::Util
@@ -17,7 +17,9 @@
  */
 #pragma once
 
+#include <bitset>
 #include <cassert>
+#include <climits>
 #include <cmath>
 #include <complex>
 #include <cstddef>
@@ -30,6 +32,10 @@
 #include <type_traits>
 #include <vector>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 /// @cond DEV
 #if __has_include(<cblas.h>) && defined _ENABLE_BLAS
 #include <cblas.h>
@@ -194,6 +200,56 @@ inline auto maxDecimalForQubit(size_t qubitIndex, size_t qubits) -> size_t {
     return exp2(qubits - qubitIndex - 1);
 }
 
+/**
+ * @brief Returns a mask with the `pos` least significant bits set.
+ *
+ * @param pos Number of trailing ones.
+ * @return size_t
+ */
+inline constexpr auto fillTrailingOnes(size_t pos) -> size_t {
+    return (pos == 0) ? 0
+                      : (~static_cast<size_t>(0) >>
+                         (CHAR_BIT * sizeof(size_t) - pos));
+}
+
+/**
+ * @brief Returns a mask with all bits set from position `pos` upwards.
+ *
+ * @param pos Position of the lowest set bit.
+ * @return size_t
+ */
+inline constexpr auto fillLeadingOnes(size_t pos) -> size_t {
+    return ~fillTrailingOnes(pos);
+}
+
+/**
+ * @brief Returns the number of set bits in `value`.
+ *
+ * @param value Bit pattern.
+ * @return size_t
+ */
+inline auto popcount(size_t value) -> size_t {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_popcountll(value));
+#else
+    return std::bitset<CHAR_BIT * sizeof(size_t)>(value).count();
+#endif
+}
+
+/**
+ * @brief Returns the maximum number of threads available to OpenMP parallel
+ * regions, honouring `OMP_NUM_THREADS`. Returns 1 when built without OpenMP.
+ *
+ * @return size_t
+ */
+inline auto getMaxNumThreads() -> size_t {
+#if defined(_OPENMP)
+    return static_cast<size_t>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
 /**
  * @brief Returns the number of wires supported by a given qubit gate.
  *
@@ -218,25 +274,66 @@ template <class T> inline auto dimSize(const std::vector<T> &data) -> size_t {
     return static_cast<size_t>(log2(s_sqrt));
 }
 
+/**
+ * @brief Floating-point type of the sums over the amplitudes of a statevector
+ * of precision `T`. Single-precision sums are accumulated in double precision,
+ * which keeps their error independent of the number of amplitudes.
+ *
+ * @tparam T Floating point precision type.
+ */
+template <class T> struct accumulator { using type = T; };
+/// @cond DEV
+template <> struct accumulator<float> { using type = double; };
+/// @endcond
+
+/**
+ * @brief Accumulation type of precision `T`.
+ *
+ * @see accumulator
+ */
+template <class T> using accumulator_t = typename accumulator<T>::type;
+
+/**
+ * @brief Complex product of two amplitudes of precision `T` in the
+ * accumulation precision.
+ *
+ * @tparam ConjLeft Conjugate the left amplitude.
+ */
+template <class T, bool ConjLeft>
+inline auto accumulateMult(std::complex<T> a, std::complex<T> b)
+    -> std::complex<accumulator_t<T>> {
+    using AccT = accumulator_t<T>;
+    const std::complex<AccT> a_acc(a);
+    if constexpr (ConjLeft) {
+        return ConstMultConj(a_acc, std::complex<AccT>(b));
+    } else {
+        return ConstMult(a_acc, std::complex<AccT>(b));
+    }
+}
+
 /**
  * @brief Calculates the inner-product using OpenMP.
  *
  * @tparam T Floating point precision type.
+ * @tparam ConjLeft Conjugate the first dataset.
  * @tparam NTERMS Number of terms proceeds by each thread
  * @param v1 Complex data array 1.
  * @param v2 Complex data array 2.
- * @param result Calculated inner-product of v1 and v2.
+ * @param result Calculated inner-product of v1 and v2, in the accumulation
+ * precision of `T`.
  * @param data_size Size of data arrays.
  */
-template <class T,
+template <class T, bool ConjLeft = false,
           size_t NTERMS = (1 << 19)> // NOLINT(readability-magic-numbers)
-inline static void
-omp_innerProd(const std::complex<T> *v1, const std::complex<T> *v2,
-              std::complex<T> &result, const size_t data_size) {
+inline static void omp_innerProd(const std::complex<T> *v1,
+                                 const std::complex<T> *v2,
+                                 std::complex<accumulator_t<T>> &result,
+                                 const size_t data_size) {
 #if defined(_OPENMP)
+    using AccT = accumulator_t<T>;
 #pragma omp declare \
-            reduction (sm:std::complex<T>:omp_out=ConstSum(omp_out, omp_in)) \
-            initializer(omp_priv=std::complex<T> {0, 0})
+            reduction (sm:std::complex<AccT>:omp_out=ConstSum(omp_out, omp_in)) \
+            initializer(omp_priv=std::complex<AccT> {0, 0})
 #endif
 
 #if defined(_OPENMP)
@@ -252,81 +349,76 @@ omp_innerProd(const std::complex<T> *v1, const std::complex<T> *v2,
                                         : result)
 #endif
     for (size_t i = 0; i < data_size; i++) {
-        result = ConstSum(result, ConstMult(*(v1 + i), *(v2 + i)));
+        result =
+            ConstSum(result, accumulateMult<T, ConjLeft>(*(v1 + i), *(v2 + i)));
     }
 }
 
 /**
- * @brief Calculates the inner-product using the best available method.
+ * @brief Calculates the inner-product using OpenMP.
+ * with the the first dataset conjugated.
  *
- * @tparam T Floating point precision type.
- * @tparam STD_CROSSOVER Threshold for using OpenMP method
- * @param v1 Complex data array 1.
- * @param v2 Complex data array 2.
- * @param data_size Size of data arrays.
- * @return std::complex<T> Result of inner product operation.
+ * @see omp_innerProd
  */
 template <class T,
-          size_t STD_CROSSOVER = (1 << 20)> // NOLINT(readability-magic-numbers)
-inline auto innerProd(const std::complex<T> *v1, const std::complex<T> *v2,
-                      const size_t data_size) -> std::complex<T> {
-    std::complex<T> result(0, 0);
+          size_t NTERMS = (1 << 19)> // NOLINT(readability-magic-numbers)
+inline static void omp_innerProdC(const std::complex<T> *v1,
+                                  const std::complex<T> *v2,
+                                  std::complex<accumulator_t<T>> &result,
+                                  const size_t data_size) {
+    omp_innerProd<T, true, NTERMS>(v1, v2, result, data_size);
+}
 
-    if constexpr (USE_CBLAS) {
-        if constexpr (std::is_same_v<T, float>) {
-            cblas_cdotu_sub(data_size, v1, 1, v2, 1, &result);
-        } else if constexpr (std::is_same_v<T, double>) {
-            cblas_zdotu_sub(data_size, v1, 1, v2, 1, &result);
-        }
+/// @cond DEV
+namespace Internal {
+/**
+ * @brief Inner product without BLAS, accumulated in the accumulation
+ * precision of `T` and rounded to `T`.
+ */
+template <class T, bool ConjLeft, size_t STD_CROSSOVER>
+inline auto innerProdAccumulated(const std::complex<T> *v1,
+                                 const std::complex<T> *v2,
+                                 const size_t data_size) -> std::complex<T> {
+    using AccT = accumulator_t<T>;
+    std::complex<AccT> result(0, 0);
+    if (data_size < STD_CROSSOVER) {
+        result = std::inner_product(v1, v1 + data_size, v2,
+                                    std::complex<AccT>(), ConstSum<AccT>,
+                                    accumulateMult<T, ConjLeft>);
     } else {
-        if (data_size < STD_CROSSOVER) {
-            result = std::inner_product(
-                v1, v1 + data_size, v2, std::complex<T>(), ConstSum<T>,
-                static_cast<std::complex<T> (*)(
-                    std::complex<T>, std::complex<T>)>(&ConstMult<T>));
-        } else {
-            omp_innerProd(v1, v2, result, data_size);
-        }
+        omp_innerProd<T, ConjLeft>(v1, v2, result, data_size);
     }
-    return result;
+    return {static_cast<T>(std::real(result)),
+            static_cast<T>(std::imag(result))};
 }
+} // namespace Internal
+/// @endcond
 
 /**
- * @brief Calculates the inner-product using OpenMP.
- * with the the first dataset conjugated.
+ * @brief Calculates the inner-product using the best available method.
+ *
+ * Double-precision products use BLAS when available. Single-precision
+ * products are accumulated in double precision, which the BLAS `cdotu` does
+ * not do, so they never use BLAS.
  *
  * @tparam T Floating point precision type.
- * @tparam NTERMS Number of terms proceeds by each thread
+ * @tparam STD_CROSSOVER Threshold for using OpenMP method
  * @param v1 Complex data array 1.
  * @param v2 Complex data array 2.
- * @param result Calculated inner-product of v1 and v2.
  * @param data_size Size of data arrays.
+ * @return std::complex<T> Result of inner product operation.
  */
 template <class T,
-          size_t NTERMS = (1 << 19)> // NOLINT(readability-magic-numbers)
-inline static void
-omp_innerProdC(const std::complex<T> *v1, const std::complex<T> *v2,
-               std::complex<T> &result, const size_t data_size) {
-#if defined(_OPENMP)
-#pragma omp declare \
-            reduction (sm:std::complex<T>:omp_out=ConstSum(omp_out, omp_in)) \
-            initializer(omp_priv=std::complex<T> {0, 0})
-#endif
-
-#if defined(_OPENMP)
-    size_t nthreads = data_size / NTERMS;
-    if (nthreads < 1) {
-        nthreads = 1;
-    }
-#endif
-
-#if defined(_OPENMP)
-#pragma omp parallel for num_threads(nthreads) default(none)                   \
-    shared(v1, v2, data_size) reduction(sm                                     \
-                                        : result)
-#endif
-    for (size_t i = 0; i < data_size; i++) {
-        result = ConstSum(result, ConstMultConj(*(v1 + i), *(v2 + i)));
+          size_t STD_CROSSOVER = (1 << 20)> // NOLINT(readability-magic-numbers)
+inline auto innerProd(const std::complex<T> *v1, const std::complex<T> *v2,
+                      const size_t data_size) -> std::complex<T> {
+    if constexpr (USE_CBLAS && std::is_same_v<T, double>) {
+        std::complex<T> result(0, 0);
+        cblas_zdotu_sub(data_size, v1, 1, v2, 1, &result);
+        return result;
+    } else {
+        return Internal::innerProdAccumulated<T, false, STD_CROSSOVER>(
+            v1, v2, data_size);
     }
 }
 
@@ -334,6 +426,9 @@ omp_innerProdC(const std::complex<T> *v1, const std::complex<T> *v2,
  * @brief Calculates the inner-product using the best available method
  * with the first dataset conjugated.
  *
+ * @see innerProd(const std::complex<T> *v1, const std::complex<T> *v2,
+ * const size_t data_size) for the accumulation precision.
+ *
  * @tparam T Floating point precision type.
  * @tparam STD_CROSSOVER Threshold for using OpenMP method
  * @param v1 Complex data array 1; conjugated before application.
@@ -345,24 +440,14 @@ template <class T,
           size_t STD_CROSSOVER = (1 << 20)> // NOLINT(readability-magic-numbers)
 inline auto innerProdC(const std::complex<T> *v1, const std::complex<T> *v2,
                        const size_t data_size) -> std::complex<T> {
-    std::complex<T> result(0, 0);
-
-    if constexpr (USE_CBLAS) {
-        if constexpr (std::is_same_v<T, float>) {
-            cblas_cdotc_sub(data_size, v1, 1, v2, 1, &result);
-        } else if constexpr (std::is_same_v<T, double>) {
-            cblas_zdotc_sub(data_size, v1, 1, v2, 1, &result);
-        }
+    if constexpr (USE_CBLAS && std::is_same_v<T, double>) {
+        std::complex<T> result(0, 0);
+        cblas_zdotc_sub(data_size, v1, 1, v2, 1, &result);
+        return result;
     } else {
-        if (data_size < STD_CROSSOVER) {
-            result =
-                std::inner_product(v1, v1 + data_size, v2, std::complex<T>(),
-                                   ConstSum<T>, ConstMultConj<T>);
-        } else {
-            omp_innerProdC(v1, v2, result, data_size);
-        }
+        return Internal::innerProdAccumulated<T, true, STD_CROSSOVER>(
+            v1, v2, data_size);
     }
-    return result;
 }
 
 /**
@@ -417,7 +502,8 @@ inline static void omp_matrixVecProd(const std::complex<T> *mat,
     size_t col;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) private(row, col)
+#pragma omp parallel default(none) private(row, col)                          \
+    shared(mat, v_in, v_out, m, n, transpose)
 #endif
     {
         if (transpose) {
@@ -586,7 +672,8 @@ inline void omp_matrixMatProd(const std::complex<T> *m_left,
         return;
     }
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(none)                                             \
+    shared(m_left, m_right, m_out, m, n, k, transpose)
 #endif
     {
         size_t row;
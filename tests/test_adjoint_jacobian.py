@@ -20,6 +20,7 @@ import pytest
 import pennylane as qml
 from pennylane import numpy as np
 from pennylane import QNode, qnode
+from scipy.sparse import coo_matrix
 from scipy.stats import unitary_group
 
 
@@ -95,14 +96,14 @@ class TestAdjointJacobian:
     @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
     def test_unsupported_op(self, dev):
         """Test if a QuantumFunctionError is raised for an unsupported operation, i.e.,
-        multi-parameter operations that are not qml.Rot"""
+        multi-parameter operations that are not qml.Rot or qml.CRot"""
 
         with qml.tape.JacobianTape() as tape:
-            qml.CRot(0.1, 0.2, 0.3, wires=[0, 1])
+            qml.U3(0.1, 0.2, 0.3, wires=0)
             qml.expval(qml.PauliZ(0))
 
         with pytest.raises(
-            qml.QuantumFunctionError, match="The CRot operation is not supported using the"
+            qml.QuantumFunctionError, match="The U3 operation is not supported using the"
         ):
             dev.adjoint_jacobian(tape)
 
@@ -117,47 +118,58 @@ class TestAdjointJacobian:
             dev.adjoint_jacobian(tape)
 
     @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
-    def test_proj_unsupported(self, dev):
-        """Test if a QuantumFunctionError is raised for a Projector observable"""
+    @pytest.mark.parametrize(
+        "obs",
+        [
+            qml.Projector([0, 1], wires=[0, 1]),
+            qml.Projector([0], wires=[0]) @ qml.PauliZ(1),
+            qml.Hermitian(np.array([[1, 2j], [-2j, 0]], requires_grad=False), wires=0),
+            qml.Hermitian(np.array([[1, 0], [0, -1]], requires_grad=False), wires=1)
+            @ qml.PauliX(0),
+        ],
+    )
+    def test_projector_and_hermitian_gradient(self, obs, tol, dev):
+        """Tests that the gradients of Projector and Hermitian observables, given to the C++
+        backend as dense matrices, are correct"""
         with qml.tape.JacobianTape() as tape:
+            qml.RX(0.4, wires=0)
             qml.CRX(0.1, wires=[0, 1])
-            qml.expval(qml.Projector([0, 1], wires=[0, 1]))
+            qml.RY(-0.7, wires=1)
+            qml.expval(obs)
 
-        with pytest.raises(
-            qml.QuantumFunctionError, match="differentiation method does not support the Projector"
-        ):
-            dev.adjoint_jacobian(tape)
+        tape.trainable_params = {0, 1, 2}
+        calculated_val = dev.adjoint_jacobian(tape)
+        numeric_val = tape.jacobian(dev, method="numeric")
 
-        with qml.tape.JacobianTape() as tape:
-            qml.CRX(0.1, wires=[0, 1])
-            qml.expval(qml.Projector([0], wires=[0]) @ qml.PauliZ(0))
-
-        with pytest.raises(
-            qml.QuantumFunctionError, match="differentiation method does not support the Projector"
-        ):
-            dev.adjoint_jacobian(tape)
+        assert np.allclose(calculated_val, numeric_val, atol=tol, rtol=0)
 
     @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
-    def test_unsupported_hermitian_expectation(self, dev):
-        obs = np.array([[1, 0], [0, -1]], dtype=np.complex128, requires_grad=False)
-
-        with qml.tape.JacobianTape() as tape:
-            qml.RY(0.1, wires=(0,))
-            qml.expval(qml.Hermitian(obs, wires=(0,)))
-
-        with pytest.raises(
-            qml.QuantumFunctionError, match="Lightning adjoint differentiation method does not"
-        ):
-            dev.adjoint_jacobian(tape)
-
-        with qml.tape.JacobianTape() as tape:
-            qml.RY(0.1, wires=(0,))
-            qml.expval(qml.Hermitian(obs, wires=(0,)) @ qml.PauliZ(wires=1))
-
-        with pytest.raises(
-            qml.QuantumFunctionError, match="Lightning adjoint differentiation method does not"
-        ):
-            dev.adjoint_jacobian(tape)
+    def test_sparse_hamiltonian_gradient(self, tol, dev):
+        """Tests that the gradient of a sparse Hamiltonian over all wires, applied in C++ in CSR
+        format, matches that of the same dense Hermitian matrix"""
+        H = np.array(
+            [[1, 0, 0, 2j], [0, -0.5, 1, 0], [0, 1, 0.3, 0], [-2j, 0, 0, 0]],
+            requires_grad=False,
+        )
+
+        def tape_with(obs):
+            with qml.tape.JacobianTape() as tape:
+                qml.RX(0.4, wires=0)
+                qml.CNOT(wires=[0, 1])
+                qml.RY(-0.7, wires=1)
+                qml.expval(obs)
+            tape.trainable_params = {0, 1}
+            return tape
+
+        sparse_val = dev.adjoint_jacobian(
+            tape_with(qml.SparseHamiltonian(coo_matrix(H), wires=[0, 1]))
+        )
+        dense_val = dev.adjoint_jacobian(tape_with(qml.Hermitian(H, wires=[0, 1])))
+
+        assert np.allclose(sparse_val, dense_val, atol=tol, rtol=0)
+
+        with pytest.raises(ValueError, match="must act on all wires of the device"):
+            dev.adjoint_jacobian(tape_with(qml.SparseHamiltonian(coo_matrix(H), wires=[1, 0])))
 
     @pytest.mark.parametrize("theta", np.linspace(-2 * np.pi, 2 * np.pi, 7))
     @pytest.mark.parametrize("G", [qml.RX, qml.RY, qml.RZ])
@@ -198,6 +210,48 @@ class TestAdjointJacobian:
         numeric_val = fn(qml.execute(tapes, dev, None))
         assert np.allclose(calculated_val, numeric_val[0][2:], atol=tol, rtol=0)
 
+    @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
+    def test_CRot_gradient(self, tol, dev):
+        """Tests that the device gradient of a controlled Euler-angle-parameterized gate, applied
+        without decomposition, is correct."""
+        with qml.tape.JacobianTape() as tape:
+            qml.Hadamard(wires=0)
+            qml.RX(0.3, wires=1)
+            qml.CRot(0.2, -0.7, 1.1, wires=[0, 1]).inv()
+            qml.expval(qml.PauliY(1))
+
+        tape.trainable_params = {0, 2, 3}
+
+        calculated_val = dev.adjoint_jacobian(tape)
+
+        tapes, fn = qml.gradients.finite_diff(tape)
+        numeric_val = fn(qml.execute(tapes, dev, None))
+        assert np.allclose(calculated_val, numeric_val, atol=tol, rtol=0)
+
+    @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
+    def test_registered_generator_gradient(self, tol):
+        """Tests that a gate without a built-in generator is differentiated once its generator is
+        registered."""
+        dev = qml.device("lightning.qubit", wires=2)
+
+        with qml.tape.JacobianTape() as tape:
+            qml.RY(0.4, wires=0)
+            qml.IsingXX(0.9, wires=[0, 1])
+            qml.expval(qml.PauliZ(1))
+
+        with pytest.raises(
+            qml.QuantumFunctionError, match="The IsingXX operation is not supported using the"
+        ):
+            dev.adjoint_jacobian(tape)
+
+        x_x = np.kron(qml.PauliX.matrix, qml.PauliX.matrix)
+        dev.register_adjoint_generator("IsingXX", x_x, -0.5)
+        calculated_val = dev.adjoint_jacobian(tape)
+
+        tapes, fn = qml.gradients.finite_diff(tape)
+        numeric_val = fn(qml.execute(tapes, dev, None))
+        assert np.allclose(calculated_val, numeric_val, atol=tol, rtol=0)
+
     @pytest.mark.parametrize("par", [1, -2, 1.623, -0.051, 0])  # integers, floats, zero
     def test_ry_gradient(self, par, tol, dev):
         """Test that the gradient of the RY gate matches the exact analytic formula."""
@@ -248,6 +302,96 @@ class TestAdjointJacobian:
         expected_jacobian = -np.diag(np.sin(params))
         assert np.allclose(dev_jacobian, expected_jacobian, atol=tol, rtol=0)
 
+    @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
+    def test_vjp(self, tol, dev):
+        """Tests that the vector-Jacobian product matches the product of the cotangent with the
+        Jacobian."""
+        with qml.tape.JacobianTape() as tape:
+            qml.RX(0.4, wires=0)
+            qml.CNOT(wires=[0, 1])
+            qml.Rot(0.2, -0.5, 0.9, wires=1)
+            qml.CRY(0.7, wires=[1, 0])
+            qml.expval(qml.PauliZ(0))
+            qml.expval(qml.PauliX(1))
+            qml.expval(qml.PauliZ(0) @ qml.PauliY(1))
+
+        dy = np.array([0.3, -1.2, 0.8])
+        vjp = dev.adjoint_vjp(tape, dy)
+        jac = dev.adjoint_jacobian(tape)
+        assert np.allclose(vjp, dy @ jac, atol=tol, rtol=0)
+
+        with pytest.raises(ValueError, match="The cotangent has 2 entries for 3 measurements"):
+            dev.adjoint_vjp(tape, dy[:2])
+
+    @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
+    def test_circuit_plan_reused(self, tol, mocker):
+        """Tests that a tape with the same structure and new parameters reuses the serialized
+        circuit and yields the Jacobian of the new parameters."""
+        dev = qml.device("lightning.qubit", wires=2)
+
+        def make_tape(a, b):
+            with qml.tape.JacobianTape() as tape:
+                qml.RX(a, wires=0)
+                qml.CNOT(wires=[0, 1])
+                qml.RY(b, wires=1)
+                qml.expval(qml.PauliZ(1))
+            return tape
+
+        from pennylane_lightning import lightning_qubit
+
+        spy = mocker.spy(lightning_qubit, "_serialize_ops")
+        dev.adjoint_jacobian(make_tape(0.1, 0.2))
+        jac = dev.adjoint_jacobian(make_tape(0.5, -0.3))
+        assert spy.call_count == 1
+
+        fresh_dev = qml.device("lightning.qubit", wires=2)
+        expected = fresh_dev.adjoint_jacobian(make_tape(0.5, -0.3))
+        assert np.allclose(jac, expected, atol=tol, rtol=0)
+
+    def test_multiple_rx_gradient_memory_budget(self, tol):
+        """Tests that differentiating the observables in memory-bounded chunks yields the same
+        result as differentiating them together."""
+        # Budget of three statevectors, so one observable is differentiated at a time
+        dev = qml.device("lightning.qubit", wires=3, adjoint_memory_budget=3 * 16 * 2 ** 3)
+        params = np.array([np.pi, np.pi / 2, np.pi / 3])
+
+        with qml.tape.JacobianTape() as tape:
+            qml.RX(params[0], wires=0)
+            qml.RX(params[1], wires=1)
+            qml.RX(params[2], wires=2)
+
+            for idx in range(3):
+                qml.expval(qml.PauliZ(idx))
+
+        dev_jacobian = dev.adjoint_jacobian(tape)
+        expected_jacobian = -np.diag(np.sin(params))
+        assert np.allclose(dev_jacobian, expected_jacobian, atol=tol, rtol=0)
+
+    @pytest.mark.parametrize("budget", [None, 6 * 16 * 2 ** 3, 2 ** 20])
+    def test_checkpointed_gradient(self, budget, tol):
+        """Tests that the checkpointed parallel backward pass yields the same result as the
+        serial one, for a single observable and with a state preparation."""
+        dev = qml.device("lightning.qubit", wires=3)
+        dev_checkpointed = qml.device(
+            "lightning.qubit", wires=3, adjoint_checkpointing=True, adjoint_memory_budget=budget
+        )
+
+        with qml.tape.JacobianTape() as tape:
+            qml.BasisState(np.array([1, 0, 1]), wires=[0, 1, 2])
+            for layer in range(3):
+                qml.RX(0.3 * layer + 0.1, wires=0)
+                qml.CRY(-0.5 * layer + 0.2, wires=[0, 1])
+                qml.CNOT(wires=[1, 2])
+                qml.RZ(0.7 * layer - 0.4, wires=2)
+                qml.Rot(0.2, -0.3 * layer, 0.5, wires=1)
+            qml.expval(qml.PauliX(0) @ qml.PauliY(2))
+
+        tape.trainable_params = {1, 2, 4, 6, 7, 9, 12, 15}
+
+        expected = dev.adjoint_jacobian(tape)
+        dev_jacobian = dev_checkpointed.adjoint_jacobian(tape)
+        assert np.allclose(dev_jacobian, expected, atol=tol, rtol=0)
+
     qubit_ops = [getattr(qml, name) for name in qml.ops._qubit__ops__]
     ops = {qml.RX, qml.RY, qml.RZ, qml.PhaseShift, qml.CRX, qml.CRY, qml.CRZ, qml.Rot}
 
@@ -334,6 +478,21 @@ class TestAdjointJacobian:
 
         assert np.allclose(dM1, dM2, atol=tol, rtol=0)
 
+    def test_device_state_untouched(self, tol, dev):
+        """Tests that differentiating from the zero state leaves the device state as is."""
+        with qml.tape.JacobianTape() as tape:
+            qml.Hadamard(wires=[0])
+            qml.RY(-0.2, wires=[1])
+            qml.expval(qml.PauliZ(1))
+
+        tape.trainable_params = {0}
+
+        tape.execute(dev)
+        state = dev.state.copy()
+        dev.adjoint_jacobian(tape)
+
+        assert np.allclose(dev.state, state, atol=tol, rtol=0)
+
     def test_provide_starting_state(self, tol, dev):
         """Tests provides correct answer when provided starting state."""
         x, y, z = [0.5, 0.3, -0.7]
@@ -616,13 +775,13 @@ def circuit_ansatz(params, wires):
         qml.PauliZ(0) @ qml.PauliY(3),
         qml.Hadamard(2),
         qml.Hadamard(3) @ qml.PauliZ(2),
-        # qml.Projector([0, 1], wires=[0, 2]) @ qml.Hadamard(3)
-        # qml.Projector([0, 0], wires=[2, 0])
+        qml.Projector([0, 1], wires=[0, 2]) @ qml.Hadamard(3),
+        qml.Projector([0, 0], wires=[2, 0]),
         qml.PauliX(0) @ qml.PauliY(3),
         qml.PauliY(0) @ qml.PauliY(2) @ qml.PauliY(3),
-        # qml.Hermitian(np.kron(qml.PauliY.matrix, qml.PauliZ.matrix), wires=[3, 2]),
-        # qml.Hermitian(np.array([[0,1],[1,0]], requires_grad=False), wires=0),
-        # qml.Hermitian(np.array([[0,1],[1,0]], requires_grad=False), wires=0) @ qml.PauliZ(2),
+        qml.Hermitian(np.kron(qml.PauliY.matrix, qml.PauliZ.matrix), wires=[3, 2]),
+        qml.Hermitian(np.array([[0, 1], [1, 0]], requires_grad=False), wires=0),
+        qml.Hermitian(np.array([[0, 1], [1, 0]], requires_grad=False), wires=0) @ qml.PauliZ(2),
     ],
 )
 def test_integration(returns):
@@ -658,13 +817,18 @@ custom_wires = ["alice", 3.14, -1, 0]
         qml.PauliZ(custom_wires[0]) @ qml.PauliY(custom_wires[3]),
         qml.Hadamard(custom_wires[2]),
         qml.Hadamard(custom_wires[3]) @ qml.PauliZ(custom_wires[2]),
-        # qml.Projector([0, 1], wires=[custom_wires[0], custom_wires[2]]) @ qml.Hadamard(custom_wires[3])
-        # qml.Projector([0, 0], wires=[custom_wires[2], custom_wires[0]])
+        qml.Projector([0, 1], wires=[custom_wires[0], custom_wires[2]])
+        @ qml.Hadamard(custom_wires[3]),
+        qml.Projector([0, 0], wires=[custom_wires[2], custom_wires[0]]),
         qml.PauliX(custom_wires[0]) @ qml.PauliY(custom_wires[3]),
         qml.PauliY(custom_wires[0]) @ qml.PauliY(custom_wires[2]) @ qml.PauliY(custom_wires[3]),
-        # qml.Hermitian(np.array([[0,1],[1,0]], requires_grad=False), wires=custom_wires[0]),
-        # qml.Hermitian(np.kron(qml.PauliY.matrix, qml.PauliZ.matrix), wires=[custom_wires[3], custom_wires[2]]),
-        # qml.Hermitian(np.array([[0,1],[1,0]], requires_grad=False), wires=custom_wires[0]) @ qml.PauliZ(custom_wires[2]),
+        qml.Hermitian(np.array([[0, 1], [1, 0]], requires_grad=False), wires=custom_wires[0]),
+        qml.Hermitian(
+            np.kron(qml.PauliY.matrix, qml.PauliZ.matrix),
+            wires=[custom_wires[3], custom_wires[2]],
+        ),
+        qml.Hermitian(np.array([[0, 1], [1, 0]], requires_grad=False), wires=custom_wires[0])
+        @ qml.PauliZ(custom_wires[2]),
     ],
 )
 def test_integration_custom_wires(returns):
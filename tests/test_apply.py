@@ -371,6 +371,113 @@ class TestApply:
 
         assert np.allclose(qubit_device_2_wires.state, np.array(expected_output), atol=tol, rtol=0)
 
+    @pytest.mark.parametrize("fusion_width", [1, 2, 3])
+    def test_apply_fused_operations(self, tol, fusion_width):
+        """Tests that fusing consecutive gates yields the same state as applying them one by
+        one, including around operations that fall back to a matrix."""
+        ops = [
+            qml.RX(0.312, wires=0),
+            qml.CNOT(wires=[0, 1]),
+            qml.RY(-1.27, wires=2).inv(),
+            qml.CRot(0.1, -0.4, 1.3, wires=[2, 0]),
+            qml.QubitUnitary(qml.Hadamard(wires=1).matrix, wires=1),
+            qml.Toffoli(wires=[1, 2, 0]),
+            qml.RZ(0.85, wires=1),
+        ]
+
+        dev = LightningQubit(wires=3)
+        dev.apply(ops)
+        dev_fused = LightningQubit(wires=3, fusion_width=fusion_width)
+        dev_fused.apply(ops)
+
+        assert np.allclose(dev_fused.state, dev.state, atol=tol, rtol=0)
+
+    @pytest.mark.parametrize("chunk_size", [1, 2, 5])
+    def test_apply_op_stream_chunks(self, tol, monkeypatch, chunk_size):
+        """Tests that operations submitted in several chunks, each applied asynchronously while
+        the next is packed, yield the same state as ``default.qubit``."""
+        ops = [
+            qml.Hadamard(wires=0),
+            qml.RX(0.312, wires=1),
+            qml.CNOT(wires=[0, 2]),
+            qml.QubitUnitary(qml.RY(0.4, wires=2).matrix, wires=2),
+            qml.CRot(0.1, -0.4, 1.3, wires=[2, 0]),
+            qml.PhaseShift(0.7, wires=1).inv(),
+            qml.MultiRZ(0.5, wires=[0, 1]),
+            qml.Toffoli(wires=[1, 2, 0]),
+        ]
+
+        dev_def = qml.device("default.qubit", wires=3)
+        dev_def.apply(ops)
+        monkeypatch.setattr("pennylane_lightning.lightning_qubit.OP_STREAM_CHUNK_SIZE", chunk_size)
+        dev = LightningQubit(wires=3, fusion_width=2)
+        dev.apply(ops)
+
+        assert np.allclose(dev.state, dev_def.state, atol=tol, rtol=0)
+
+    @pytest.mark.parametrize("cache_block_qubits", [1, 2, 3])
+    def test_apply_cache_blocked_operations(self, tol, cache_block_qubits):
+        """Tests that applying gates with cache blocking yields the same state as applying
+        them one by one, including gates on high-order wires and wider than a block."""
+        ops = [
+            qml.RX(0.312, wires=0),
+            qml.CNOT(wires=[0, 3]),
+            qml.RY(-1.27, wires=2).inv(),
+            qml.CRot(0.1, -0.4, 1.3, wires=[3, 1]),
+            qml.QubitUnitary(qml.Hadamard(wires=1).matrix, wires=1),
+            qml.Toffoli(wires=[1, 2, 0]),
+            qml.RZ(0.85, wires=1),
+            qml.SWAP(wires=[0, 2]),
+        ]
+
+        dev = LightningQubit(wires=4)
+        dev.apply(ops)
+        dev_blocked = LightningQubit(wires=4, cache_block_qubits=cache_block_qubits)
+        dev_blocked.apply(ops)
+
+        assert np.allclose(dev_blocked.state, dev.state, atol=tol, rtol=0)
+
+    @pytest.mark.parametrize("reorder_qubits", [1, 2, 4])
+    def test_apply_reordered_operations(self, tol, reorder_qubits):
+        """Tests that applying gates with wire reordering yields the same state as applying them
+        in wire order, with most gates acting on the high-order wires."""
+        ops = [qml.Hadamard(wires=3)]
+        for angle in [0.312, -1.27, 0.85, 0.4, 2.1, -0.6]:
+            ops += [
+                qml.RX(angle, wires=0),
+                qml.CRY(-angle, wires=[1, 0]),
+                qml.CNOT(wires=[0, 3]),
+            ]
+        ops += [qml.Toffoli(wires=[1, 2, 0]), qml.SWAP(wires=[0, 2])]
+
+        dev = LightningQubit(wires=4)
+        dev.apply(ops)
+        dev_reordered = LightningQubit(wires=4, reorder_qubits=reorder_qubits)
+        dev_reordered.apply(ops)
+
+        assert np.allclose(dev_reordered.state, dev.state, atol=tol, rtol=0)
+
+    @pytest.mark.parametrize("wires", [None, [0], [2, 0], [1, 2, 0]])
+    def test_analytic_probability(self, qubit_device_3_wires, tol, wires):
+        """Tests that the marginal probabilities computed in C++ match default.qubit"""
+        ops = [
+            qml.RX(0.312, wires=0),
+            qml.CNOT(wires=[0, 1]),
+            qml.RY(-1.27, wires=2),
+            qml.CRZ(0.85, wires=[2, 1]),
+            qml.Hadamard(wires=1),
+        ]
+        dev_default = qml.device("default.qubit", wires=3)
+        dev_default.apply(ops)
+        qubit_device_3_wires.apply(ops)
+
+        assert np.allclose(
+            qubit_device_3_wires.analytic_probability(wires),
+            dev_default.analytic_probability(wires),
+            atol=tol,
+            rtol=0,
+        )
+
     def test_apply_errors_qubit_state_vector(self, qubit_device_2_wires):
         """Test that apply fails for incorrect state preparation, and > 2 qubit gates"""
         with pytest.raises(ValueError, match="Sum of amplitudes-squared does not equal one."):
@@ -573,6 +680,25 @@ class TestSample:
         # they square to 1
         assert np.allclose(s1 ** 2, 1, atol=tol, rtol=0)
 
+    def test_generate_samples_distribution(self, qubit_device_3_wires):
+        """Tests that the samples drawn in C++ follow the state distribution and are
+        reproducible from the NumPy seed"""
+        qubit_device_3_wires.reset()
+        qubit_device_3_wires.shots = 100000
+        qubit_device_3_wires.apply(
+            [qml.RX(0.7, wires=0), qml.Hadamard(wires=1), qml.CNOT(wires=[1, 2])]
+        )
+
+        np.random.seed(42)
+        samples = qubit_device_3_wires.generate_samples()
+        np.random.seed(42)
+        assert np.array_equal(samples, qubit_device_3_wires.generate_samples())
+        assert samples.shape == (100000, 3)
+
+        indices = samples @ np.array([4, 2, 1])
+        freqs = np.bincount(indices, minlength=8) / 100000
+        assert np.allclose(freqs, qubit_device_3_wires.analytic_probability(), atol=0.01)
+
 
 class TestLightningQubitIntegration:
     """Integration tests for lightning.qubit. This test ensures it integrates
@@ -1261,6 +1387,145 @@ class TestTensorSample:
         assert np.allclose(var, expected, atol=tolerance, rtol=0)
 
 
+@pytest.mark.skipif(not CPP_BINARY_AVAILABLE, reason="Lightning binary required")
+class TestPersistentState:
+    """Tests for the C++ statevector kept by the device across executions"""
+
+    def test_state_is_view(self):
+        """Test that the device state is a view of the C++ statevector, that resetting keeps its
+        storage and that executions write into it"""
+        dev = qml.device("lightning.qubit", wires=3)
+        buffer = np.asarray(dev._sim)
+        assert np.shares_memory(dev._state, buffer)
+
+        with qml.tape.QuantumTape() as tape:
+            qml.Hadamard(wires=0)
+            qml.CNOT(wires=[0, 2])
+            qml.expval(qml.PauliZ(2))
+
+        for _ in range(2):
+            dev.reset()
+            assert np.shares_memory(dev._state, buffer)
+            assert np.allclose(buffer, np.eye(1, 8))
+            dev.execute(tape)
+            assert np.shares_memory(dev._state, buffer)
+
+        expected = np.zeros(8)
+        expected[[0, 5]] = 1 / np.sqrt(2)
+        assert np.allclose(buffer, expected)
+
+    def test_state_is_copied(self, tol):
+        """Test that the returned state is not overwritten by later executions"""
+        dev = qml.device("lightning.qubit", wires=2)
+
+        @qml.qnode(dev)
+        def circuit(x):
+            qml.RX(x, wires=0)
+            return qml.state()
+
+        state = circuit(0.4)
+        circuit(1.3)
+        assert np.allclose(state, [np.cos(0.2), 0, -1j * np.sin(0.2), 0], atol=tol, rtol=0)
+
+    def test_pre_rotated_snapshot(self, tol):
+        """Test that rotations keep the pre-rotated state in the snapshot buffer"""
+        dev = qml.device("lightning.qubit", wires=2)
+        dev.apply([qml.RY(0.6, wires=0), qml.CNOT(wires=[0, 1])], rotations=[qml.Hadamard(0)])
+
+        pre_rotated = np.array([np.cos(0.3), 0, 0, np.sin(0.3)])
+        rotated = np.array([np.cos(0.3), np.sin(0.3), np.cos(0.3), -np.sin(0.3)]) / np.sqrt(2)
+        assert np.allclose(np.ravel(dev._pre_rotated_state), pre_rotated, atol=tol, rtol=0)
+        assert np.allclose(np.ravel(dev._state), rotated, atol=tol, rtol=0)
+        assert np.shares_memory(dev._pre_rotated_state, dev._sim.getSnapshot())
+
+        dev._sim.restoreSnapshot()
+        assert np.allclose(np.asarray(dev._sim), pre_rotated, atol=tol, rtol=0)
+
+    def test_no_snapshot(self):
+        """Test that restoring without a snapshot raises an error"""
+        dev = qml.device("lightning.qubit", wires=2)
+        with pytest.raises(RuntimeError, match="No snapshot was saved"):
+            dev._sim.restoreSnapshot()
+
+
+class TestSinglePrecision:
+    """Tests for the device running in single precision"""
+
+    def circuit(self, x, y):
+        qml.RX(x, wires=0)
+        qml.RY(y, wires=1)
+        qml.CNOT(wires=[0, 2])
+        qml.CRZ(y, wires=[2, 1])
+        qml.Hadamard(wires=1)
+        qml.QubitUnitary(np.array([[0, 1], [1, 0]]), wires=2)
+        return qml.expval(qml.PauliZ(0) @ qml.PauliX(1)), qml.expval(qml.PauliY(2))
+
+    def test_state_precision(self):
+        """Test that the C++ statevector and the device state are single precision"""
+        dev = qml.device("lightning.qubit", wires=3, c_dtype=np.complex64)
+        assert dev.C_DTYPE is np.complex64
+        assert dev.R_DTYPE is np.float32
+        assert np.asarray(dev._sim).dtype == np.complex64
+
+        dev.apply([qml.Hadamard(wires=0), qml.CNOT(wires=[0, 1])])
+        assert dev._state.dtype == np.complex64
+        assert np.shares_memory(dev._state, np.asarray(dev._sim))
+
+    def test_execution_matches_double(self):
+        """Test that expectation values, variances and probabilities agree with double
+        precision"""
+        results = []
+        for c_dtype in (np.complex64, np.complex128):
+            dev = qml.device("lightning.qubit", wires=3, c_dtype=c_dtype)
+
+            @qml.qnode(dev)
+            def circuit(x, y):
+                self.circuit(x, y)
+                qml.Hadamard(wires=2)
+                return (
+                    qml.expval(qml.PauliZ(0) @ qml.PauliX(1)),
+                    qml.var(qml.PauliY(2)),
+                    qml.probs(wires=[0, 2]),
+                )
+
+            results.append(np.hstack(circuit(0.4, -0.7)))
+        assert np.allclose(results[0], results[1], atol=1e-6, rtol=0)
+
+    def test_adjoint_matches_double(self):
+        """Test that the adjoint method agrees with double precision, also with a state
+        preparation"""
+        jacs = []
+        for c_dtype in (np.complex64, np.complex128):
+            dev = qml.device("lightning.qubit", wires=3, c_dtype=c_dtype)
+
+            with qml.tape.QuantumTape() as tape:
+                qml.QubitStateVector(np.ones(4) / 2, wires=[1, 2])
+                self.circuit(0.4, -0.7)
+            tape.trainable_params = {1, 2, 4}
+
+            jacs.append(dev.adjoint_jacobian(tape))
+        assert jacs[0].dtype == np.float32
+        assert np.allclose(jacs[0], jacs[1], atol=1e-5, rtol=0)
+
+    def test_batch_expval_matches_double(self):
+        """Test that batched execution agrees with double precision"""
+        results = []
+        for c_dtype in (np.complex64, np.complex128):
+            dev = qml.device("lightning.qubit", wires=3, c_dtype=c_dtype)
+
+            with qml.tape.QuantumTape() as tape:
+                self.circuit(0.4, -0.7)
+
+            params = np.array([[0.4, -0.7, -0.7], [1.2, 0.3, 0.3]])
+            results.append(dev.batch_expval(tape, params))
+        assert np.allclose(results[0], results[1], atol=1e-6, rtol=0)
+
+    def test_unsupported_dtype(self):
+        """Test that an unsupported complex type raises an error"""
+        with pytest.raises(TypeError, match="Unsupported complex type"):
+            qml.device("lightning.qubit", wires=2, c_dtype=np.float64)
+
+
 def test_warning():
     """Tests if a warning is raised when lightning.qubit binaries are not available"""
     if CPP_BINARY_AVAILABLE:
@@ -0,0 +1,90 @@
+# Copyright 2021 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Tests for the ``batch_expval`` method of the :mod:`pennylane_lightning.LightningQubit` device.
+"""
+import pytest
+
+import numpy as np
+import pennylane as qml
+
+
+class TestBatchExpval:
+    """Tests for the batch_expval method"""
+
+    @pytest.fixture
+    def dev(self):
+        return qml.device("lightning.qubit", wires=3)
+
+    def test_not_expval(self, dev):
+        """Test that a QuantumFunctionError is raised for measurements that are not expectation
+        values"""
+        with qml.tape.QuantumTape() as tape:
+            qml.RX(0.1, wires=0)
+            qml.var(qml.PauliZ(0))
+
+        with pytest.raises(qml.QuantumFunctionError, match="Batched execution does not support"):
+            dev.batch_expval(tape, [[0.1]])
+
+    def test_invalid_parameters(self, dev):
+        """Test that an error is raised if a parameter set does not match the operations"""
+        with qml.tape.QuantumTape() as tape:
+            qml.RX(0.1, wires=0)
+            qml.expval(qml.PauliZ(0))
+
+        with pytest.raises(RuntimeError, match="Each parameter set must provide"):
+            dev.batch_expval(tape, [[0.1, 0.2]])
+
+    def test_matches_execute(self, dev, tol):
+        """Test that every batch member matches executing the tape with its parameters"""
+        U = qml.Hadamard(wires=0).matrix
+
+        def circuit(x, y, z):
+            qml.BasisState(np.array([0, 1, 0]), wires=[0, 1, 2])
+            qml.RX(x, wires=0)
+            qml.CNOT(wires=[0, 1])
+            qml.QubitUnitary(U, wires=2)
+            qml.Rot(x, y, z, wires=1)
+            qml.CRY(z, wires=[1, 2])
+            return qml.expval(qml.PauliZ(0)), qml.expval(qml.PauliY(1) @ qml.PauliX(2))
+
+        with qml.tape.QuantumTape() as tape:
+            circuit(0.0, 0.0, 0.0)
+
+        rng = np.random.default_rng(42)
+        batch = rng.uniform(-np.pi, np.pi, size=(8, 3))
+        # RX, Rot (expanded to RZ, RY, RZ) and CRY parameters
+        parameters = np.stack([batch[:, 0], *batch.T, batch[:, 2]], axis=1)
+
+        res = dev.batch_expval(tape, parameters)
+        assert res.shape == (8, 2)
+
+        for row, (x, y, z) in zip(res, batch):
+            with qml.tape.QuantumTape() as ref_tape:
+                circuit(x, y, z)
+            expected = dev.execute(ref_tape)
+            assert np.allclose(row, expected, atol=tol, rtol=0)
+
+    def test_device_state_untouched(self, dev, tol):
+        """Test that a batched execution leaves the device state as is"""
+        with qml.tape.QuantumTape() as tape:
+            qml.Hadamard(wires=0)
+            qml.RY(-0.2, wires=1)
+            qml.expval(qml.PauliZ(1))
+
+        tape.execute(dev)
+        state = dev.state.copy()
+        dev.batch_expval(tape, [[0.3], [0.5]])
+
+        assert np.allclose(dev.state, state, atol=tol, rtol=0)
@@ -178,3 +178,98 @@ class TestTensorExpval:
         expected = -(np.cos(varphi) * np.sin(phi) + np.sin(varphi) * np.cos(theta)) / np.sqrt(2)
 
         assert np.allclose(res, expected, tol)
+
+
+@pytest.mark.parametrize("theta,phi,varphi", list(zip(THETA, PHI, VARPHI)))
+class TestHamiltonianExpval:
+    """Test expectation values and variances of Hamiltonians and Hermitian matrices"""
+
+    def test_hamiltonian(self, theta, phi, varphi, qubit_device_3_wires, tol):
+        """Test that the Hamiltonian expectation value and variance match the dense matrix"""
+        dev = qubit_device_3_wires
+        H = qml.Hamiltonian(
+            [0.4, -1.2, 0.7, 0.35, 2.0],
+            [
+                qml.Identity(0),
+                qml.PauliZ(0) @ qml.PauliZ(2),
+                qml.PauliX(1),
+                qml.PauliY(0) @ qml.PauliX(1) @ qml.PauliZ(2),
+                qml.PauliY(1) @ qml.PauliY(2),
+            ],
+        )
+
+        dev.apply(
+            [
+                qml.RX(theta, wires=[0]),
+                qml.RY(phi, wires=[1]),
+                qml.RX(varphi, wires=[2]),
+                qml.CNOT(wires=[0, 1]),
+                qml.CNOT(wires=[1, 2]),
+            ]
+        )
+
+        H_mat = qml.utils.sparse_hamiltonian(H, wires=dev.wires).toarray()
+        psi = dev.state
+        mean = np.vdot(psi, H_mat @ psi).real
+        mean_sq = np.vdot(H_mat @ psi, H_mat @ psi).real
+
+        assert np.allclose(dev.expval(H), mean, atol=tol, rtol=0)
+        assert np.allclose(dev.var(H), mean_sq - mean ** 2, atol=tol, rtol=0)
+
+    def test_sparse_hamiltonian(self, theta, phi, varphi, qubit_device_3_wires, tol):
+        """Test that the sparse Hamiltonian expectation value and variance match the dense
+        matrix"""
+        dev = qubit_device_3_wires
+        H = qml.Hamiltonian(
+            [0.4, -1.2, 0.7, 0.35],
+            [
+                qml.PauliZ(0) @ qml.PauliZ(2),
+                qml.PauliX(1),
+                qml.PauliY(0) @ qml.PauliX(1) @ qml.PauliZ(2),
+                qml.PauliY(1) @ qml.PauliY(2),
+            ],
+        )
+        H_sparse = qml.utils.sparse_hamiltonian(H, wires=dev.wires)
+
+        dev.apply(
+            [
+                qml.RX(theta, wires=[0]),
+                qml.RY(phi, wires=[1]),
+                qml.RX(varphi, wires=[2]),
+                qml.CNOT(wires=[0, 1]),
+                qml.CNOT(wires=[1, 2]),
+            ]
+        )
+
+        H_mat = H_sparse.toarray()
+        psi = dev.state
+        mean = np.vdot(psi, H_mat @ psi).real
+        mean_sq = np.vdot(H_mat @ psi, H_mat @ psi).real
+
+        obs = qml.SparseHamiltonian(H_sparse, wires=dev.wires)
+        assert np.allclose(dev.expval(obs), mean, atol=tol, rtol=0)
+        assert np.allclose(dev.var(obs), mean_sq - mean ** 2, atol=tol, rtol=0)
+
+    def test_hermitian(self, theta, phi, varphi, qubit_device_3_wires, tol):
+        """Test that the expectation value of a Hermitian matrix on some of the wires matches the
+        dense matrix over all wires"""
+        dev = qubit_device_3_wires
+        M = np.array([[1.0, 0.3 - 0.2j, 0], [0.3 + 0.2j, -0.5, 1j], [0, -1j, 2.0]])
+        M = np.pad(M, ((0, 1), (0, 1)))
+
+        dev.apply(
+            [
+                qml.RX(theta, wires=[0]),
+                qml.RY(phi, wires=[1]),
+                qml.RX(varphi, wires=[2]),
+                qml.CNOT(wires=[0, 1]),
+                qml.CNOT(wires=[1, 2]),
+            ]
+        )
+
+        # The matrix acts on wires 2 and 0, in that order
+        M_full = qml.utils.expand(M, [2, 0], dev.wires)
+        psi = dev.state
+
+        expected = np.vdot(psi, M_full @ psi).real
+        assert np.allclose(dev.expval(qml.Hermitian(M, wires=[2, 0])), expected, atol=tol, rtol=0)
@@ -16,8 +16,15 @@ Unit tests for the serialization helper functions
 """
 import pennylane as qml
 from pennylane import numpy as np
+from scipy.sparse import coo_matrix
 
-from pennylane_lightning._serialize import _serialize_obs, _serialize_ops, _obs_has_kernel
+from pennylane_lightning._serialize import (
+    _serialize_obs,
+    _serialize_ops,
+    _serialize_params,
+    _tape_structure_key,
+    _obs_has_kernel,
+)
 
 import pytest
 
@@ -200,6 +207,54 @@ class TestSerializeObs:
         assert np.allclose(s[1][0], s_expected[1][0])
         assert s[2] == s_expected[2]
 
+    def test_projector_return(self, monkeypatch):
+        """Test that a Projector, which has no kernel in the C++ backend, is serialized as its
+        matrix"""
+        with qml.tape.QuantumTape() as tape:
+            qml.expval(qml.Projector([0, 1], wires=[0, 1]) @ qml.PauliZ(2))
+
+        mock_obs = mock.MagicMock()
+
+        with monkeypatch.context() as m:
+            m.setattr(pennylane_lightning._serialize, "ObsStructC128", mock_obs)
+            _serialize_obs(tape, self.wires_dict)
+
+        s = mock_obs.call_args[0]
+        P = np.diag([0, 1, 0, 0]).astype(np.complex128)
+        s_expected = (["Projector", "PauliZ"], [P.ravel(), []], [[0, 1], [2]])
+        ObsStructC128(*s_expected)
+
+        assert s[0] == s_expected[0]
+        assert np.allclose(s[1][0], s_expected[1][0])
+        assert s[1][1] == []
+        assert s[2] == s_expected[2]
+
+    def test_sparse_hamiltonian_return(self, monkeypatch):
+        """Test that a sparse Hamiltonian over all wires is serialized in CSR format"""
+        H = np.array([[1, 0, 0, 2j], [0, 0, 0, 0], [0, 0, 0.5, 0], [-2j, 0, 0, 0]])
+        wires_dict = {"a": 0, "b": 1}
+
+        with qml.tape.QuantumTape() as tape:
+            qml.expval(qml.SparseHamiltonian(coo_matrix(H), wires=["a", "b"]))
+
+        mock_obs = mock.MagicMock()
+
+        with monkeypatch.context() as m:
+            m.setattr(pennylane_lightning._serialize, "ObsStructC128", mock_obs)
+            _serialize_obs(tape, wires_dict)
+
+        data, indices, indptr, wires = mock_obs.sparse_hamiltonian.call_args[0]
+        assert np.allclose(data, [1, 2j, 0.5, -2j])
+        assert np.all(indices == [0, 3, 2, 0])
+        assert np.all(indptr == [0, 2, 2, 3, 4])
+        assert wires == [0, 1]
+
+        with qml.tape.QuantumTape() as tape:
+            qml.expval(qml.SparseHamiltonian(coo_matrix(H), wires=["b", "a"]))
+
+        with pytest.raises(ValueError, match="must act on all wires of the device"):
+            _serialize_obs(tape, wires_dict)
+
     def test_integration(self, monkeypatch):
         """Test for a comprehensive range of returns"""
         wires_dict = {"a": 0, 1: 1, "b": 2, -1: 3, 3.141: 4, "five": 5, 6: 6, 77: 7, 9: 8}
@@ -207,6 +262,7 @@ class TestSerializeObs:
         X = qml.PauliX.matrix.astype(np.complex128)
         Y = qml.PauliY.matrix.astype(np.complex128)
         Z = qml.PauliZ.matrix.astype(np.complex128)
+        P = np.diag([0, 0, 0, 1]).astype(np.complex128)
 
         mock_obs = mock.MagicMock()
 
@@ -214,7 +270,7 @@ class TestSerializeObs:
             qml.expval(qml.PauliZ("a") @ qml.PauliX("b"))
             qml.expval(qml.Hermitian(I, wires=1))
             qml.expval(qml.PauliZ(-1) @ qml.Hermitian(X, wires=3.141) @ qml.Hadamard("five"))
-            # qml.expval(qml.Projector([1, 1], wires=[6, 77]) @ qml.Hermitian(Y, wires=9))
+            qml.expval(qml.Projector([1, 1], wires=[6, 77]) @ qml.Hermitian(Y, wires=9))
             qml.expval(qml.Hermitian(Z, wires="a") @ qml.Identity(1))
 
         with monkeypatch.context() as m:
@@ -227,7 +283,7 @@ class TestSerializeObs:
             (["PauliZ", "PauliX"], [], [[0], [2]]),
             (["Hermitian"], [I.ravel()], [[1]]),
             (["PauliZ", "Hermitian", "Hadamard"], [[], X.ravel(), []], [[3], [4], [5]]),
-            # (["Projector", "Hermitian"], [[],Y.ravel().astype(np.complex128)], [[6, 7], [8]]),
+            (["Projector", "Hermitian"], [P.ravel(), Y.ravel()], [[6, 7], [8]]),
             (["Hermitian", "Identity"], [Z.ravel(), []], [[0], [1]]),
         ]
         [ObsStructC128(*s_expected) for s_expected in s_expected]
@@ -287,6 +343,52 @@ class TestSerializeOps:
         )
         assert s == s_expected
 
+    def test_includes_prep_circuit(self):
+        """Test expected serialization for a simple circuit with state preparation, such that
+        the state preparation is included to be applied natively"""
+        with qml.tape.QuantumTape() as tape:
+            qml.BasisState([1, 0], wires=[1, 0])
+            qml.RX(0.4, wires=0)
+
+        with qml.tape.QuantumTape() as tape_sv:
+            qml.QubitStateVector([0, 1], wires=1)
+            qml.RX(0.4, wires=0)
+
+        s = _serialize_ops(tape, self.wires_dict, include_stateprep=True)
+        s_expected = (
+            (
+                ["BasisState", "RX"],
+                [[1.0, 0.0], [0.4]],
+                [[1, 0], [0]],
+                [False, False],
+                [[], []],
+            ),
+            True,
+        )
+        assert s == s_expected
+
+        (names, params, wires, inverses, mats), uses_stateprep = _serialize_ops(
+            tape_sv, self.wires_dict, include_stateprep=True
+        )
+        assert uses_stateprep
+        assert names == ["QubitStateVector", "RX"]
+        assert params == [[], [0.4]]
+        assert wires == [[1], [0]]
+        assert inverses == [False, False]
+        assert np.allclose(mats[0], [0, 1])
+        assert mats[1] == []
+
+    def test_single_precision_matrices(self):
+        """Test that the matrices are serialized in single precision when requested"""
+        with qml.tape.QuantumTape() as tape:
+            qml.QubitStateVector([0, 1], wires=1)
+            qml.QubitUnitary(np.eye(2), wires=0)
+
+        (_, _, _, _, mats), _ = _serialize_ops(
+            tape, self.wires_dict, include_stateprep=True, use_csingle=True
+        )
+        assert [m.dtype for m in mats] == [np.complex64, np.complex64]
+
     def test_inverse_circuit(self):
         """Test expected serialization for a simple circuit that includes an inverse gate"""
         with qml.tape.QuantumTape() as tape:
@@ -339,6 +441,25 @@ class TestSerializeOps:
 
         assert all(np.allclose(s1, s2) for s1, s2 in zip(s[0][4], s_expected[0][4]))
 
+    def test_unsupported_kernel_matrix_params(self):
+        """Test expected serialization of the gates without a dedicated kernel when keeping their
+        scalar parameters"""
+        with qml.tape.QuantumTape() as tape:
+            qml.IsingXX(0.4, wires=[0, 1]).inv()
+            qml.QubitUnitary(np.eye(2), wires=2)
+            qml.Rot(0.1, 0.2, 0.3, wires=1)
+
+        (names, params, wires, inverses, mats), _ = _serialize_ops(
+            tape, self.wires_dict, with_matrix_params=True
+        )
+        assert names == ["IsingXX", "QubitUnitary", "Rot"]
+        assert params == [[0.4], [], [0.1, 0.2, 0.3]]
+        assert wires == [[0, 1], [2], [1]]
+        assert inverses == [True, False, False]
+        assert np.allclose(mats[0], qml.IsingXX(0.4, wires=[0, 1]).matrix)
+        assert np.allclose(mats[1], np.eye(2))
+        assert mats[2] == []
+
     def test_custom_wires_circuit(self):
         """Test expected serialization for a simple circuit with custom wire labels"""
         wires_dict = {"a": 0, 3.2: 1}
@@ -395,3 +516,47 @@ class TestSerializeOps:
         assert s[1] == s_expected[1]
 
         assert all(np.allclose(s1, s2) for s1, s2 in zip(s[0][4], s_expected[0][4]))
+
+
+class TestSerializeParams:
+    """Tests for the _tape_structure_key and _serialize_params functions"""
+
+    @staticmethod
+    def make_tape(a, b, c, state=(1, 0)):
+        """Returns a tape whose parameters are given"""
+        with qml.tape.QuantumTape() as tape:
+            qml.BasisState(np.array(state), wires=[0, 1])
+            qml.RX(a, wires=0)
+            qml.IsingXX(b, wires=[0, 1]).inv()
+            qml.Rot(c, 0.2, 0.3, wires=1)
+            qml.expval(qml.PauliZ(0) @ qml.PauliX(1))
+        return tape
+
+    def test_structure_key(self):
+        """Test that the key only depends on the structure of the tape"""
+        key = _tape_structure_key(self.make_tape(0.1, 0.2, 0.3))
+        assert key == _tape_structure_key(self.make_tape(-0.4, 1.2, 0.7))
+        assert key != _tape_structure_key(self.make_tape(0.1, 0.2, 0.3, state=(0, 1)))
+
+        with qml.tape.QuantumTape() as tape:
+            qml.BasisState(np.array([1, 0]), wires=[0, 1])
+            qml.RX(0.1, wires=1)
+            qml.IsingXX(0.2, wires=[0, 1]).inv()
+            qml.Rot(0.3, 0.2, 0.3, wires=1)
+            qml.expval(qml.PauliZ(0) @ qml.PauliX(1))
+        assert key != _tape_structure_key(tape)
+
+    def test_matches_serialize_ops(self):
+        """Test that the parameters and matrices match those of _serialize_ops"""
+        tape = self.make_tape(-0.4, 1.2, 0.7)
+        wires_dict = {i: i for i in range(10)}
+        (_, ops_params, _, _, ops_mats), _ = _serialize_ops(
+            tape, wires_dict, include_stateprep=True, with_matrix_params=True
+        )
+        params, mats = _serialize_params(tape, include_stateprep=True, with_matrix_params=True)
+
+        assert np.allclose(params, [-0.4, 1.2, 0.7, 0.2, 0.3])
+        assert np.allclose(params, np.concatenate([p for p in ops_params[1:] if len(p)]))
+        assert len(mats) == len(ops_mats)
+        assert all(np.allclose(m1, m2) for m1, m2 in zip(mats, ops_mats) if len(m1))
+        assert [len(m) == 0 for m in mats] == [True, True, False, True]